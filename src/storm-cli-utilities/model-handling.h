@@ -459,6 +459,12 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
     if (buildSettings.isExplorationChecksSet()) {
         options.setExplorationChecks();
     }
+    if (buildSettings.isJitSet()) {
+        options.setJitCompilation(true, buildSettings.getJitCompiler());
+    }
+    if (buildSettings.isBytecodeSet()) {
+        options.setBytecodeEvaluation();
+    }
     options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
 
     options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
@@ -489,7 +495,10 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
     } else if (ioSettings.isExplicitDRNSet()) {
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+        options.numberOfThreads = ioSettings.getNumberOfDrnParsingThreads();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+    } else if (ioSettings.isExplicitDRBSet()) {
+        result = storm::api::buildExplicitDRBModel<ValueType>(ioSettings.getExplicitDRBFilename());
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
         result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -511,7 +520,7 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
         } else if (builderType == storm::builder::BuilderType::Explicit) {
             result = buildModelSparse<ValueType>(input, buildSettings);
         }
-    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitDRBSet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
                         "Can only use sparse engine with explicit input.");
         result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
@@ -599,6 +608,13 @@ std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> prepro
         result.second = true;
     }
 
+    if (transformationSettings.isStatePermutationSet()) {
+        auto order = transformationSettings.getStatePermutationOrder();
+        STORM_LOG_INFO("Permuting the states of the model in " << storm::transformer::toString(order) << " order...");
+        result.first = storm::api::permuteModelStates(result.first, order);
+        result.second = true;
+    }
+
     return result;
 }
 
@@ -616,6 +632,9 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
                                                    input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
                                                    !ioSettings.isExplicitExportPlaceholdersDisabled());
                 break;
+            case storm::exporter::ModelExportFormat::Drb:
+                storm::api::exportSparseModelAsDrb(model, ioSettings.getExportBuildFilename());
+                break;
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
                 break;
@@ -1090,18 +1109,48 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithStatisticalEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support other data-types than floating points.");
+    verifyProperties<ValueType>(
+        input, [&input, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Statistical model checking can only filter initial states.");
+            return storm::api::verifyWithStatisticalEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+        });
+}
+
+template<typename ValueType>
+void verifyWithStatisticalEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
+    verifyProperties<ValueType>(
+        input, [&sparseModel, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Statistical model checking can only filter initial states.");
+            return storm::api::verifyWithStatisticalEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(formula, true));
+        });
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+
+    // Intermediate results are shared among the properties that are checked on the same model.
+    std::shared_ptr<storm::modelchecker::helper::SparseMdpAnalysisCache<ValueType>> analysisCache;
+    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isAnalysisCacheEnabled()) {
+        analysisCache = storm::api::createSparseMdpAnalysisCache(sparseModel);
+    }
+
+    auto verificationCallback = [&sparseModel, &ioSettings, &mpi, &analysisCache](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
         bool filterForInitialStates = states->isInitialFormula();
         auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
         if (ioSettings.isExportSchedulerSet()) {
             task.setProduceSchedulers(true);
         }
-        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+        std::unique_ptr<storm::modelchecker::CheckResult> result =
+            storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task, analysisCache);
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
@@ -1263,7 +1312,9 @@ typename std::enable_if<DdType == storm::dd::DdType::CUDD && !std::is_same<Value
 
 template<storm::dd::DdType DdType, typename ValueType>
 void verifyModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
-    if (model->isSparseModel()) {
+    if (model->isSparseModel() && mpi.engine == storm::utility::Engine::Statistical) {
+        verifyWithStatisticalEngine<ValueType>(model, input, mpi);
+    } else if (model->isSparseModel()) {
         verifyWithSparseEngine<ValueType>(model, input, mpi);
     } else {
         STORM_LOG_ASSERT(model->isSymbolicModel(), "Unexpected model type.");
@@ -1316,6 +1367,9 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Statistical && input.model) {
+        // Paths of PRISM programs and JANI models are generated on the fly, other inputs are built first.
+        verifyWithStatisticalEngine<VerificationValueType>(input, mpi);
     } else {
         std::shared_ptr<storm::models::ModelBase> model =
             buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
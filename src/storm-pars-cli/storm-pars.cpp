@@ -862,7 +862,7 @@ namespace storm {
                         optionalDepthLimit = regionSettings.getDepthLimit();
                     }
                     // TODO @Jip: change allow model simplification when not using monotonicity, for benchmarking purposes simplification is moved forward.
-                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh);
+                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh, regionSettings.getRefinementThreads(), regionSettings.getRefinementPriority());
                     return result;
                 };
             } else {
@@ -4,11 +4,13 @@
 #include <set>
 #include <vector>
 #include <memory>
+#include <thread>
 #include <boost/optional.hpp>
 
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
 #include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
 #include "storm-pars/modelchecker/region/RegionCheckEngine.h"
+#include "storm-pars/modelchecker/region/RegionRefinementPriority.h"
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseMdpParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/ValidatingSparseMdpParameterLiftingModelChecker.h"
@@ -235,12 +237,26 @@ namespace storm {
          * @param allowModelSimplification
          * @param useMonotonicity
          * @param monThresh if given, determines at which depth to start using monotonicity
+         * @param numberOfThreads the number of threads that analyze subregions concurrently. 0 means that the number of threads is detected automatically. Monotonicity is only supported with a single thread.
+         * @param priority the order in which subregions are analyzed if more than one thread is used
          */
         template <typename ValueType>
-        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0, uint64_t numberOfThreads = 1, storm::modelchecker::RegionRefinementPriority priority = storm::modelchecker::RegionRefinementPriority::Size) {
             Environment env;
             bool preconditionsValidated = false;
             auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting);
+            if (numberOfThreads == 0) {
+                numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+            }
+            STORM_LOG_WARN_COND(numberOfThreads == 1 || !monotonicitySetting.useMonotonicity, "Parallel region refinement does not support monotonicity. Using a single thread.");
+            if (numberOfThreads > 1 && !monotonicitySetting.useMonotonicity) {
+                // Every thread needs its own region model checker. As their initialization involves parametric arithmetic, they are created sequentially.
+                std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> additionalCheckers;
+                for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                    additionalCheckers.push_back(initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, true, monotonicitySetting));
+                }
+                return regionChecker->performParallelRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, additionalCheckers, priority);
+            }
             return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
         }
 
@@ -19,7 +19,31 @@ namespace storm {
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
             STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
-            auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
+            return checkInstantiatedModel(env, modelInstantiator.instantiate(valuation));
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            if (!batchedFunctionEvaluator) {
+                batchedFunctionEvaluator = std::make_unique<storm::utility::BatchedFunctionEvaluator<ConstantType>>(modelInstantiator.getOccurringFunctions());
+            }
+            
+            // The value of the i-th function for the k-th valuation is at position i * valuations.size() + k
+            std::vector<ConstantType> functionValues;
+            batchedFunctionEvaluator->evaluate(valuations, functionValues);
+            
+            std::vector<std::unique_ptr<CheckResult>> results;
+            results.reserve(valuations.size());
+            for (uint64_t k = 0; k < valuations.size(); ++k) {
+                ConstantType const* firstFunctionValue = functionValues.empty() ? nullptr : functionValues.data() + k;
+                results.push_back(checkInstantiatedModel(env, modelInstantiator.instantiate(firstFunctionValue, valuations.size())));
+            }
+            return results;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkInstantiatedModel(Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel) {
             STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
             storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(instantiatedModel);
 
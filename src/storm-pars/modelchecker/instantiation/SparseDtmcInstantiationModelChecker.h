@@ -1,9 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <boost/optional.hpp>
 
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
+#include "storm-pars/utility/BatchedFunctionEvaluator.h"
 #include "storm-pars/utility/ModelInstantiator.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -21,15 +23,29 @@ namespace storm {
             SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel);
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
+            
+            /*!
+             * Checks the specified formula for all given valuations.
+             * The occurring functions are evaluated for all valuations at once. As the instantiated models share the same structure, they are then
+             * checked one after another on the same instantiated model, where the result of one valuation serves as hint for the next one.
+             *
+             * @return The results in the order of the given valuations.
+             */
+            std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
 
         protected:
             
+            std::unique_ptr<CheckResult> checkInstantiatedModel(Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel);
+            
             // Optimizations for the different formula types
             std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkReachabilityRewardFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkBoundedUntilFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             
             storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
+            
+            // Evaluates the functions occurring in the model for a batch of valuations. Only created upon the first batch check.
+            std::unique_ptr<storm::utility::BatchedFunctionEvaluator<ConstantType>> batchedFunctionEvaluator;
         };
     }
 }
@@ -1,5 +1,9 @@
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <sstream>
 #include <queue>
+#include <thread>
 
 #include "storm-pars/analysis/OrderExtender.cpp"
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
@@ -325,6 +329,144 @@ namespace storm {
             }
 
 
+        template <typename ParametricType>
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performParallelRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& additionalCheckers, RegionRefinementPriority const& priority) {
+            STORM_LOG_THROW(!useMonotonicity, storm::exceptions::NotSupportedException, "Parallel region refinement does not support the usage of monotonicity.");
+            STORM_LOG_INFO("Applying parallel refinement with " << (additionalCheckers.size() + 1) << " threads on region: " << region.toString(true) << " .");
+
+            auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+            auto areaOfParameterSpace = region.area();
+            auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+
+            // A region that still needs to be processed. The index reflects the order in which the regions were created.
+            struct RefinementTask {
+                storm::storage::ParameterRegion<ParametricType> region;
+                RegionResult result;
+                uint64_t depth;
+                uint64_t index;
+                CoefficientType area;
+            };
+            auto isKnownToExist = [](RegionResult const& result) {
+                return result == RegionResult::ExistsSat || result == RegionResult::ExistsViolated || result == RegionResult::CenterSat || result == RegionResult::CenterViolated;
+            };
+            // Returns true if the first task is to be processed after the second one.
+            auto hasLowerPriority = [&priority, &isKnownToExist](RefinementTask const& task1, RefinementTask const& task2) {
+                if (priority == RegionRefinementPriority::Uncertainty && isKnownToExist(task1.result) != isKnownToExist(task2.result)) {
+                    return isKnownToExist(task2.result);
+                }
+                if (task1.area != task2.area) {
+                    return task1.area < task2.area;
+                }
+                return task1.index > task2.index;
+            };
+
+            // All data below is shared between the threads and may only be accessed while holding the mutex.
+            std::mutex mutex;
+            std::condition_variable unprocessedRegionsChanged;
+            std::vector<RefinementTask> unprocessedRegions;
+            std::vector<std::pair<uint64_t, std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>>> result;
+            uint64_t numOfCreatedRegions = 1;
+            uint64_t numOfAnalyzedRegions = 0;
+            uint64_t numOfBusyThreads = 0;
+            bool aborted = false;
+            unprocessedRegions.push_back(RefinementTask{region, RegionResult::Unknown, 0, 0, areaOfParameterSpace});
+
+            uint64_t const numberOfThreads = additionalCheckers.size() + 1;
+            std::vector<std::exception_ptr> exceptions(numberOfThreads);
+            auto refineRegions = [&](uint64_t thread) {
+                RegionModelChecker<ParametricType>& checker = thread == 0 ? *this : *additionalCheckers[thread - 1];
+                std::unique_lock<std::mutex> lock(mutex);
+                checker.concurrentRefinementMutex = &mutex;
+                try {
+                    while (true) {
+                        // Wait until there is a region to process or until the refinement is finished.
+                        unprocessedRegionsChanged.wait(lock, [&]() { return aborted || fractionOfUndiscoveredArea <= thresholdAsCoefficient || !unprocessedRegions.empty() || numOfBusyThreads == 0; });
+                        if (aborted || fractionOfUndiscoveredArea <= thresholdAsCoefficient || unprocessedRegions.empty()) {
+                            break;
+                        }
+                        std::pop_heap(unprocessedRegions.begin(), unprocessedRegions.end(), hasLowerPriority);
+                        RefinementTask task = std::move(unprocessedRegions.back());
+                        unprocessedRegions.pop_back();
+                        ++numOfBusyThreads;
+
+                        STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << task.depth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                        // The checker releases the mutex while it performs computations that do not involve parametric arithmetic.
+                        task.result = checker.analyzeRegion(env, task.region, hypothesis, task.result, false);
+
+                        switch (task.result) {
+                            case RegionResult::AllSat:
+                            case RegionResult::AllViolated:
+                                fractionOfUndiscoveredArea -= task.area / areaOfParameterSpace;
+                                result.emplace_back(task.index, std::make_pair(std::move(task.region), task.result));
+                                break;
+                            default:
+                                // Split the region as long as the desired refinement depth is not reached.
+                                if (!depthThreshold || task.depth < depthThreshold.get()) {
+                                    std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                                    RegionResult initResForNewRegions = (task.result == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                        ((task.result == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                         RegionResult::Unknown);
+                                    task.region.split(task.region.getCenterPoint(), newRegions);
+                                    for (auto& newRegion : newRegions) {
+                                        CoefficientType newArea = newRegion.area();
+                                        unprocessedRegions.push_back(RefinementTask{std::move(newRegion), initResForNewRegions, task.depth + 1, numOfCreatedRegions++, std::move(newArea)});
+                                        std::push_heap(unprocessedRegions.begin(), unprocessedRegions.end(), hasLowerPriority);
+                                    }
+                                } else {
+                                    // If the region is not further refined, it is still added to the result
+                                    result.emplace_back(task.index, std::make_pair(std::move(task.region), task.result));
+                                }
+                                break;
+                        }
+                        ++numOfAnalyzedRegions;
+                        --numOfBusyThreads;
+                        unprocessedRegionsChanged.notify_all();
+                    }
+                } catch (...) {
+                    exceptions[thread] = std::current_exception();
+                    aborted = true;
+                    unprocessedRegionsChanged.notify_all();
+                }
+                checker.concurrentRefinementMutex = nullptr;
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(numberOfThreads - 1);
+            for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                threads.emplace_back(refineRegions, thread);
+            }
+            refineRegions(0);
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+
+            // Add the still unprocessed regions to the result
+            for (auto& task : unprocessedRegions) {
+                result.emplace_back(task.index, std::make_pair(std::move(task.region), task.result));
+            }
+
+            // Sort the result such that it does not depend on the order in which the threads processed the regions.
+            std::sort(result.begin(), result.end(), [](auto const& entry1, auto const& entry2) { return entry1.first < entry2.first; });
+            std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> sortedResult;
+            sortedResult.reserve(result.size());
+            for (auto& entry : result) {
+                sortedResult.push_back(std::move(entry.second));
+            }
+
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
+                STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions using " << numberOfThreads << " threads.\n");
+            }
+
+            auto regionCopyForResult = region;
+            return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(sortedResult), std::move(regionCopyForResult));
+        }
+
         template <typename ParametricType>
         void RegionModelChecker<ParametricType>::extendLocalMonotonicityResult(storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult){
             STORM_LOG_WARN("Initializing local Monotonicity Results not implemented for RegionModelChecker.");
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "storm-pars/analysis/Order.h"
 #include "storm-pars/analysis/OrderExtender.h"
 #include "storm-pars/analysis/LocalMonotonicityResult.h"
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
 #include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
+#include "storm-pars/modelchecker/region/RegionRefinementPriority.h"
 #include "storm-pars/modelchecker/region/RegionResult.h"
 #include "storm-pars/modelchecker/region/RegionResultHypothesis.h"
 #include "storm-pars/storage/ParameterRegion.h"
@@ -62,6 +65,18 @@ namespace storm {
              */
             std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, uint64_t monThresh = 0);
 
+            /*!
+             * Iteratively refines the region like performRegionRefinement, but analyzes (independent) subregions concurrently.
+             * The pending subregions are kept in a shared queue that is ordered according to the given priority.
+             * @param region the considered region
+             * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this threshold
+             * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
+             * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
+             * @param additionalCheckers region model checkers that have been specified for the same model and check task as this checker. For each of them, an additional thread is used.
+             * @param priority the order in which pending subregions are analyzed
+             */
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performParallelRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& additionalCheckers, RegionRefinementPriority const& priority = RegionRefinementPriority::Size);
+
             // TODO: documentation
             /*!
              * Finds the extremal value within the given region and with the given precision.
@@ -101,8 +116,36 @@ namespace storm {
             bool useOnlyGlobal = false;
             bool useBounds = false;
 
+            // If not null, this checker analyzes regions concurrently to other checkers and the mutex needs to be held whenever parametric computations are performed.
+            std::mutex* concurrentRefinementMutex = nullptr;
+
         protected:
 
+            /*!
+             * While a guard exists, other region model checkers that take part in the same parallel region refinement can proceed.
+             * As parametric (and exact) arithmetic is not thread-safe, a guard must only enclose computations that exclusively involve data owned by this checker and no such arithmetic.
+             */
+            class ConcurrentComputationGuard {
+            public:
+                ConcurrentComputationGuard(RegionModelChecker<ParametricType> const& checker, bool enabled = true) : mutex(enabled ? checker.concurrentRefinementMutex : nullptr) {
+                    if (mutex) {
+                        mutex->unlock();
+                    }
+                }
+
+                ~ConcurrentComputationGuard() {
+                    if (mutex) {
+                        mutex->lock();
+                    }
+                }
+
+                ConcurrentComputationGuard(ConcurrentComputationGuard const&) = delete;
+                ConcurrentComputationGuard& operator=(ConcurrentComputationGuard const&) = delete;
+
+            private:
+                std::mutex* mutex;
+            };
+
             uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
             boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneIncrParameters;
             boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneDecrParameters;
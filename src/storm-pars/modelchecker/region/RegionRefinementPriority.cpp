@@ -0,0 +1,22 @@
+#include "storm-pars/modelchecker/region/RegionRefinementPriority.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotImplementedException.h"
+
+namespace storm {
+    namespace modelchecker {
+        std::ostream& operator<<(std::ostream& os, RegionRefinementPriority const& regionRefinementPriority) {
+            switch (regionRefinementPriority) {
+                case RegionRefinementPriority::Size:
+                    os << "Size";
+                    break;
+                case RegionRefinementPriority::Uncertainty:
+                    os << "Uncertainty";
+                    break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Could not get a string from the region refinement priority. The case has not been implemented");
+            }
+            return os;
+        }
+    }
+}
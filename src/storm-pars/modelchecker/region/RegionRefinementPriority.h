@@ -0,0 +1,17 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+    namespace modelchecker {
+        /*!
+         * The order in which pending regions are analyzed during (parallel) region refinement
+         */
+        enum class RegionRefinementPriority {
+            Size, /*!< larger regions are analyzed first */
+            Uncertainty /*!< regions for which a satisfying or violating point is already known are analyzed first. Ties are broken by size */
+        };
+        
+        std::ostream& operator<<(std::ostream& os, RegionRefinementPriority const& regionRefinementPriority);
+    }
+}
@@ -383,7 +383,11 @@ namespace storm {
 
                 // Invoke the solver
                 x.resize(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
-                solver->solveEquations(env, dirForParameters, x, parameterLifter->getVector());
+                {
+                    // Solving the lifted model does not involve parametric arithmetic, so concurrently refined regions can be analyzed meanwhile.
+                    typename RegionModelChecker<ValueType>::ConcurrentComputationGuard guard(*this, !storm::NumberTraits<ConstantType>::IsExact);
+                    solver->solveEquations(env, dirForParameters, x, parameterLifter->getVector());
+                }
                 if (storm::solver::minimize(dirForParameters)) {
                     minSchedChoices = solver->getSchedulerChoices();
                 } else {
@@ -281,7 +281,11 @@ namespace storm {
                 STORM_LOG_ASSERT(*stepBound > 0, "Expected positive step bound.");
                 solver->repeatedMultiply(env, this->currentCheckTask->getOptimizationDirection(), dirForParameters, x, &parameterLifter->getVector(), *stepBound);
             } else {
-                solver->solveGame(env, this->currentCheckTask->getOptimizationDirection(), dirForParameters, x, parameterLifter->getVector());
+                {
+                    // Solving the lifted model does not involve parametric arithmetic, so concurrently refined regions can be analyzed meanwhile.
+                    typename RegionModelChecker<typename SparseModelType::ValueType>::ConcurrentComputationGuard guard(*this, !storm::NumberTraits<ConstantType>::IsExact);
+                    solver->solveGame(env, this->currentCheckTask->getOptimizationDirection(), dirForParameters, x, parameterLifter->getVector());
+                }
                 if(applyPreviousResultAsHint) {
                     if(storm::solver::minimize(dirForParameters)) {
                         minSchedChoices = solver->getPlayer2SchedulerChoices();
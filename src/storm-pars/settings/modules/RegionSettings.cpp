@@ -22,6 +22,8 @@ namespace storm {
             const std::string RegionSettings::hypothesisOptionName = "hypothesis";
             const std::string RegionSettings::hypothesisShortOptionName = "hyp";
             const std::string RegionSettings::refineOptionName = "refine";
+            const std::string RegionSettings::refinementThreadsOptionName = "refine-threads";
+            const std::string RegionSettings::refinementPriorityOptionName = "refine-priority";
             const std::string RegionSettings::extremumOptionName = "extremum";
             const std::string RegionSettings::extremumSuggestionOptionName = "extremum-init";
             const std::string RegionSettings::splittingThresholdName = "splitting-threshold";
@@ -44,6 +46,13 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("coverage-threshold", "Refinement converges if the fraction of unknown area falls below this threshold.").setDefaultValueDouble(0.05).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0,1.0)).build())
                                 .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument("depth-limit", "If given, limits the number of times a region is refined.").setDefaultValueInteger(-1).makeOptional().build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinementThreadsOptionName, true, "Sets the number of threads that analyze subregions concurrently during region refinement.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means that the number is detected automatically.").setDefaultValueUnsignedInteger(1).build()).build());
+
+                std::vector<std::string> priorities = {"size", "uncertainty"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinementPriorityOptionName, true, "Sets the order in which subregions are analyzed during parallel region refinement.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("priority", "The priority. 'size' analyzes larger regions first, 'uncertainty' prefers regions where a satisfying or violating point is known.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(priorities)).setDefaultValueString("size").build()).build());
+
                 std::vector<std::string> directions = {"min", "max"};
                 std::vector<std::string> precisiontype = {"rel", "abs"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, extremumOptionName, false, "Computes the extremum within the region.")
@@ -122,6 +131,25 @@ namespace storm {
                 return (uint64_t) depth;
             }
             
+            uint64_t RegionSettings::getRefinementThreads() const {
+                return this->getOption(refinementThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            storm::modelchecker::RegionRefinementPriority RegionSettings::getRefinementPriority() const {
+                std::string priorityString = this->getOption(refinementPriorityOptionName).getArgumentByName("priority").getValueAsString();
+
+                storm::modelchecker::RegionRefinementPriority result;
+                if (priorityString == "size") {
+                    result = storm::modelchecker::RegionRefinementPriority::Size;
+                } else if (priorityString == "uncertainty") {
+                    result = storm::modelchecker::RegionRefinementPriority::Uncertainty;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown region refinement priority '" << priorityString << "'.");
+                }
+                
+                return result;
+            }
+
             bool RegionSettings::isExtremumSet() const {
                 return this->getOption(extremumOptionName).getHasOptionBeenSet();
             }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm-pars/modelchecker/region/RegionCheckEngine.h"
+#include "storm-pars/modelchecker/region/RegionRefinementPriority.h"
 #include "storm-pars/modelchecker/region/RegionResultHypothesis.h"
 #include "storm/solver/OptimizationDirection.h"
 
@@ -70,6 +71,16 @@ namespace storm {
                  * Returns the depth threshold (if set). It is illegal to call this method if no depth threshold has been set.
                  */
                 uint64_t getDepthLimit() const;
+
+                /*!
+                 * Retrieves the number of threads that analyze subregions concurrently during refinement. 0 means that the number is detected automatically.
+                 */
+                uint64_t getRefinementThreads() const;
+
+                /*!
+                 * Retrieves the order in which subregions are analyzed during parallel refinement.
+                 */
+                storm::modelchecker::RegionRefinementPriority getRefinementPriority() const;
                 
                 /*!
 				 * Retrieves whether an extremal value is to be computed
@@ -122,6 +133,8 @@ namespace storm {
 				const static std::string hypothesisOptionName;
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
+				const static std::string refinementThreadsOptionName;
+				const static std::string refinementPriorityOptionName;
 				const static std::string splittingThresholdName;
 				const static std::string extremumOptionName;
 				const static std::string extremumSuggestionOptionName;
@@ -0,0 +1,107 @@
+#include "storm-pars/utility/BatchedFunctionEvaluator.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+
+        template<typename ConstantType>
+        BatchedFunctionEvaluator<ConstantType>::BatchedFunctionEvaluator(std::vector<FunctionType> const& functions) {
+            std::map<VariableType, uint64_t> variableToIndex;
+            polynomialIndications.push_back(0);
+            termIndications.push_back(0);
+            for (auto const& function : functions) {
+                compilePolynomial(function.nominatorAsPolynomial().polynomialWithCoefficient(), variableToIndex);
+                compilePolynomial(function.denominatorAsPolynomial().polynomialWithCoefficient(), variableToIndex);
+            }
+            variables.resize(variableToIndex.size());
+            for (auto const& variableIndexPair : variableToIndex) {
+                variables[variableIndexPair.second] = variableIndexPair.first;
+            }
+        }
+
+        template<typename ConstantType>
+        void BatchedFunctionEvaluator<ConstantType>::compilePolynomial(storm::RawPolynomial const& polynomial, std::map<VariableType, uint64_t>& variableToIndex) {
+            for (auto const& term : polynomial) {
+                termCoefficients.push_back(storm::utility::convertNumber<ConstantType>(term.coeff()));
+                if (term.monomial()) {
+                    for (auto const& variableExponentPair : *term.monomial()) {
+                        auto indexIt = variableToIndex.emplace(variableExponentPair.first, variableToIndex.size()).first;
+                        factorVariables.push_back(indexIt->second);
+                        factorExponents.push_back(variableExponentPair.second);
+                    }
+                }
+                termIndications.push_back(factorVariables.size());
+            }
+            polynomialIndications.push_back(termCoefficients.size());
+        }
+
+        template<typename ConstantType>
+        void BatchedFunctionEvaluator<ConstantType>::evaluate(std::vector<storm::utility::parametric::Valuation<FunctionType>> const& valuations, std::vector<ConstantType>& result) const {
+            uint64_t const batchSize = valuations.size();
+            result.assign(getNumberOfFunctions() * batchSize, storm::utility::zero<ConstantType>());
+            if (batchSize == 0) {
+                return;
+            }
+
+            // Gather the values of each variable such that they are consecutive for all valuations.
+            std::vector<ConstantType> variableValues;
+            variableValues.reserve(variables.size() * batchSize);
+            for (auto const& variable : variables) {
+                for (auto const& valuation : valuations) {
+                    auto valueIt = valuation.find(variable);
+                    STORM_LOG_THROW(valueIt != valuation.end(), storm::exceptions::InvalidArgumentException, "The valuation does not assign a value to the variable " << variable << ".");
+                    variableValues.push_back(storm::utility::convertNumber<ConstantType>(valueIt->second));
+                }
+            }
+
+            std::vector<ConstantType> termValues(batchSize);
+            std::vector<ConstantType> denominatorValues(batchSize);
+            for (uint64_t function = 0; function < getNumberOfFunctions(); ++function) {
+                ConstantType* functionValues = result.data() + function * batchSize;
+                evaluatePolynomial(2 * function, variableValues, batchSize, functionValues, termValues.data());
+                evaluatePolynomial(2 * function + 1, variableValues, batchSize, denominatorValues.data(), termValues.data());
+                for (uint64_t k = 0; k < batchSize; ++k) {
+                    functionValues[k] /= denominatorValues[k];
+                }
+            }
+        }
+
+        template<typename ConstantType>
+        void BatchedFunctionEvaluator<ConstantType>::evaluatePolynomial(uint64_t polynomial, std::vector<ConstantType> const& variableValues, uint64_t batchSize, ConstantType* result, ConstantType* termValues) const {
+            std::fill(result, result + batchSize, storm::utility::zero<ConstantType>());
+            for (uint64_t term = polynomialIndications[polynomial]; term < polynomialIndications[polynomial + 1]; ++term) {
+                std::fill(termValues, termValues + batchSize, termCoefficients[term]);
+                for (uint64_t factor = termIndications[term]; factor < termIndications[term + 1]; ++factor) {
+                    ConstantType const* values = variableValues.data() + factorVariables[factor] * batchSize;
+                    for (uint64_t exponent = 0; exponent < factorExponents[factor]; ++exponent) {
+                        for (uint64_t k = 0; k < batchSize; ++k) {
+                            termValues[k] *= values[k];
+                        }
+                    }
+                }
+                for (uint64_t k = 0; k < batchSize; ++k) {
+                    result[k] += termValues[k];
+                }
+            }
+        }
+
+        template<typename ConstantType>
+        uint64_t BatchedFunctionEvaluator<ConstantType>::getNumberOfFunctions() const {
+            return (polynomialIndications.size() - 1) / 2;
+        }
+
+        template<typename ConstantType>
+        std::vector<typename BatchedFunctionEvaluator<ConstantType>::VariableType> const& BatchedFunctionEvaluator<ConstantType>::getVariables() const {
+            return variables;
+        }
+
+        template class BatchedFunctionEvaluator<double>;
+        template class BatchedFunctionEvaluator<storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * Evaluates a fixed set of rational functions for many valuations at once.
+         * Upon construction, the functions are compiled into a flat program that consists of the terms of their numerators and denominators.
+         * The program is then executed for a batch of valuations, where each instruction is applied to all valuations in a tight loop. For floating point
+         * types, these loops can be vectorized by the compiler. This is much faster than evaluating each function for each valuation separately.
+         *
+         * @note For floating point types, the coefficients and the valuations are converted before the evaluation. The result might thus slightly differ
+         * from the result of an exact evaluation that is converted afterwards.
+         */
+        template<typename ConstantType>
+        class BatchedFunctionEvaluator {
+        public:
+            typedef storm::RationalFunction FunctionType;
+            typedef typename storm::utility::parametric::VariableType<FunctionType>::type VariableType;
+
+            /*!
+             * Compiles the given functions.
+             */
+            BatchedFunctionEvaluator(std::vector<FunctionType> const& functions);
+
+            /*!
+             * Evaluates all functions for all given valuations.
+             *
+             * @param valuations The valuations. Each valuation has to assign a value to every variable occurring in the functions.
+             * @param result Is set to the values of the functions. The value of the i-th function for the k-th valuation is stored at position i * valuations.size() + k.
+             */
+            void evaluate(std::vector<storm::utility::parametric::Valuation<FunctionType>> const& valuations, std::vector<ConstantType>& result) const;
+
+            uint64_t getNumberOfFunctions() const;
+
+            std::vector<VariableType> const& getVariables() const;
+
+        private:
+            void compilePolynomial(storm::RawPolynomial const& polynomial, std::map<VariableType, uint64_t>& variableToIndex);
+
+            /*!
+             * Evaluates the given polynomial for all valuations. The values of variable i for all valuations are expected at variableValues[i * batchSize + k].
+             */
+            void evaluatePolynomial(uint64_t polynomial, std::vector<ConstantType> const& variableValues, uint64_t batchSize, ConstantType* result, ConstantType* termValues) const;
+
+            // The variables occurring in the functions.
+            std::vector<VariableType> variables;
+
+            // The numerator of the i-th function is polynomial 2i and the denominator is polynomial 2i+1. The terms of polynomial p are the ones in
+            // [polynomialIndications[p], polynomialIndications[p+1]) and the factors of term t are the ones in [termIndications[t], termIndications[t+1]).
+            std::vector<uint64_t> polynomialIndications;
+            std::vector<ConstantType> termCoefficients;
+            std::vector<uint64_t> termIndications;
+            std::vector<uint64_t> factorVariables;
+            std::vector<uint64_t> factorExponents;
+        };
+
+    }
+}
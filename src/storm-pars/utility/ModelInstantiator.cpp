@@ -139,6 +139,34 @@ namespace storm {
                 //Write results into the placeholders
                 instantiate_helper(valuation);
                 
+                writeMappedValues();
+                return *this->instantiatedModel;
+            }
+            
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(ConstantType const* functionValues, uint64_t stride){
+                //Write the given values into the placeholders. The order coincides with the one of getOccurringFunctions()
+                for(auto& functionResult : this->functions){
+                    functionResult.second = *functionValues;
+                    functionValues += stride;
+                }
+                
+                writeMappedValues();
+                return *this->instantiatedModel;
+            }
+            
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            std::vector<typename ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ParametricType> ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::getOccurringFunctions() const {
+                std::vector<ParametricType> result;
+                result.reserve(this->functions.size());
+                for(auto const& functionResult : this->functions){
+                    result.push_back(functionResult.first);
+                }
+                return result;
+            }
+            
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::writeMappedValues() {
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
                 for(auto& entryValuePair : this->matrixMapping){
                     entryValuePair.first->setValue(*(entryValuePair.second));
@@ -146,8 +174,6 @@ namespace storm {
                 for(auto& entryValuePair : this->vectorMapping){
                     *(entryValuePair.first)=*(entryValuePair.second);
                 }
-                
-                return *this->instantiatedModel;
             }
         
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
@@ -4,6 +4,7 @@
 #include <unordered_map>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -48,11 +49,30 @@ namespace storm {
                  */
                 ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
                 
+                /*!
+                 * Retrieves the instantiated model, where the occurring functions are replaced by the given (already evaluated) values.
+                 * This allows to evaluate the functions elsewhere, e.g., for many valuations at once.
+                 * @param functionValues Points to the value of the first occurring function. The value of the i-th function (in the order of getOccurringFunctions()) is expected at functionValues[i * stride]
+                 * @param stride The distance between the values of two consecutive functions
+                 * @return The instantiated model
+                 */
+                ConstantSparseModelType const& instantiate(ConstantType const* functionValues, uint64_t stride = 1);
+                
+                /*!
+                 * Retrieves the distinct functions that occur in the parametric model.
+                 */
+                std::vector<ParametricType> getOccurringFunctions() const;
+                
                 /*!
                  *  Check validity
                  */
                 void checkValid() const;
             private:
+                /*!
+                 * Writes the values of the placeholders to the instantiated model
+                 */
+                void writeMappedValues();
+                
                 /*!
                  * Initializes the instantiatedModel with dummy data by considering the model-specific ingredients.
                  * Also initializes other model-specific data, e.g., the exitRate vector of a markov automaton
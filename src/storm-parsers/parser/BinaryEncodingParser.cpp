@@ -0,0 +1,224 @@
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+/*!
+ * Reads the sections of the binary encoding from the mapped file.
+ */
+class BinaryReader {
+   public:
+    BinaryReader(MappedFile const& file, std::string const& filename) : position(file.getData()), end(file.getDataEnd()), filename(filename) {
+        // Intentionally left empty.
+    }
+
+    uint64_t readNumber() {
+        uint64_t result;
+        read(&result, sizeof(result));
+        return result;
+    }
+
+    void read(void* target, uint64_t size) {
+        checkRemainingSize(size);
+        std::memcpy(target, position, size);
+        position += size;
+    }
+
+    /*!
+     * Reads a section containing elements of the given type. If the expected number of elements is given, it is
+     * checked that the section has this size. The declared size is checked against the remaining data before any
+     * memory is allocated, so a corrupt file cannot trigger huge allocations.
+     */
+    template<typename T>
+    std::vector<T> readSection(boost::optional<uint64_t> const& expectedSize = boost::none) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable data can be read.");
+        uint64_t const size = readNumber();
+        STORM_LOG_THROW(size % sizeof(T) == 0 && (!expectedSize || size / sizeof(T) == expectedSize.get()), storm::exceptions::WrongFormatException,
+                        "Unexpected size of a section in the binary model file " << filename << ".");
+        checkRemainingSize(size);
+        std::vector<T> result(size / sizeof(T));
+        read(result.data(), size);
+        skipPadding(size);
+        return result;
+    }
+
+    std::string readString() {
+        uint64_t const size = readNumber();
+        checkRemainingSize(size);
+        std::string result(size, '\0');
+        read(&result[0], size);
+        skipPadding(size);
+        return result;
+    }
+
+    storm::storage::BitVector readBitVector(uint64_t expectedSize) {
+        uint64_t const size = readNumber();
+        STORM_LOG_THROW(size == expectedSize, storm::exceptions::WrongFormatException,
+                        "Unexpected size of a bit vector in the binary model file " << filename << ".");
+        std::vector<uint64_t> buckets = readSection<uint64_t>((size + 63) / 64);
+        storm::storage::BitVector result(size);
+        for (uint64_t bucket = 0; bucket < buckets.size(); ++bucket) {
+            result.setFromInt(bucket * 64, std::min<uint64_t>(64, size - bucket * 64), buckets[bucket]);
+        }
+        return result;
+    }
+
+    void readLabeling(storm::models::sparse::ItemLabeling& labeling, uint64_t itemCount) {
+        for (uint64_t label = 0, labelCount = readNumber(); label < labelCount; ++label) {
+            std::string name = readString();
+            labeling.addLabel(name, readBitVector(itemCount));
+        }
+    }
+
+    /*!
+     * Reads the row indications, columns and values of a matrix with the given dimensions and row grouping.
+     */
+    template<typename ValueType>
+    storm::storage::SparseMatrix<ValueType> readMatrix(uint64_t rowCount, uint64_t columnCount, boost::optional<std::vector<uint64_t>>&& rowGroupIndices) {
+        STORM_LOG_THROW(rowCount < std::numeric_limits<uint64_t>::max(), storm::exceptions::WrongFormatException,
+                        "Invalid number of rows in the binary model file " << filename << ".");
+        std::vector<uint64_t> rowIndications = readSection<uint64_t>(rowCount + 1);
+        uint64_t const entryCount = rowIndications.back();
+        std::vector<uint64_t> columns = readSection<uint64_t>(entryCount);
+        std::vector<ValueType> values = readSection<ValueType>(entryCount);
+        bool valid = rowIndications.front() == 0;
+        for (uint64_t row = 0; row < rowCount; ++row) {
+            valid &= rowIndications[row] <= rowIndications[row + 1];
+        }
+        std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> columnsAndValues;
+        columnsAndValues.reserve(entryCount);
+        for (uint64_t entry = 0; entry < entryCount; ++entry) {
+            valid &= columns[entry] < columnCount;
+            columnsAndValues.emplace_back(columns[entry], values[entry]);
+        }
+        STORM_LOG_THROW(valid, storm::exceptions::WrongFormatException, "Invalid matrix in the binary model file " << filename << ".");
+        return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+    }
+
+    bool isAtEnd() const {
+        return position == end;
+    }
+
+   private:
+    void checkRemainingSize(uint64_t size) const {
+        STORM_LOG_THROW(static_cast<uint64_t>(end - position) >= size, storm::exceptions::WrongFormatException,
+                        "Unexpected end of the binary model file " << filename << ".");
+    }
+
+    void skipPadding(uint64_t size) {
+        uint64_t padding = (8 - size % 8) % 8;
+        checkRemainingSize(padding);
+        position += padding;
+    }
+
+    char const* position;
+    char const* end;
+    std::string filename;
+};
+}  // namespace
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryEncodingParser<ValueType, RewardModelType>::parseModel(
+    std::string const& filename) {
+    static_assert(std::is_trivially_copyable<ValueType>::value, "The binary encoding is only supported for models with floating point values.");
+    MappedFile file(filename.c_str());
+    BinaryReader reader(file, filename);
+
+    // Header
+    char magic[sizeof(storm::exporter::binaryEncodingMagic)];
+    reader.read(magic, sizeof(magic));
+    STORM_LOG_THROW(std::memcmp(magic, storm::exporter::binaryEncodingMagic, sizeof(magic)) == 0, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " does not contain a model in the binary encoding.");
+    uint64_t version = reader.readNumber();
+    STORM_LOG_THROW(version == storm::exporter::binaryEncodingVersion, storm::exceptions::WrongFormatException,
+                    "The binary model file " << filename << " has version " << version << ", but only version " << storm::exporter::binaryEncodingVersion
+                                             << " is supported.");
+    STORM_LOG_THROW(reader.readNumber() == sizeof(ValueType), storm::exceptions::WrongFormatException,
+                    "The values in the binary model file " << filename << " have an unexpected size.");
+    auto type = static_cast<storm::models::ModelType>(reader.readNumber());
+    STORM_LOG_THROW(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::Mdp ||
+                        type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp,
+                    storm::exceptions::NotSupportedException, "The binary model file " << filename << " contains a model of an unsupported type.");
+    uint64_t const stateCount = reader.readNumber();
+    uint64_t const choiceCount = reader.readNumber();
+    uint64_t const entryCount = reader.readNumber();
+
+    // Transition matrix
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components;
+    boost::optional<std::vector<uint64_t>> rowGroupIndices;
+    if (reader.readNumber() != 0) {
+        STORM_LOG_THROW(stateCount < std::numeric_limits<uint64_t>::max(), storm::exceptions::WrongFormatException,
+                        "Invalid number of states in the binary model file " << filename << ".");
+        rowGroupIndices = reader.readSection<uint64_t>(stateCount + 1);
+        STORM_LOG_THROW(rowGroupIndices->front() == 0 && rowGroupIndices->back() == choiceCount &&
+                            std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end()),
+                        storm::exceptions::WrongFormatException, "Invalid row groups in the binary model file " << filename << ".");
+    } else {
+        STORM_LOG_THROW(stateCount == choiceCount, storm::exceptions::WrongFormatException,
+                        "Invalid number of choices in the binary model file " << filename << ".");
+    }
+    components.transitionMatrix = reader.readMatrix<ValueType>(choiceCount, stateCount, std::move(rowGroupIndices));
+    STORM_LOG_THROW(components.transitionMatrix.getEntryCount() == entryCount, storm::exceptions::WrongFormatException,
+                    "Invalid number of transitions in the binary model file " << filename << ".");
+    components.rateTransitions = type == storm::models::ModelType::Ctmc;
+
+    // Labelings
+    components.stateLabeling = storm::models::sparse::StateLabeling(stateCount);
+    reader.readLabeling(components.stateLabeling, stateCount);
+    if (reader.readNumber() != 0) {
+        components.choiceLabeling = storm::models::sparse::ChoiceLabeling(choiceCount);
+        reader.readLabeling(components.choiceLabeling.value(), choiceCount);
+    }
+
+    // Reward models
+    for (uint64_t rewardModel = 0, rewardModelCount = reader.readNumber(); rewardModel < rewardModelCount; ++rewardModel) {
+        std::string name = reader.readString();
+        std::optional<std::vector<ValueType>> stateRewards, stateActionRewards;
+        std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+        if (reader.readNumber() != 0) {
+            stateRewards = reader.readSection<ValueType>(stateCount);
+        }
+        if (reader.readNumber() != 0) {
+            stateActionRewards = reader.readSection<ValueType>(choiceCount);
+        }
+        if (reader.readNumber() != 0) {
+            boost::optional<std::vector<uint64_t>> rewardRowGroupIndices;
+            if (!components.transitionMatrix.hasTrivialRowGrouping()) {
+                rewardRowGroupIndices = components.transitionMatrix.getRowGroupIndices();
+            }
+            transitionRewards = reader.readMatrix<ValueType>(choiceCount, stateCount, std::move(rewardRowGroupIndices));
+        }
+        components.rewardModels.emplace(name, RewardModelType(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+    }
+
+    // Model type specific components
+    if (type == storm::models::ModelType::MarkovAutomaton) {
+        components.exitRates = reader.readSection<ValueType>(stateCount);
+        components.markovianStates = reader.readBitVector(stateCount);
+    } else if (type == storm::models::ModelType::Pomdp) {
+        components.observabilityClasses = reader.readSection<uint32_t>(stateCount);
+    }
+    STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of the binary model file " << filename << ".");
+
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+// Template instantiations.
+template class BinaryEncodingParser<double>;
+
+}  // namespace parser
+}  // namespace storm
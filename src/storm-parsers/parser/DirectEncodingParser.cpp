@@ -2,9 +2,13 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <iostream>
 #include <regex>
 #include <string>
+#include <thread>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -18,6 +22,7 @@
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 
+#include "storm-parsers/parser/MappedFile.h"
 #include "storm/io/file.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -118,7 +123,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
             // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            modelComponents = parseStates(file, filename, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
@@ -131,24 +136,112 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
 }
 
+/*!
+ * The result of parsing a contiguous range of states. States and rows are indexed relative to the first state and row
+ * of the chunk.
+ */
+template<typename ValueType, typename RewardModelType>
+struct DirectEncodingParser<ValueType, RewardModelType>::StateChunk {
+    explicit StateChunk(bool nonDeterministic) : builder(0, 0, 0, false, nonDeterministic, 0) {
+        // Intentionally left empty.
+    }
+
+    // The (global) index of the first state of the chunk.
+    uint64_t firstState = 0;
+    uint64_t stateCount = 0;
+    uint64_t rowCount = 0;
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    std::unordered_map<std::string, std::vector<uint64_t>> stateLabels;
+    std::unordered_map<std::string, std::vector<uint64_t>> choiceLabels;
+    std::vector<ValueType> exitRates;
+    std::vector<uint32_t> observations;
+    // Reward vectors are empty if they contain no non-zero reward.
+    std::vector<std::vector<ValueType>> stateRewards;
+    std::vector<std::vector<ValueType>> actionRewards;
+};
+
+namespace {
+/*!
+ * A stream buffer that reads from a range of memory.
+ */
+class MemoryStreamBuffer : public std::streambuf {
+   public:
+    MemoryStreamBuffer(char const* begin, char const* end) {
+        char* data = const_cast<char*>(begin);
+        this->setg(data, data, data + (end - begin));
+    }
+};
+
+/*!
+ * Returns the beginning of the first line after the given position that declares a state (or the given end).
+ */
+char const* findNextStateLine(char const* position, char const* end) {
+    while (position < end) {
+        position = static_cast<char const*>(std::memchr(position, '\n', end - position));
+        if (position == nullptr) {
+            return end;
+        }
+        char const* lineStart = ++position;
+        while (position < end && (*position == ' ' || *position == '\t')) {
+            ++position;
+        }
+        if (end - position >= 6 && std::memcmp(position, "state ", 6) == 0) {
+            return lineStart;
+        }
+    }
+    return end;
+}
+
+/*!
+ * Invokes the given function on all tasks in [0, numberOfTasks) using the given number of threads. If a task throws,
+ * the remaining tasks are skipped and the exception is rethrown.
+ */
+template<typename Function>
+void processConcurrently(uint64_t numberOfThreads, uint64_t numberOfTasks, Function const& function) {
+    std::atomic<uint64_t> nextTask(0);
+    std::vector<std::exception_ptr> exceptions(numberOfThreads);
+    auto worker = [&](uint64_t thread) {
+        try {
+            for (uint64_t task = nextTask++; task < numberOfTasks; task = nextTask++) {
+                function(task);
+            }
+        } catch (...) {
+            exceptions[thread] = std::current_exception();
+            nextTask = numberOfTasks;
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(worker, thread);
+    }
+    worker(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
-    std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-    ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    std::istream& file, std::string const& filename, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
     // Initialize
     auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
     bool nonDeterministic =
         (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
     bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
-    storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
     modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
     modelComponents->observabilityClasses = std::vector<uint32_t>();
     modelComponents->observabilityClasses->resize(stateSize);
     if (options.buildChoiceLabeling) {
         modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
     }
-    std::vector<std::vector<ValueType>> stateRewards;
-    std::vector<std::vector<ValueType>> actionRewards;
     if (continuousTime) {
         modelComponents->exitRates = std::vector<ValueType>(stateSize);
         if (type == storm::models::ModelType::MarkovAutomaton) {
@@ -160,11 +253,181 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         modelComponents->rateTransitions = true;
     }
 
+    // Parse the states. Rational functions are parsed sequentially, as their parser is not thread-safe.
+    uint64_t numberOfThreads = options.numberOfThreads == 0 ? std::max<uint64_t>(1, std::thread::hardware_concurrency()) : options.numberOfThreads;
+    bool const parametric = std::is_same<ValueType, storm::RationalFunction>::value;
+    STORM_LOG_INFO_COND(numberOfThreads == 1 || !parametric, "Parametric models in DRN format are parsed sequentially.");
+    std::vector<StateChunk> chunks;
+    if (numberOfThreads > 1 && !parametric) {
+        // Map the model section into memory and split it at state declarations into chunks that are parsed concurrently.
+        std::streamoff modelStart = file.tellg();
+        STORM_LOG_THROW(modelStart >= 0, storm::exceptions::FileIoException, "Unable to determine the position of the model in file " << filename << ".");
+        storm::parser::MappedFile mappedFile(filename.c_str());
+        char const* begin = mappedFile.getData() + modelStart;
+        char const* end = mappedFile.getDataEnd();
+        uint64_t const numberOfChunks = numberOfThreads * 4;
+        std::vector<char const*> boundaries = {begin};
+        for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+            char const* boundary = findNextStateLine(std::max(begin + (end - begin) * chunk / numberOfChunks, boundaries.back()), end);
+            if (boundary != boundaries.back() && boundary != end) {
+                boundaries.push_back(boundary);
+            }
+        }
+        boundaries.push_back(end);
+        STORM_LOG_DEBUG("Parsing " << boundaries.size() - 1 << " chunks of states using " << numberOfThreads << " threads.");
+
+        // Determine the line numbers at which the chunks start (for error messages).
+        std::vector<uint64_t> firstLineNumbers(boundaries.size(), 0);
+        processConcurrently(numberOfThreads, boundaries.size() - 1, [&](uint64_t chunk) {
+            firstLineNumbers[chunk + 1] = std::count(boundaries[chunk], boundaries[chunk + 1], '\n');
+        });
+        for (uint64_t chunk = 1; chunk < firstLineNumbers.size(); ++chunk) {
+            firstLineNumbers[chunk] += firstLineNumbers[chunk - 1];
+        }
+
+        chunks.reserve(boundaries.size() - 1);
+        for (uint64_t chunk = 0; chunk + 1 < boundaries.size(); ++chunk) {
+            chunks.emplace_back(nonDeterministic);
+        }
+        processConcurrently(numberOfThreads, chunks.size(), [&](uint64_t chunk) {
+            MemoryStreamBuffer buffer(boundaries[chunk], boundaries[chunk + 1]);
+            std::istream stream(&buffer);
+            parseStateChunk(stream, firstLineNumbers[chunk], type, stateSize, placeholders, valueParser, options, chunks[chunk]);
+        });
+    } else {
+        chunks.emplace_back(nonDeterministic);
+        parseStateChunk(file, 0, type, stateSize, placeholders, valueParser, options, chunks.front());
+    }
+    STORM_LOG_TRACE("Finished parsing");
+
+    // Stitch the chunks together.
+    uint64_t parsedStates = 0;
+    uint64_t rowCount = 0;
+    for (auto const& chunk : chunks) {
+        STORM_LOG_THROW(chunk.stateCount == 0 || chunk.firstState == parsedStates, storm::exceptions::WrongFormatException,
+                        "State ids are not ordered and without gaps. Expected " << parsedStates << " but got " << chunk.firstState << ".");
+        parsedStates += chunk.stateCount;
+        rowCount += chunk.rowCount;
+    }
+    // A model without states still has one (empty) row.
+    rowCount = std::max<uint64_t>(rowCount, 1);
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || rowCount == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (at least " << rowCount << ") does not match number of actions declared (" << nrChoices
+                                                                << ", in @nr_choices).");
+    }
+
+    std::vector<std::vector<ValueType>> stateRewards;
+    std::vector<std::vector<ValueType>> actionRewards;
+    if (chunks.size() == 1) {
+        // Build transition matrix
+        modelComponents->transitionMatrix = chunks.front().builder.build(rowCount, stateSize, nonDeterministic ? stateSize : 0);
+    } else {
+        storm::storage::SparseMatrixBuilder<ValueType> builder(rowCount, stateSize, 0, false, nonDeterministic, nonDeterministic ? stateSize : 0);
+        uint64_t rowOffset = 0;
+        for (auto& chunk : chunks) {
+            storm::storage::SparseMatrix<ValueType> chunkMatrix =
+                chunk.builder.build(chunk.rowCount, stateSize, nonDeterministic ? chunk.stateCount : 0);
+            for (uint64_t state = 0; state < chunk.stateCount; ++state) {
+                if (nonDeterministic) {
+                    builder.newRowGroup(rowOffset + chunkMatrix.getRowGroupIndices()[state]);
+                }
+            }
+            for (uint64_t row = 0; row < chunk.rowCount; ++row) {
+                for (auto const& entry : chunkMatrix.getRow(row)) {
+                    builder.addNextValue(rowOffset + row, entry.getColumn(), entry.getValue());
+                }
+            }
+            rowOffset += chunk.rowCount;
+        }
+        modelComponents->transitionMatrix = builder.build(rowCount, stateSize, nonDeterministic ? stateSize : 0);
+    }
+    STORM_LOG_TRACE("Built matrix");
+
+    uint64_t rowOffset = 0;
+    for (auto& chunk : chunks) {
+        for (auto const& stateLabel : chunk.stateLabels) {
+            if (!modelComponents->stateLabeling.containsLabel(stateLabel.first)) {
+                modelComponents->stateLabeling.addLabel(stateLabel.first);
+            }
+            for (auto const& state : stateLabel.second) {
+                modelComponents->stateLabeling.addLabelToState(stateLabel.first, chunk.firstState + state);
+            }
+        }
+        for (auto const& choiceLabel : chunk.choiceLabels) {
+            if (!modelComponents->choiceLabeling.value().containsLabel(choiceLabel.first)) {
+                modelComponents->choiceLabeling.value().addLabel(choiceLabel.first);
+            }
+            for (auto const& row : choiceLabel.second) {
+                modelComponents->choiceLabeling.value().addLabelToChoice(choiceLabel.first, rowOffset + row);
+            }
+        }
+        for (uint64_t state = 0; state < chunk.exitRates.size(); ++state) {
+            if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(chunk.exitRates[state])) {
+                modelComponents->markovianStates.get().set(chunk.firstState + state);
+            }
+            modelComponents->exitRates.get()[chunk.firstState + state] = std::move(chunk.exitRates[state]);
+        }
+        std::copy(chunk.observations.begin(), chunk.observations.end(), modelComponents->observabilityClasses.value().begin() + chunk.firstState);
+
+        stateRewards.resize(std::max(stateRewards.size(), chunk.stateRewards.size()));
+        for (uint64_t i = 0; i < chunk.stateRewards.size(); ++i) {
+            if (!chunk.stateRewards[i].empty()) {
+                if (stateRewards[i].empty()) {
+                    stateRewards[i].resize(stateSize, storm::utility::zero<ValueType>());
+                }
+                std::move(chunk.stateRewards[i].begin(), chunk.stateRewards[i].end(), stateRewards[i].begin() + chunk.firstState);
+            }
+        }
+        actionRewards.resize(std::max(actionRewards.size(), chunk.actionRewards.size()));
+        for (uint64_t i = 0; i < chunk.actionRewards.size(); ++i) {
+            if (!chunk.actionRewards[i].empty()) {
+                if (actionRewards[i].empty()) {
+                    actionRewards[i].resize(rowCount, storm::utility::zero<ValueType>());
+                }
+                std::move(chunk.actionRewards[i].begin(), chunk.actionRewards[i].end(), actionRewards[i].begin() + rowOffset);
+            }
+        }
+        rowOffset += chunk.rowCount;
+    }
+
+    // Build reward models
+    uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
+    for (uint64_t i = 0; i < numRewardModels; ++i) {
+        std::string rewardModelName;
+        if (rewardModelNames.size() <= i) {
+            rewardModelName = "rew" + std::to_string(i);
+        } else {
+            rewardModelName = rewardModelNames[i];
+        }
+        std::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
+        if (i < stateRewards.size() && !stateRewards[i].empty()) {
+            stateRewardVector = std::move(stateRewards[i]);
+        }
+        if (i < actionRewards.size() && !actionRewards[i].empty()) {
+            actionRewardVector = std::move(actionRewards[i]);
+        }
+        modelComponents->rewardModels.emplace(
+            rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+    }
+    STORM_LOG_TRACE("Built reward models");
+    return modelComponents;
+}
+
+template<typename ValueType, typename RewardModelType>
+void DirectEncodingParser<ValueType, RewardModelType>::parseStateChunk(std::istream& file, uint64_t firstLineNumber, storm::models::ModelType type,
+                                                                       size_t stateSize, std::unordered_map<std::string, ValueType> const& placeholders,
+                                                                       ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options,
+                                                                       StateChunk& chunk) {
+    bool nonDeterministic =
+        (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+
     // Iterate over all lines
     std::string line;
     size_t row = 0;
     size_t state = 0;
-    uint64_t lineNumber = 0;
+    uint64_t lineNumber = firstLineNumber;
     bool firstState = true;
     bool firstActionForState = true;
     while (storm::utility::getline(file, line)) {
@@ -186,8 +449,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 ++row;
             }
             firstActionForState = true;
-            STORM_LOG_TRACE("New state " << state);
-            STORM_LOG_THROW(state <= stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+            STORM_LOG_TRACE("New state " << chunk.firstState + state);
 
             // Parse state id
             line = line.substr(6);  // Remove "state "
@@ -200,13 +462,16 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 line = "";
             }
             size_t parsedId = parseNumber<size_t>(curString);
-            STORM_LOG_THROW(state == parsedId, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state << " but got " << parsedId << ".");
+            if (state == 0) {
+                chunk.firstState = parsedId;
+            }
+            STORM_LOG_THROW(chunk.firstState + state == parsedId, storm::exceptions::WrongFormatException,
+                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << chunk.firstState + state << " but got "
+                                       << parsedId << ".");
+            STORM_LOG_THROW(parsedId < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
             if (nonDeterministic) {
                 STORM_LOG_TRACE("new Row Group starts at " << row << ".");
-                builder.newRowGroup(row);
-                STORM_LOG_THROW(nrChoices == 0 || builder.getCurrentRowGroupCount() <= nrChoices, storm::exceptions::WrongFormatException,
-                                "More actions detected than declared (in @nr_choices).");
+                chunk.builder.newRowGroup(row);
             }
 
             if (continuousTime) {
@@ -222,11 +487,8 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                     line = "";
                 }
                 ValueType exitRate = parseValue(curString, placeholders, valueParser);
-                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                    modelComponents->markovianStates.get().set(state);
-                }
                 STORM_LOG_TRACE("Exit rate " << exitRate);
-                modelComponents->exitRates.get()[state] = exitRate;
+                chunk.exitRates.push_back(std::move(exitRate));
             }
 
             if (boost::starts_with(line, "[")) {
@@ -237,15 +499,15 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 STORM_LOG_TRACE("State rewards: " << rewardsStr);
                 std::vector<std::string> rewards;
                 boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (stateRewards.size() < rewards.size()) {
-                    stateRewards.resize(rewards.size());
+                if (chunk.stateRewards.size() < rewards.size()) {
+                    chunk.stateRewards.resize(rewards.size());
                 }
-                auto stateRewardsIt = stateRewards.begin();
+                auto stateRewardsIt = chunk.stateRewards.begin();
                 for (auto const& rew : rewards) {
                     auto rewardValue = parseValue(rew, placeholders, valueParser);
                     if (!storm::utility::isZero(rewardValue)) {
-                        if (stateRewardsIt->empty()) {
-                            stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
+                        if (stateRewardsIt->size() <= state) {
+                            stateRewardsIt->resize(state + 1, storm::utility::zero<ValueType>());
                         }
                         (*stateRewardsIt)[state] = std::move(rewardValue);
                     }
@@ -259,10 +521,12 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                     size_t posEndObservation = line.find("}");
                     std::string observation = line.substr(1, posEndObservation - 1);
                     STORM_LOG_TRACE("State observation " << observation);
-                    modelComponents->observabilityClasses.value()[state] = std::stoi(observation);
+                    chunk.observations.resize(state + 1);
+                    chunk.observations[state] = std::stoi(observation);
                     line = line.substr(posEndObservation + 1);
                 } else {
-                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << " in line " << lineNumber);
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                                    "Expected an observation for state " << chunk.firstState + state << " in line " << lineNumber);
                 }
             }
 
@@ -294,15 +558,13 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 }
 
                 for (std::string const& label : labels) {
-                    if (!modelComponents->stateLabeling.containsLabel(label)) {
-                        modelComponents->stateLabeling.addLabel(label);
-                    }
-                    modelComponents->stateLabeling.addLabelToState(label, state);
+                    chunk.stateLabels[label].push_back(state);
                     STORM_LOG_TRACE("New label: '" << label << "'");
                 }
             }
         } else if (boost::starts_with(line, "action ")) {
             // New action
+            STORM_LOG_THROW(!firstState, storm::exceptions::WrongFormatException, "In line " << lineNumber << " an action is declared before any state.");
             if (firstActionForState) {
                 firstActionForState = false;
             } else {
@@ -322,10 +584,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             // curString contains action name.
             if (options.buildChoiceLabeling) {
                 if (curString != "__NOLABEL__") {
-                    if (!modelComponents->choiceLabeling.value().containsLabel(curString)) {
-                        modelComponents->choiceLabeling.value().addLabel(curString);
-                    }
-                    modelComponents->choiceLabeling.value().addLabelToChoice(curString, row);
+                    chunk.choiceLabels[curString].push_back(row);
                 }
             }
             // Check for rewards
@@ -337,15 +596,15 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 STORM_LOG_TRACE("Action rewards: " << rewardsStr);
                 std::vector<std::string> rewards;
                 boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (actionRewards.size() < rewards.size()) {
-                    actionRewards.resize(rewards.size());
+                if (chunk.actionRewards.size() < rewards.size()) {
+                    chunk.actionRewards.resize(rewards.size());
                 }
-                auto actionRewardsIt = actionRewards.begin();
+                auto actionRewardsIt = chunk.actionRewards.begin();
                 for (auto const& rew : rewards) {
                     auto rewardValue = parseValue(rew, placeholders, valueParser);
                     if (!storm::utility::isZero(rewardValue)) {
                         if (actionRewardsIt->size() <= row) {
-                            actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
+                            actionRewardsIt->resize(row + 1, storm::utility::zero<ValueType>());
                         }
                         (*actionRewardsIt)[row] = std::move(rewardValue);
                     }
@@ -356,6 +615,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
 
         } else {
             // New transition
+            STORM_LOG_THROW(!firstState, storm::exceptions::WrongFormatException, "In line " << lineNumber << " a transition is declared before any state.");
             size_t posColon = line.find(':');
             STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException,
                             "':' not found in '" << line << "' on line " << lineNumber << ".");
@@ -365,50 +625,32 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
             STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
                             "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
-            builder.addNextValue(row, target, value);
+            chunk.builder.addNextValue(row, target, value);
         }
 
         if (storm::utility::resources::isTerminate()) {
-            std::cout << "Parsed " << state << "/" << stateSize << " states before abort.\n";
+            std::cout << "Parsed " << chunk.firstState + state << "/" << stateSize << " states before abort.\n";
             STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
             break;
         }
 
     }  // end state iteration
-    STORM_LOG_TRACE("Finished parsing");
 
-    if (nonDeterministic) {
-        STORM_LOG_THROW(nrChoices == 0 || builder.getLastRow() + 1 == nrChoices, storm::exceptions::WrongFormatException,
-                        "Number of actions detected (at least " << builder.getLastRow() + 1 << ") does not match number of actions declared (" << nrChoices
-                                                                << ", in @nr_choices).");
+    if (!firstState) {
+        chunk.stateCount = state + 1;
+        chunk.rowCount = row + 1;
     }
-
-    // Build transition matrix
-    modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
-    STORM_LOG_TRACE("Built matrix");
-
-    // Build reward models
-    uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
-    for (uint64_t i = 0; i < numRewardModels; ++i) {
-        std::string rewardModelName;
-        if (rewardModelNames.size() <= i) {
-            rewardModelName = "rew" + std::to_string(i);
-        } else {
-            rewardModelName = rewardModelNames[i];
-        }
-        std::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
-        if (i < stateRewards.size() && !stateRewards[i].empty()) {
-            stateRewardVector = std::move(stateRewards[i]);
+    // Pad the reward vectors of this chunk (if they are non-empty).
+    for (auto& rewards : chunk.stateRewards) {
+        if (!rewards.empty()) {
+            rewards.resize(chunk.stateCount, storm::utility::zero<ValueType>());
         }
-        if (i < actionRewards.size() && !actionRewards[i].empty()) {
-            actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
-            actionRewardVector = std::move(actionRewards[i]);
+    }
+    for (auto& rewards : chunk.actionRewards) {
+        if (!rewards.empty()) {
+            rewards.resize(chunk.rowCount, storm::utility::zero<ValueType>());
         }
-        modelComponents->rewardModels.emplace(
-            rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
     }
-    STORM_LOG_TRACE("Built reward models");
-    return modelComponents;
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -11,6 +11,8 @@ namespace parser {
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    // The number of threads used to parse the states (0 means that the number of threads is detected automatically).
+    uint64_t numberOfThreads = 1;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -29,21 +31,44 @@ class DirectEncodingParser {
         std::string const& fil, DirectEncodingParserOptions const& options = DirectEncodingParserOptions());
 
    private:
+    struct StateChunk;
+
     /*!
-     * Parse states and return transition matrix.
+     * Parse states and return transition matrix. If multiple threads are requested, the model section of the file is
+     * split into chunks of states that are parsed concurrently.
      *
-     * @param file Input file stream.
+     * @param file Input file stream (positioned after the @model line).
+     * @param filename Name of the input file.
      * @param type Model type.
      * @param stateSize No. of states
+     * @param nrChoices No. of choices (or 0 if unknown).
      * @param placeholders Placeholders for values.
      * @param valueParser Value parser.
      * @param rewardModelNames Names of reward models.
+     * @param options Parser options.
      *
      * @return Transition matrix.
      */
     static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStates(
-        std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+        std::istream& file, std::string const& filename, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
+    /*!
+     * Parse a contiguous range of states.
+     *
+     * @param file Input stream containing the states.
+     * @param firstLineNumber The number of lines in the file before the given stream (for error messages).
+     * @param type Model type.
+     * @param stateSize No. of states
+     * @param placeholders Placeholders for values.
+     * @param valueParser Value parser.
+     * @param options Parser options.
+     * @param chunk The chunk in which the parsed states are stored.
+     */
+    static void parseStateChunk(std::istream& file, uint64_t firstLineNumber, storm::models::ModelType type, size_t stateSize,
+                                std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+                                DirectEncodingParserOptions const& options, StateChunk& chunk);
 
     /*!
      * Parse value from string while using placeholders.
@@ -28,6 +28,7 @@ namespace storm {
             const std::string observationThresholdOption = "obs-threshold";
             const std::string numericPrecisionOption = "numeric-precision";
             const std::string triangulationModeOption = "triangulationmode";
+            const std::string quantizeBeliefsOption = "quantize-beliefs";
 
             BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleName) {
                 
@@ -50,6 +51,8 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, triangulationModeOption, false,"Sets how to triangulate beliefs when discretizing.").setIsAdvanced().addArgument(
                         storm::settings::ArgumentBuilder::createStringArgument("value","the triangulation mode").setDefaultValueString("dynamic").addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"dynamic", "static"})).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, quantizeBeliefsOption, false,"If set, belief probabilities are rounded to multiples of the numeric precision before beliefs are stored. This merges beliefs that only differ due to numerical inaccuracies and saves memory. Has no effect if the numeric precision is zero.").setIsAdvanced().build());
             }
 
             bool BeliefExplorationSettings::isRefineSet() const {
@@ -133,6 +136,10 @@ namespace storm {
                 return this->getOption(triangulationModeOption).getArgumentByName("value").getValueAsString() == "static";
             }
             
+            bool BeliefExplorationSettings::isQuantizeBeliefsSet() const {
+                return this->getOption(quantizeBeliefsOption).getHasOptionBeenSet();
+            }
+            
             template<typename ValueType>
             void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const {
                 options.refine = isRefineSet();
@@ -168,6 +175,7 @@ namespace storm {
                     }
                 }
                 options.dynamicTriangulation = isDynamicTriangulationModeSet();
+                options.quantizeBeliefs = isQuantizeBeliefsSet();
             }
             
             template void BeliefExplorationSettings::setValuesInOptionsStruct<double>(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double>& options) const;
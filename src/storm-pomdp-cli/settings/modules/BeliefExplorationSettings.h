@@ -60,6 +60,9 @@ namespace storm {
                 
                 bool isDynamicTriangulationModeSet() const;
                 bool isStaticTriangulationModeSet() const;
+                
+                /// Whether belief probabilities are rounded to multiples of the numeric precision before beliefs are stored
+                bool isQuantizeBeliefsSet() const;
     
                 template<typename ValueType>
                 void setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const;
@@ -39,6 +39,7 @@ namespace storm {
                 
                 ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal
                 bool dynamicTriangulation = true; // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+                bool quantizeBeliefs = false; // Sets whether belief probabilities are rounded to multiples of the numeric precision before beliefs are stored (saves memory by merging almost equal beliefs)
             };
         }
     }
@@ -29,21 +29,9 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
-            std::size_t seed = 0;
-            // Assumes that beliefs are ordered
-            for (auto const &entry : belief) {
-                boost::hash_combine(seed, entry.first);
-                boost::hash_combine(seed, entry.second);
-            }
-            return seed;
-        }
-
-        template<typename PomdpType, typename BeliefValueType, typename StateType>
-        BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
-                : pomdp(pomdp), triangulationMode(triangulationMode) {
+        BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode, bool quantizeBeliefs)
+                : pomdp(pomdp), beliefs((quantizeBeliefs && !storm::utility::isZero(precision)) ? boost::optional<BeliefValueType>(precision) : boost::none), triangulationMode(triangulationMode) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
-            beliefToIdMap.resize(pomdp.getNrObservations());
             initialBeliefId = computeInitialBelief();
         }
 
@@ -64,7 +52,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::noId() const {
-            return std::numeric_limits<BeliefId>::max();
+            return BeliefStorage<StateType, BeliefValueType>::noId();
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -92,7 +80,7 @@ namespace storm {
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType
         BeliefManager<PomdpType, BeliefValueType, StateType>::getWeightedSum(BeliefId const &beliefId, std::vector<ValueType> const &summands) {
             ValueType result = storm::utility::zero<ValueType>();
-            for (auto const &entry : getBelief(beliefId)) {
+            for (auto const &entry : getBeliefEntries(beliefId)) {
                 result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(summands.at(entry.first));
             }
             return result;
@@ -106,7 +94,7 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType
         BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefActionReward(BeliefId const &beliefId, uint64_t const &localActionIndex) const {
-            auto const &belief = getBelief(beliefId);
+            auto belief = getBeliefEntries(beliefId);
             STORM_LOG_ASSERT(!pomdpActionRewardVector.empty(), "Requested a reward although no reward model was specified.");
             auto result = storm::utility::zero<ValueType>();
             auto const &choiceIndices = pomdp.getTransitionMatrix().getRowGroupIndices();
@@ -121,12 +109,14 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefId beliefId) {
-            return getBeliefObservation(getBelief(beliefId));
+            auto belief = getBeliefEntries(beliefId);
+            STORM_LOG_ASSERT(belief.size() > 0, "Empty belief.");
+            return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefNumberOfChoices(BeliefId beliefId) {
-            auto const &belief = getBelief(beliefId);
+            auto belief = getBeliefEntries(beliefId);
             return pomdp.getNumberOfChoices(belief.begin()->first);
         }
 
@@ -147,8 +137,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId const &beliefId, BeliefSupportType &support) {
-            auto const &belief = getBelief(beliefId);
-            for (auto const &entry : belief) {
+            for (auto const &entry : getBeliefEntries(beliefId)) {
                 support.insert(entry.first);
             }
         }
@@ -172,19 +161,24 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+            auto entries = getBeliefEntries(id);
+            return BeliefType(boost::container::ordered_unique_range, entries.begin(), entries.end());
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefStorage<StateType, BeliefValueType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefEntries(BeliefId const &id) const {
             STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
             STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+            return beliefs.get(id);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+            STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+            BeliefId id = beliefs.find(belief);
+            STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+            return id;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -288,7 +282,7 @@ namespace storm {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
                 weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
+                auto gridPoint = getBeliefEntries(triangulation.gridPoints[i]);
                 for (auto const &pointEntry : gridPoint) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
                     triangulatedValue += triangulation.weights[i] * pointEntry.second;
@@ -499,15 +493,8 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
-            }
-            // Return the id
-            return insertioRes.first->second;
+            STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+            return beliefs.getOrAdd(belief).first;
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
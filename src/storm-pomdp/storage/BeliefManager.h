@@ -1,11 +1,11 @@
 #pragma once
 
 #include <vector>
-#include <unordered_map>
 #include <boost/optional.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 
+#include "storm-pomdp/storage/BeliefStorage.h"
 #include "storm/utility/ConstantsComparator.h"
 
 namespace storm {
@@ -17,14 +17,18 @@ namespace storm {
             typedef typename PomdpType::ValueType ValueType;
             typedef boost::container::flat_map<StateType, BeliefValueType> BeliefType; // iterating over this shall be ordered (for correct hash computation)
             typedef boost::container::flat_set<StateType> BeliefSupportType;
-            typedef uint64_t BeliefId;
+            typedef typename BeliefStorage<StateType, BeliefValueType>::BeliefId BeliefId;
 
             enum class TriangulationMode {
                 Static,
                 Dynamic
             };
 
-            BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode);
+            /*!
+             * @param quantizeBeliefs If set, belief values are rounded to multiples of the given precision before beliefs are stored.
+             * This merges beliefs that only differ due to numerical inaccuracies. Ignored if the precision is zero.
+             */
+            BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode, bool quantizeBeliefs = false);
 
             void setRewardModel(boost::optional<std::string> rewardModelName = boost::none);
 
@@ -71,10 +75,6 @@ namespace storm {
 
         private:
 
-            struct BeliefHash {
-                std::size_t operator()(const BeliefType &belief) const;
-            };
-
             struct FreudenthalDiff {
                 FreudenthalDiff(StateType const &dimension, BeliefValueType diff);
 
@@ -83,7 +83,16 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            /*!
+             * Retrieves a copy of the belief with the given id.
+             */
+            BeliefType getBelief(BeliefId const &id) const;
+
+            /*!
+             * Retrieves the entries of the belief with the given id without copying them.
+             * @note The returned view becomes invalid as soon as a new belief is added.
+             */
+            typename BeliefStorage<StateType, BeliefValueType>::BeliefView getBeliefEntries(BeliefId const &id) const;
 
             BeliefId getId(BeliefType const &belief) const;
 
@@ -113,8 +122,7 @@ namespace storm {
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
             
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+            BeliefStorage<StateType, BeliefValueType> beliefs;
             BeliefId initialBeliefId;
             
             storm::utility::ConstantsComparator<ValueType> cc;
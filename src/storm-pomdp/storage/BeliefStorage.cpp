@@ -0,0 +1,144 @@
+#include "storm-pomdp/storage/BeliefStorage.h"
+
+#include <algorithm>
+#include <limits>
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        template <typename StateType, typename BeliefValueType>
+        BeliefStorage<StateType, BeliefValueType>::BeliefView::BeliefView(EntryType const* first, EntryType const* last) : first(first), last(last) {
+            // Intentionally left empty
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        typename BeliefStorage<StateType, BeliefValueType>::EntryType const* BeliefStorage<StateType, BeliefValueType>::BeliefView::begin() const {
+            return first;
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        typename BeliefStorage<StateType, BeliefValueType>::EntryType const* BeliefStorage<StateType, BeliefValueType>::BeliefView::end() const {
+            return last;
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        uint64_t BeliefStorage<StateType, BeliefValueType>::BeliefView::size() const {
+            return last - first;
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        BeliefStorage<StateType, BeliefValueType>::BeliefStorage(boost::optional<BeliefValueType> const& quantum) : quantum(quantum), offsets(1, 0), slots(64, noId()) {
+            STORM_LOG_ASSERT(!quantum || storm::utility::zero<BeliefValueType>() < quantum.get(), "The quantum has to be positive.");
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        std::pair<typename BeliefStorage<StateType, BeliefValueType>::BeliefId, bool> BeliefStorage<StateType, BeliefValueType>::getOrAdd(BeliefType const& belief) {
+            std::size_t hash = prepareCandidate(belief, candidateBuffer);
+            uint64_t slot = findSlot(hash, candidateBuffer);
+            if (slots[slot] != noId()) {
+                return {slots[slot], false};
+            }
+
+            BeliefId id = size();
+            entries.insert(entries.end(), candidateBuffer.begin(), candidateBuffer.end());
+            offsets.push_back(entries.size());
+            hashes.push_back(hash);
+            slots[slot] = id;
+            // Keep the load factor of the hash table below 1/2
+            if (2 * size() > slots.size()) {
+                grow();
+            }
+            return {id, true};
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        typename BeliefStorage<StateType, BeliefValueType>::BeliefId BeliefStorage<StateType, BeliefValueType>::find(BeliefType const& belief) const {
+            std::size_t hash = prepareCandidate(belief, candidateBuffer);
+            return slots[findSlot(hash, candidateBuffer)];
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        typename BeliefStorage<StateType, BeliefValueType>::BeliefView BeliefStorage<StateType, BeliefValueType>::get(BeliefId const& id) const {
+            STORM_LOG_ASSERT(id < size(), "Belief index " << id << " is out of range.");
+            return BeliefView(entries.data() + offsets[id], entries.data() + offsets[id + 1]);
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        uint64_t BeliefStorage<StateType, BeliefValueType>::size() const {
+            return hashes.size();
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        typename BeliefStorage<StateType, BeliefValueType>::BeliefId BeliefStorage<StateType, BeliefValueType>::noId() {
+            return std::numeric_limits<BeliefId>::max();
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        std::size_t BeliefStorage<StateType, BeliefValueType>::prepareCandidate(BeliefType const& belief, std::vector<EntryType>& candidate) const {
+            candidate.clear();
+            if (quantum) {
+                // Round each value to the closest multiple of the quantum. Entries that become zero are dropped.
+                // The largest entry is set such that the values sum up to one. It only depends on the rounded values, so beliefs that only
+                // differ by numerical noise yield the same candidate.
+                BeliefValueType roundedSum = storm::utility::zero<BeliefValueType>();
+                uint64_t largestEntry = 0;
+                for (auto const& entry : belief) {
+                    BeliefValueType roundedValue = storm::utility::round<BeliefValueType>(entry.second / quantum.get()) * quantum.get();
+                    if (!storm::utility::isZero(roundedValue)) {
+                        if (!candidate.empty() && candidate[largestEntry].second < roundedValue) {
+                            largestEntry = candidate.size();
+                        }
+                        roundedSum += roundedValue;
+                        candidate.emplace_back(entry.first, roundedValue);
+                    }
+                }
+                STORM_LOG_ASSERT(!candidate.empty(), "Quantization yields an empty belief.");
+                candidate[largestEntry].second = storm::utility::one<BeliefValueType>() - (roundedSum - candidate[largestEntry].second);
+            } else {
+                candidate.insert(candidate.end(), belief.begin(), belief.end());
+            }
+
+            std::size_t seed = 0;
+            for (auto const& entry : candidate) {
+                boost::hash_combine(seed, entry.first);
+                boost::hash_combine(seed, entry.second);
+            }
+            return seed;
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        uint64_t BeliefStorage<StateType, BeliefValueType>::findSlot(std::size_t const& hash, std::vector<EntryType> const& candidate) const {
+            uint64_t const mask = slots.size() - 1;
+            for (uint64_t slot = hash & mask; true; slot = (slot + 1) & mask) {
+                BeliefId const& id = slots[slot];
+                if (id == noId()) {
+                    return slot;
+                }
+                if (hashes[id] == hash && offsets[id + 1] - offsets[id] == candidate.size() && std::equal(candidate.begin(), candidate.end(), entries.begin() + offsets[id])) {
+                    return slot;
+                }
+            }
+        }
+
+        template <typename StateType, typename BeliefValueType>
+        void BeliefStorage<StateType, BeliefValueType>::grow() {
+            slots.assign(2 * slots.size(), noId());
+            uint64_t const mask = slots.size() - 1;
+            for (BeliefId id = 0; id < size(); ++id) {
+                uint64_t slot = hashes[id] & mask;
+                while (slots[slot] != noId()) {
+                    slot = (slot + 1) & mask;
+                }
+                slots[slot] = id;
+            }
+        }
+
+        template class BeliefStorage<uint64_t, double>;
+        template class BeliefStorage<uint64_t, storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <boost/optional.hpp>
+#include <boost/container/flat_map.hpp>
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * Stores beliefs in a compact way and assigns a unique id to each of them.
+         * The (state, value) entries of all beliefs are kept in a single array and each belief refers to a contiguous range of this array.
+         * Ids are found via an open addressing hash table that only contains the belief ids. Hence, every belief is stored only once.
+         * Optionally, belief values are rounded to a multiple of a given quantum before they are stored. This way, beliefs that only differ due to
+         * numerical inaccuracies are merged.
+         */
+        template <typename StateType, typename BeliefValueType>
+        class BeliefStorage {
+        public:
+            typedef std::pair<StateType, BeliefValueType> EntryType;
+            typedef boost::container::flat_map<StateType, BeliefValueType> BeliefType;
+            typedef uint64_t BeliefId;
+
+            /*!
+             * A read-only view on the (ordered) entries of a stored belief.
+             * @note Adding a belief to the storage invalidates all views.
+             */
+            class BeliefView {
+            public:
+                BeliefView(EntryType const* first, EntryType const* last);
+                EntryType const* begin() const;
+                EntryType const* end() const;
+                uint64_t size() const;
+
+            private:
+                EntryType const* first;
+                EntryType const* last;
+            };
+
+            /*!
+             * Creates an empty storage.
+             * @param quantum If given, the stored belief values are rounded to multiples of this value.
+             */
+            BeliefStorage(boost::optional<BeliefValueType> const& quantum = boost::none);
+
+            /*!
+             * Retrieves the id of the given belief. If the belief is not contained in the storage, it is inserted.
+             * @return the id and true iff the belief has been inserted.
+             */
+            std::pair<BeliefId, bool> getOrAdd(BeliefType const& belief);
+
+            /*!
+             * Retrieves the id of the given belief or noId() if the belief is not contained in the storage.
+             */
+            BeliefId find(BeliefType const& belief) const;
+
+            /*!
+             * Retrieves the entries of the belief with the given id.
+             */
+            BeliefView get(BeliefId const& id) const;
+
+            /*!
+             * Retrieves the number of stored beliefs.
+             */
+            uint64_t size() const;
+
+            static BeliefId noId();
+
+        private:
+            /*!
+             * Writes the (potentially quantized) entries of the given belief to the candidate buffer and computes their hash.
+             */
+            std::size_t prepareCandidate(BeliefType const& belief, std::vector<EntryType>& candidate) const;
+
+            /*!
+             * Retrieves the slot of the hash table that either holds the id of the given candidate or that is empty.
+             */
+            uint64_t findSlot(std::size_t const& hash, std::vector<EntryType> const& candidate) const;
+
+            /*!
+             * Doubles the size of the hash table.
+             */
+            void grow();
+
+            boost::optional<BeliefValueType> quantum;
+
+            // The entries of belief i are stored in [entries[offsets[i]], entries[offsets[i+1]])
+            std::vector<EntryType> entries;
+            std::vector<uint64_t> offsets;
+            // The precomputed hash of each belief
+            std::vector<std::size_t> hashes;
+            // The hash table with linear probing. Its size is always a power of two.
+            std::vector<BeliefId> slots;
+
+            // Buffer for the belief under consideration to avoid reallocations
+            mutable std::vector<EntryType> candidateBuffer;
+        };
+    }
+}
@@ -10,6 +10,9 @@
 #include "storm/storage/dd/BisimulationDecomposition.h"
 #include "storm/storage/dd/DdType.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
 
@@ -25,6 +28,10 @@ std::shared_ptr<ModelType> performDeterministicSparseBisimulationMinimization(st
         options = typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
     }
     options.setType(type);
+    auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+    options.signatureRefinement =
+        bisimulationSettings.getSparseRefinementMode() == storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
+    options.numberOfThreads = bisimulationSettings.getNumberOfThreads();
 
     storm::storage::DeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
@@ -40,6 +47,10 @@ std::shared_ptr<ModelType> performNondeterministicSparseBisimulationMinimization
         options = typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
     }
     options.setType(type);
+    auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+    options.signatureRefinement =
+        bisimulationSettings.getSparseRefinementMode() == storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
+    options.numberOfThreads = bisimulationSettings.getNumberOfThreads();
 
     storm::storage::NondeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/BinaryEncodingParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 
@@ -164,6 +165,16 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(
     return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRBModel(std::string const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models with binary encoding are not supported.");
+}
+
+template<>
+inline std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitDRBModel(std::string const& drbFile) {
+    return storm::parser::BinaryEncodingParser<double>::parseModel(drbFile);
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const&) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
@@ -3,6 +3,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryEncodingExporter.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/file.h"
@@ -33,6 +34,15 @@ void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueTy
     storm::utility::closeFile(stream);
 }
 
+template<typename ValueType>
+void exportSparseModelAsDrb(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
+    std::ofstream stream(filename, std::ios::binary);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    STORM_PRINT_AND_LOG("Write to file " << filename << ".\n");
+    storm::exporter::binaryExportSparseModel(stream, model);
+    storm::utility::closeFile(stream);
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 void exportSymbolicModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& filename) {
     storm::exporter::explicitExportSymbolicModel(filename, model);
@@ -2,6 +2,7 @@
 
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
+#include "storm/transformer/StatePermuter.h"
 #include "storm/transformer/SymbolicToSparseTransformer.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -146,5 +147,15 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> transformToNondetermini
     }
 }
 
+/*!
+ * Renumbers the states of the given model according to the given order, which may speed up the subsequent analysis.
+ * The properties are preserved, but the state indices of the resulting model differ from the ones of the given model.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> permuteModelStates(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                                            storm::transformer::StatePermutationOrder order) {
+    return storm::transformer::permuteStates(*model, order).model;
+}
+
 }  // namespace api
 }  // namespace storm
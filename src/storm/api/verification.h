@@ -15,15 +15,18 @@
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpAnalysisCache.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
 #include "storm/models/symbolic/Mdp.h"
 
+#include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Smg.h"
@@ -32,6 +35,7 @@
 #include "storm/settings/modules/AbstractionSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/EliminationSettings.h"
+#include "storm/settings/modules/StatisticalSettings.h"
 
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -150,23 +154,20 @@ template<typename ValueType>
 typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithExplorationEngine(
     storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
     storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
-    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException, "Exploration engine is currently only applicable to PRISM models.");
-    storm::prism::Program const& program = model.asPrismProgram();
-
     std::unique_ptr<storm::modelchecker::CheckResult> result;
-    if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
-        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
+    if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model);
         if (checker.canHandle(task)) {
             result = checker.check(env, task);
         }
-    } else if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
-        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<ValueType>> checker(program);
+    } else if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MDP) {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<ValueType>> checker(model);
         if (checker.canHandle(task)) {
             result = checker.check(env, task);
         }
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
-                        "The model type " << program.getModelType() << " is not supported by the exploration engine.");
+                        "The model type " << model.getModelType() << " is not supported by the exploration engine.");
     }
 
     return result;
@@ -185,6 +186,101 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with Statistical engine
+//
+inline storm::modelchecker::statistical::StatisticalModelCheckerOptions getStatisticalModelCheckerOptionsFromSettings() {
+    auto const& statisticalSettings = storm::settings::getModule<storm::settings::modules::StatisticalSettings>();
+    storm::modelchecker::statistical::StatisticalModelCheckerOptions options;
+    options.precision = statisticalSettings.getPrecision();
+    options.errorProbability = statisticalSettings.getErrorProbability();
+    options.numberOfThreads = statisticalSettings.getNumberOfThreads();
+    if (statisticalSettings.isSeedSet()) {
+        options.seed = statisticalSettings.getSeed();
+    }
+    options.maximalPathLength = statisticalSettings.getMaximalPathLength();
+    return options;
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    storm::modelchecker::statistical::StatisticalModelCheckerOptions options = getStatisticalModelCheckerOptionsFromSettings();
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+        storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model, options);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::CTMC) {
+        storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Ctmc<ValueType>> checker(model, options);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The model type " << model.getModelType() << " is not supported by the statistical engine.");
+    }
+
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithStatisticalEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                              storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithStatisticalEngine(env, model, task);
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    storm::modelchecker::statistical::StatisticalModelCheckerOptions options = getStatisticalModelCheckerOptionsFromSettings();
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    if (model->getType() == storm::models::ModelType::Dtmc) {
+        storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(
+            *model->template as<storm::models::sparse::Dtmc<ValueType>>(), options);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else if (model->getType() == storm::models::ModelType::Ctmc) {
+        storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Ctmc<ValueType>> checker(
+            *model->template as<storm::models::sparse::Ctmc<ValueType>>(), options);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The model type " << model->getType() << " is not supported by the statistical engine.");
+    }
+
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const&, std::shared_ptr<storm::models::sparse::Model<ValueType>> const&,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithStatisticalEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                                              storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithStatisticalEngine(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -237,9 +333,11 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
 template<typename ValueType>
 typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type
 verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp,
-                       storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+                       storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+                       std::shared_ptr<storm::modelchecker::helper::SparseMdpAnalysisCache<ValueType>> const& analysisCache = nullptr) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+    modelchecker.setAnalysisCache(analysisCache);
     if (modelchecker.canHandle(task)) {
         result = modelchecker.check(env, task);
     }
@@ -249,7 +347,8 @@ verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::mod
 template<typename ValueType>
 typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type
 verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp,
-                       storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+                       storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+                       std::shared_ptr<storm::modelchecker::helper::SparseMdpAnalysisCache<ValueType>> const& = nullptr) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
     if (modelchecker.canHandle(task)) {
@@ -324,15 +423,38 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
     return verifyWithSparseEngine(env, smg, task);
 }
 
+/*!
+ * Creates a cache that can be passed to verifyWithSparseEngine in order to reuse intermediate results among several properties checked on the given model.
+ *
+ * @return The cache or null if the model is not an MDP or its value type is not supported.
+ */
 template<typename ValueType>
-std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env,
-                                                                         std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
-                                                                         storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value,
+                        std::shared_ptr<storm::modelchecker::helper::SparseMdpAnalysisCache<ValueType>>>::type
+createSparseMdpAnalysisCache(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+    if (model->getType() == storm::models::ModelType::Mdp) {
+        return std::make_shared<storm::modelchecker::helper::SparseMdpAnalysisCache<ValueType>>(model->getTransitionMatrix());
+    }
+    return nullptr;
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value,
+                        std::shared_ptr<storm::modelchecker::helper::SparseMdpAnalysisCache<ValueType>>>::type
+createSparseMdpAnalysisCache(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&) {
+    return nullptr;
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+    std::shared_ptr<storm::modelchecker::helper::SparseMdpAnalysisCache<ValueType>> const& mdpAnalysisCache = nullptr) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     if (model->getType() == storm::models::ModelType::Dtmc) {
         result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Dtmc<ValueType>>(), task);
     } else if (model->getType() == storm::models::ModelType::Mdp) {
-        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task);
+        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task, mdpAnalysisCache);
     } else if (model->getType() == storm::models::ModelType::Ctmc) {
         result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task);
     } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
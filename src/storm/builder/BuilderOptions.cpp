@@ -52,7 +52,10 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       addOutOfBoundsState(false),
       reservedBitsForUnboundedVariables(32),
       showProgress(false),
-      showProgressDelay(0) {
+      showProgressDelay(0),
+      jitCompilation(false),
+      jitCompiler("c++"),
+      bytecodeEvaluation(false) {
     // Intentionally left empty.
 }
 
@@ -189,6 +192,18 @@ bool BuilderOptions::isAddOverlappingGuardLabelSet() const {
     return addOverlappingGuardsLabel;
 }
 
+bool BuilderOptions::isJitCompilationSet() const {
+    return jitCompilation;
+}
+
+std::string const& BuilderOptions::getJitCompiler() const {
+    return jitCompiler;
+}
+
+bool BuilderOptions::isBytecodeEvaluationSet() const {
+    return bytecodeEvaluation;
+}
+
 BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
     buildAllRewardModels = newValue;
     return *this;
@@ -285,6 +300,17 @@ BuilderOptions& BuilderOptions::setReservedBitsForUnboundedVariables(uint64_t ne
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setJitCompilation(bool newValue, std::string const& compiler) {
+    jitCompilation = newValue;
+    jitCompiler = compiler;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setBytecodeEvaluation(bool newValue) {
+    bytecodeEvaluation = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::setAddOverlappingGuardsLabel(bool newValue) {
     addOverlappingGuardsLabel = newValue;
     return *this;
@@ -121,6 +121,9 @@ class BuilderOptions {
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
     uint64_t getShowProgressDelay() const;
+    bool isJitCompilationSet() const;
+    std::string const& getJitCompiler() const;
+    bool isBytecodeEvaluationSet() const;
 
     /**
      * Should all reward models be built? If not set, only required reward models are build.
@@ -211,6 +214,22 @@ class BuilderOptions {
      */
     BuilderOptions& setReservedBitsForUnboundedVariables(uint64_t value);
 
+    /**
+     * Should the guards and updates be compiled to native code (if supported)?
+     * @param newValue The new value (default true)
+     * @param compiler The command used to invoke the C++ compiler.
+     * @return this
+     */
+    BuilderOptions& setJitCompilation(bool newValue = true, std::string const& compiler = "c++");
+
+    /**
+     * Should the guards and updates be compiled to bytecode (if supported)? This is used if jit compilation is not set
+     * or fails.
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setBytecodeEvaluation(bool newValue = true);
+
     /**
      * Substitutes all expressions occurring in these options.
      */
@@ -276,6 +295,15 @@ class BuilderOptions {
 
     /// The delay for printing progress information.
     uint64_t showProgressDelay;
+
+    /// A flag that stores whether the guards and updates are to be compiled to native code.
+    bool jitCompilation;
+
+    /// The command used to invoke the C++ compiler.
+    std::string jitCompiler;
+
+    /// A flag that stores whether the guards and updates are to be compiled to bytecode.
+    bool bytecodeEvaluation;
 };
 
 }  // namespace builder
@@ -1,6 +1,11 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <map>
+#include <thread>
+#include <unordered_map>
 
 #include "storm/adapters/RationalNumberAdapter.h"
 
@@ -55,8 +60,11 @@ uint64_t ExplicitStateLookup<StateType>::size() const {
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
-    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-    // Intentionally left empty.
+    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()),
+      numberOfThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfExplorationThreads()) {
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -71,7 +79,11 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    if (options.numberOfThreads > 1) {
+        generatorFactory = [program, generatorOptions]() {
+            return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions);
+        };
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -79,7 +91,11 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    if (options.numberOfThreads > 1) {
+        generatorFactory = [model, generatorOptions]() {
+            return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions);
+        };
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -136,6 +152,192 @@ ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType,
     return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(
+    CompressedState const& state, StateType const& stateIndex, StateBehavior<ValueType, StateType> const& behavior,
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup,
+    std::function<StateType(StateType const&)> const& columnTranslation) {
+    // If there is no behavior, we might have to introduce a self-loop.
+    if (behavior.empty()) {
+        if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+            // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+            if (behavior.wasExpanded()) {
+                this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+            }
+
+            if (!generator->isDeterministicModel()) {
+                transitionMatrixBuilder.newRowGroup(currentRow);
+            }
+
+            transitionMatrixBuilder.addNextValue(currentRow, stateIndex, storm::utility::one<ValueType>());
+
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                }
+
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                }
+            }
+
+            // This state shall be Markovian (to not introduce Zeno behavior)
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+            // Other state-based information does not need to be treated, in particular:
+            // * StateValuations have already been set above
+            // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+            ++currentRow;
+            ++currentRowGroup;
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+        }
+    } else {
+        // Add the state rewards to the corresponding reward models.
+        auto stateRewardIt = behavior.getStateRewards().begin();
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(*stateRewardIt);
+            }
+            ++stateRewardIt;
+        }
+
+        // If the model is nondeterministic, we need to open a row group.
+        if (!generator->isDeterministicModel()) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
+
+        // Now add all choices.
+        bool firstChoiceOfState = true;
+        std::vector<std::pair<StateType, ValueType>> translatedEntries;
+        for (auto const& choice : behavior) {
+            // add the generated choice information
+            if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                for (auto const& label : choice.getLabels()) {
+                    stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                STORM_LOG_ASSERT(
+                    firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
+                    "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+                if (firstChoiceOfState) {
+                    stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+
+            // Add the probabilistic behavior to the matrix.
+            if (columnTranslation) {
+                // The translation does not preserve the order of the columns, so we need to sort the entries again.
+                translatedEntries.clear();
+                for (auto const& stateProbabilityPair : choice) {
+                    translatedEntries.emplace_back(columnTranslation(stateProbabilityPair.first), stateProbabilityPair.second);
+                }
+                std::sort(translatedEntries.begin(), translatedEntries.end(),
+                          [](std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                for (auto const& stateProbabilityPair : translatedEntries) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            } else {
+                for (auto const& stateProbabilityPair : choice) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            }
+
+            // Add the rewards to the reward models.
+            auto choiceRewardIt = choice.getRewards().begin();
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                }
+                ++choiceRewardIt;
+            }
+            ++currentRow;
+            firstChoiceOfState = false;
+        }
+
+        ++currentRowGroup;
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::expandStatesInParallel(std::vector<std::pair<CompressedState, StateType>> const& states,
+                                                                                         std::vector<StateBehavior<ValueType, StateType>>& behaviors,
+                                                                                         std::vector<std::vector<CompressedState>>& newSuccessors) {
+    behaviors.clear();
+    behaviors.resize(states.size());
+    newSuccessors.clear();
+    newSuccessors.resize(states.size());
+
+    // The state storage is not modified while the states are expanded, so all threads may safely query it.
+    StateType const firstTemporaryIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
+    uint64_t const numberOfWorkers = workerGenerators.size() + 1;
+    uint64_t const blockSize = 64;
+    std::atomic<uint64_t> nextBlockStart(0);
+    std::vector<std::exception_ptr> exceptions(numberOfWorkers);
+
+    auto expandBlocks = [&](uint64_t worker) {
+        try {
+            storm::generator::NextStateGenerator<ValueType, StateType>& workerGenerator = worker == 0 ? *generator : *workerGenerators[worker - 1];
+
+            // Successors that are not yet known receive temporary indices that are unique per expanded state.
+            std::unordered_map<storm::storage::BitVector, StateType> temporaryIndices;
+            std::vector<CompressedState>* currentSuccessors = nullptr;
+            std::function<StateType(CompressedState const&)> stateToIdCallback = [&](CompressedState const& successor) -> StateType {
+                std::pair<bool, StateType> foundAndIndex = stateStorage.stateToId.findValue(successor);
+                if (foundAndIndex.first) {
+                    return foundAndIndex.second;
+                }
+                auto insertionResult = temporaryIndices.emplace(successor, firstTemporaryIndex + static_cast<StateType>(currentSuccessors->size()));
+                if (insertionResult.second) {
+                    currentSuccessors->push_back(successor);
+                }
+                return insertionResult.first->second;
+            };
+
+            for (uint64_t blockStart = nextBlockStart.fetch_add(blockSize); blockStart < states.size(); blockStart = nextBlockStart.fetch_add(blockSize)) {
+                uint64_t blockEnd = std::min<uint64_t>(blockStart + blockSize, states.size());
+                for (uint64_t stateIndex = blockStart; stateIndex < blockEnd; ++stateIndex) {
+                    temporaryIndices.clear();
+                    currentSuccessors = &newSuccessors[stateIndex];
+                    workerGenerator.load(states[stateIndex].first);
+                    behaviors[stateIndex] = workerGenerator.expand(stateToIdCallback);
+                }
+            }
+        } catch (...) {
+            exceptions[worker] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfWorkers - 1);
+    for (uint64_t worker = 1; worker < numberOfWorkers; ++worker) {
+        threads.emplace_back(expandBlocks, worker);
+    }
+    expandBlocks(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
@@ -157,6 +359,27 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         stateRemapping = std::vector<uint_fast64_t>();
     }
 
+    // Determine whether we can expand the states in parallel.
+    bool parallelExploration = false;
+    if (options.numberOfThreads > 1) {
+        if (options.explorationOrder != ExplorationOrder::Bfs) {
+            STORM_LOG_WARN("Parallel state-space exploration requires the breadth-first exploration order. Falling back to sequential exploration.");
+        } else if (!generatorFactory) {
+            STORM_LOG_WARN("Parallel state-space exploration is only supported when building from a PRISM program or JANI model. Falling back to "
+                           "sequential exploration.");
+        } else if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+            STORM_LOG_WARN("Parallel state-space exploration does not support labeling states with overlapping guards. Falling back to sequential "
+                           "exploration.");
+        } else {
+            parallelExploration = true;
+            workerGenerators.clear();
+            for (uint64_t thread = 1; thread < options.numberOfThreads; ++thread) {
+                workerGenerators.push_back(generatorFactory());
+            }
+            STORM_LOG_DEBUG("Exploring the state space using " << options.numberOfThreads << " threads.");
+        }
+    }
+
     // Let the generator create all initial states.
     this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
     STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
@@ -171,130 +394,76 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     uint64_t numberOfExploredStates = 0;
     uint64_t numberOfExploredStatesSinceLastMessage = 0;
 
+    // Buffers for the parallel exploration. In each round, we expand a prefix of the queue of states to explore.
+    uint64_t const statesPerRound = 1024 * options.numberOfThreads;
+    std::vector<std::pair<CompressedState, StateType>> currentStates;
+    std::vector<StateBehavior<ValueType, StateType>> currentBehaviors;
+    std::vector<std::vector<CompressedState>> currentNewSuccessors;
+    std::vector<StateType> successorIndices;
+
     // Perform a search through the model.
     while (!statesToExplore.empty()) {
-        // Get the first state in the queue.
-        CompressedState currentState = statesToExplore.front().first;
-        StateType currentIndex = statesToExplore.front().second;
-        statesToExplore.pop_front();
-
-        // If the exploration order differs from breadth-first, we remember that this row group was actually
-        // filled with the transitions of a different state.
-        if (options.explorationOrder != ExplorationOrder::Bfs) {
-            stateRemapping.get()[currentIndex] = currentRowGroup;
-        }
-
-        if (currentIndex % 100000 == 0) {
-            STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
-        }
-
-        generator->load(currentState);
-        if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
-            generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
-        }
-        storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-
-        // If there is no behavior, we might have to introduce a self-loop.
-        if (behavior.empty()) {
-            if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                if (behavior.wasExpanded()) {
-                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                }
-
-                if (!generator->isDeterministicModel()) {
-                    transitionMatrixBuilder.newRowGroup(currentRow);
-                }
-
-                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateRewards()) {
-                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                    }
-
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                    }
+        uint64_t numberOfStatesInRound = 1;
+        if (parallelExploration) {
+            currentStates.clear();
+            while (!statesToExplore.empty() && currentStates.size() < statesPerRound) {
+                currentStates.push_back(std::move(statesToExplore.front()));
+                statesToExplore.pop_front();
+            }
+            numberOfStatesInRound = currentStates.size();
+
+            StateType const firstTemporaryIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
+            expandStatesInParallel(currentStates, currentBehaviors, currentNewSuccessors);
+
+            // Resolve the temporary indices in the order of the expanded states. This assigns exactly the indices the
+            // sequential exploration would have assigned.
+            auto translateColumn = [&successorIndices, &firstTemporaryIndex](StateType const& column) {
+                return column < firstTemporaryIndex ? column : successorIndices[column - firstTemporaryIndex];
+            };
+            for (uint64_t position = 0; position < currentStates.size(); ++position) {
+                CompressedState const& currentState = currentStates[position].first;
+                StateType currentIndex = currentStates[position].second;
+
+                successorIndices.clear();
+                for (auto const& successor : currentNewSuccessors[position]) {
+                    successorIndices.push_back(getOrAddStateIndex(successor));
                 }
 
-                // This state shall be Markovian (to not introduce Zeno behavior)
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                    generator->load(currentState);
+                    generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
                 }
-                // Other state-based information does not need to be treated, in particular:
-                // * StateValuations have already been set above
-                // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                ++currentRow;
-                ++currentRowGroup;
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
-                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+                addStateBehavior(currentState, currentIndex, currentBehaviors[position], transitionMatrixBuilder, rewardModelBuilders,
+                                 stateAndChoiceInformationBuilder, currentRow, currentRowGroup, translateColumn);
             }
         } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
-                }
-                ++stateRewardIt;
+            // Get the first state in the queue.
+            CompressedState currentState = statesToExplore.front().first;
+            StateType currentIndex = statesToExplore.front().second;
+            statesToExplore.pop_front();
+
+            // If the exploration order differs from breadth-first, we remember that this row group was actually
+            // filled with the transitions of a different state.
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                stateRemapping.get()[currentIndex] = currentRowGroup;
             }
 
-            // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
+            if (currentIndex % 100000 == 0) {
+                STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
             }
 
-            // Now add all choices.
-            bool firstChoiceOfState = true;
-            for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                }
-
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                    }
-                    ++choiceRewardIt;
-                }
-                ++currentRow;
-                firstChoiceOfState = false;
+            generator->load(currentState);
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
             }
-
-            ++currentRowGroup;
+            storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+            addStateBehavior(currentState, currentIndex, behavior, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder,
+                             currentRow, currentRowGroup);
         }
 
-        ++numberOfExploredStates;
+        numberOfExploredStates += numberOfStatesInRound;
         if (generator->getOptions().isShowProgressSet()) {
-            ++numberOfExploredStatesSinceLastMessage;
+            numberOfExploredStatesSinceLastMessage += numberOfStatesInRound;
 
             auto now = std::chrono::high_resolution_clock::now();
             auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
@@ -6,6 +6,7 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -78,6 +79,9 @@ class ExplicitModelBuilder {
 
         // The order in which to explore the model.
         ExplorationOrder explorationOrder;
+
+        // The number of threads used to expand states. A value of one yields the sequential exploration.
+        uint64_t numberOfThreads;
     };
 
     /*!
@@ -144,6 +148,38 @@ class ExplicitModelBuilder {
                        std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
                        StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+    /*!
+     * Adds the given behavior of the state with the given index to the matrix, reward and information builders.
+     *
+     * @param state The state whose behavior is added.
+     * @param stateIndex The index of the state.
+     * @param behavior The behavior of the state.
+     * @param currentRow The next free row of the transition matrix. Is updated by this method.
+     * @param currentRowGroup The next free row group of the transition matrix. Is updated by this method.
+     * @param columnTranslation If given, the column indices occurring in the behavior are translated using this
+     * function before they are added to the matrix.
+     */
+    void addStateBehavior(CompressedState const& state, StateType const& stateIndex, StateBehavior<ValueType, StateType> const& behavior,
+                          storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                          std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                          StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup,
+                          std::function<StateType(StateType const&)> const& columnTranslation = {});
+
+    /*!
+     * Expands the given states concurrently using the worker generators. States that have not been discovered
+     * before any of the given states was expanded are not added to the state storage. Instead, each expansion
+     * refers to them by temporary indices (starting at the number of currently known states) that are resolved
+     * when the results are added in the order of the given states. This way, the states are numbered exactly like
+     * in the sequential breadth-first exploration.
+     *
+     * @param states The states to expand together with their indices.
+     * @param behaviors The behaviors of the given states (in the same order) are written to this vector.
+     * @param newSuccessors For each of the given states, the successors that were not yet discovered are written to
+     * this vector, ordered by their temporary indices.
+     */
+    void expandStatesInParallel(std::vector<std::pair<CompressedState, StateType>> const& states,
+                                std::vector<StateBehavior<ValueType, StateType>>& behaviors, std::vector<std::vector<CompressedState>>& newSuccessors);
+
     /*!
      * Explores the state space of the given program and returns the components of the model as a result.
      *
@@ -161,6 +197,13 @@ class ExplicitModelBuilder {
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+    /// A function that creates fresh generators for the input of this builder (if the builder was created from a
+    /// PRISM program or JANI model). This is used to obtain one generator per thread in the parallel exploration.
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+
+    /// The generators of the additional threads used during the parallel exploration.
+    std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+
     /// The options to be used for the building process.
     Options options;
 
@@ -16,6 +16,7 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    epochThreadCount = mcSettings.getEpochThreadCount();
 }
 
 ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -46,4 +47,12 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+uint64_t const& ModelCheckerEnvironment::getEpochThreadCount() const {
+    return epochThreadCount;
+}
+
+void ModelCheckerEnvironment::setEpochThreadCount(uint64_t value) {
+    epochThreadCount = value;
+}
+
 }  // namespace storm
@@ -25,8 +25,15 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    /*!
+     * The number of threads that analyze epochs of reward-bounded properties. Zero means that the number of hardware threads is used.
+     */
+    uint64_t const& getEpochThreadCount() const;
+    void setEpochThreadCount(uint64_t value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    uint64_t epochThreadCount;
 };
 }  // namespace storm
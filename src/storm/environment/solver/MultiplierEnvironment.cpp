@@ -11,6 +11,8 @@ MultiplierEnvironment::MultiplierEnvironment() {
     auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
     type = multiplierSettings.getMultiplierType();
     typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+    compactStorage = multiplierSettings.isCompactStorageSet();
+    vectorize = multiplierSettings.isVectorizeSet();
 }
 
 MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +32,20 @@ void MultiplierEnvironment::setType(storm::solver::MultiplierType value, bool is
     typeSetFromDefault = isSetFromDefault;
 }
 
+bool const& MultiplierEnvironment::isCompactStorageSet() const {
+    return compactStorage;
+}
+
+void MultiplierEnvironment::setCompactStorage(bool value) {
+    compactStorage = value;
+}
+
+bool const& MultiplierEnvironment::isVectorizeSet() const {
+    return vectorize;
+}
+
+void MultiplierEnvironment::setVectorize(bool value) {
+    vectorize = value;
+}
+
 }  // namespace storm
@@ -13,9 +13,15 @@ class MultiplierEnvironment {
     storm::solver::MultiplierType const& getType() const;
     bool const& isTypeSetFromDefault() const;
     void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
+    bool const& isCompactStorageSet() const;
+    void setCompactStorage(bool value);
+    bool const& isVectorizeSet() const;
+    void setVectorize(bool value);
 
    private:
     storm::solver::MultiplierType type;
     bool typeSetFromDefault;
+    bool compactStorage;
+    bool vectorize;
 };
 }  // namespace storm
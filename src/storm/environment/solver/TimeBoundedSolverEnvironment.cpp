@@ -5,6 +5,8 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
 
 TimeBoundedSolverEnvironment::TimeBoundedSolverEnvironment() {
@@ -14,6 +16,8 @@ TimeBoundedSolverEnvironment::TimeBoundedSolverEnvironment() {
     precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
     relative = tbSettings.isRelativePrecision();
     unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+    ctmcMethod = tbSettings.getCtmcMethod();
+    krylovDimension = tbSettings.getKrylovDimension();
 }
 
 TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -57,4 +61,21 @@ void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value)
     unifPlusKappa = value;
 }
 
+storm::solver::CtmcTransientMethod const& TimeBoundedSolverEnvironment::getCtmcMethod() const {
+    return ctmcMethod;
+}
+
+void TimeBoundedSolverEnvironment::setCtmcMethod(storm::solver::CtmcTransientMethod value) {
+    ctmcMethod = value;
+}
+
+uint64_t const& TimeBoundedSolverEnvironment::getKrylovDimension() const {
+    return krylovDimension;
+}
+
+void TimeBoundedSolverEnvironment::setKrylovDimension(uint64_t value) {
+    STORM_LOG_THROW(value >= 2, storm::exceptions::InvalidArgumentException, "The Krylov dimension has to be at least two.");
+    krylovDimension = value;
+}
+
 }  // namespace storm
@@ -24,6 +24,11 @@ class TimeBoundedSolverEnvironment {
     storm::RationalNumber const& getUnifPlusKappa() const;
     void setUnifPlusKappa(storm::RationalNumber value);
 
+    storm::solver::CtmcTransientMethod const& getCtmcMethod() const;
+    void setCtmcMethod(storm::solver::CtmcTransientMethod value);
+    uint64_t const& getKrylovDimension() const;
+    void setKrylovDimension(uint64_t value);
+
    private:
     storm::solver::MaBoundedReachabilityMethod maMethod;
     bool maMethodSetFromDefault;
@@ -32,5 +37,8 @@ class TimeBoundedSolverEnvironment {
     bool relative;
 
     storm::RationalNumber unifPlusKappa;
+
+    storm::solver::CtmcTransientMethod ctmcMethod;
+    uint64_t krylovDimension;
 };
 }  // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
+#include <algorithm>
+#include <thread>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/TopologicalEquationSolverSettings.h"
 #include "storm/utility/macros.h"
@@ -15,6 +18,9 @@ TopologicalSolverEnvironment::TopologicalSolverEnvironment() {
 
     underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
     underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+
+    setNumberOfThreads(topologicalSettings.getNumberOfThreads());
+    coloredGaussSeidel = topologicalSettings.isColoredGaussSeidelSet();
 }
 
 TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -51,4 +57,23 @@ void TopologicalSolverEnvironment::setUnderlyingMinMaxMethod(storm::solver::MinM
     underlyingMinMaxMethod = value;
 }
 
+uint64_t const& TopologicalSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void TopologicalSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    if (value == 0) {
+        value = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
+    numberOfThreads = value;
+}
+
+bool const& TopologicalSolverEnvironment::isColoredGaussSeidelSet() const {
+    return coloredGaussSeidel;
+}
+
+void TopologicalSolverEnvironment::setColoredGaussSeidel(bool value) {
+    coloredGaussSeidel = value;
+}
+
 }  // namespace storm
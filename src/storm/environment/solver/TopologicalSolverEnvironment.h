@@ -19,11 +19,20 @@ class TopologicalSolverEnvironment {
     bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
     void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
 
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
+    bool const& isColoredGaussSeidelSet() const;
+    void setColoredGaussSeidel(bool value);
+
    private:
     storm::solver::EquationSolverType underlyingEquationSolverType;
     bool underlyingEquationSolverTypeSetFromDefault;
 
     storm::solver::MinMaxMethod underlyingMinMaxMethod;
     bool underlyingMinMaxMethodSetFromDefault;
+
+    uint64_t numberOfThreads;
+    bool coloredGaussSeidel;
 };
 }  // namespace storm
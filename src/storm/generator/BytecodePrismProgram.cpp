@@ -0,0 +1,125 @@
+#include "storm/generator/BytecodePrismProgram.h"
+
+#include <unordered_map>
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+std::unordered_map<storm::expressions::Variable, storm::expressions::BitVectorVariableLocation> getVariableLocations(
+    VariableInformation const& variableInformation) {
+    STORM_LOG_THROW(variableInformation.locationVariables.empty(), storm::exceptions::NotSupportedException, "Location variables are not supported.");
+    std::unordered_map<storm::expressions::Variable, storm::expressions::BitVectorVariableLocation> result;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        result.emplace(booleanVariable.variable, storm::expressions::BitVectorVariableLocation{true, booleanVariable.bitOffset, 1, 0});
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        result.emplace(integerVariable.variable, storm::expressions::BitVectorVariableLocation{false, integerVariable.bitOffset, integerVariable.bitWidth,
+                                                                                                 integerVariable.lowerBound});
+    }
+    return result;
+}
+}  // namespace
+
+BytecodePrismProgram::BytecodePrismProgram(storm::prism::Program const& program, VariableInformation const& variableInformation)
+    : bytecode(getVariableLocations(variableInformation)) {
+    std::unordered_map<storm::expressions::Variable, int64_t> upperBounds;
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        upperBounds.emplace(integerVariable.variable, integerVariable.upperBound);
+    }
+    auto locations = getVariableLocations(variableInformation);
+
+    // All guards are evaluated in one block such that common subexpressions are shared among the commands.
+    guardBlock = bytecode.beginBlock();
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            guardRegisters.emplace_back(command.getGlobalIndex(), bytecode.addExpression(command.getGuardExpression()));
+        }
+    }
+
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            if (command.getGlobalIndex() >= firstUpdateIndices.size()) {
+                firstUpdateIndices.resize(command.getGlobalIndex() + 1, 0);
+            }
+            firstUpdateIndices[command.getGlobalIndex()] = updates.size();
+            for (auto const& update : command.getUpdates()) {
+                UpdateCode code;
+                code.likelihoodBlock = bytecode.beginBlock();
+                code.likelihoodRegister = bytecode.addExpression(update.getLikelihoodExpression());
+                code.assignmentBlock = bytecode.beginBlock();
+                for (auto const& assignment : update.getAssignments()) {
+                    auto locationIt = locations.find(assignment.getVariable());
+                    STORM_LOG_THROW(locationIt != locations.end(), storm::exceptions::NotSupportedException,
+                                    "The assignment to variable '" << assignment.getVariableName() << "' is not supported.");
+                    AssignmentCode assignmentCode;
+                    assignmentCode.valueRegister = bytecode.addExpression(assignment.getExpression());
+                    assignmentCode.location = locationIt->second;
+                    assignmentCode.upperBound = locationIt->second.isBoolean ? 1 : upperBounds.at(assignment.getVariable());
+                    code.assignments.push_back(assignmentCode);
+                }
+                updates.push_back(std::move(code));
+            }
+        }
+    }
+}
+
+std::shared_ptr<BytecodePrismProgram const> BytecodePrismProgram::compile(storm::prism::Program const& program,
+                                                                          VariableInformation const& variableInformation) {
+    try {
+        std::shared_ptr<BytecodePrismProgram const> result(new BytecodePrismProgram(program, variableInformation));
+        STORM_LOG_INFO("Compiled the guards and updates of the program to " << result->bytecode.getNumberOfInstructions() << " bytecode instructions.");
+        return result;
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_WARN("The program can not be compiled to bytecode and is explored by interpreting its expressions instead: " << e.what());
+        return nullptr;
+    }
+}
+
+void BytecodePrismProgram::evaluateGuards(CompressedState const& state, std::vector<char>& guardValues) const {
+    bytecode.evaluateBlock(guardBlock, state);
+    guardValues.assign(firstUpdateIndices.size(), 0);
+    for (auto const& guardRegister : guardRegisters) {
+        guardValues[guardRegister.first] = bytecode.getBooleanValue(guardRegister.second) ? 1 : 0;
+    }
+}
+
+double BytecodePrismProgram::evaluateLikelihood(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex) const {
+    UpdateCode const& code = updates[firstUpdateIndices[command.getGlobalIndex()] + updateIndex];
+    bytecode.evaluateBlock(code.likelihoodBlock, state);
+    return bytecode.getDoubleValue(code.likelihoodRegister);
+}
+
+bool BytecodePrismProgram::applyUpdate(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex,
+                                       CompressedState& target) const {
+    UpdateCode const& code = updates[firstUpdateIndices[command.getGlobalIndex()] + updateIndex];
+    bytecode.evaluateBlock(code.assignmentBlock, state);
+
+    // All assignments are checked before any of them is written.
+    for (auto const& assignment : code.assignments) {
+        if (!assignment.location.isBoolean) {
+            int64_t value = bytecode.getIntegerValue(assignment.valueRegister);
+            if (value < assignment.location.lowerBound || value > assignment.upperBound) {
+                return false;
+            }
+        }
+    }
+    for (auto const& assignment : code.assignments) {
+        if (assignment.location.isBoolean) {
+            target.set(assignment.location.bitOffset, bytecode.getBooleanValue(assignment.valueRegister));
+        } else if (assignment.location.bitWidth > 0) {
+            target.setFromInt(assignment.location.bitOffset, assignment.location.bitWidth,
+                              static_cast<uint64_t>(bytecode.getIntegerValue(assignment.valueRegister) - assignment.location.lowerBound));
+        }
+    }
+    return true;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm/generator/CompiledPrismProgram.h"
+#include "storm/storage/expressions/BytecodeProgram.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}  // namespace prism
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * The guards, likelihoods and assignments of a PRISM program compiled to a register-based bytecode that reads the
+ * variables directly from compressed states. The guards of all commands are evaluated in a single pass. In contrast to
+ * JitCompiledPrismProgram, no system compiler is needed. As the bytecode keeps its registers internally, an object of
+ * this class must not be used by multiple threads at the same time.
+ */
+class BytecodePrismProgram : public CompiledPrismProgram {
+   public:
+    /*!
+     * Compiles the given program (whose constants and formulas need to be substituted already).
+     *
+     * @param program The program to compile.
+     * @param variableInformation The layout of the compressed states.
+     * @return The compiled program or a null pointer if the program is not supported.
+     */
+    static std::shared_ptr<BytecodePrismProgram const> compile(storm::prism::Program const& program, VariableInformation const& variableInformation);
+
+    virtual void evaluateGuards(CompressedState const& state, std::vector<char>& guardValues) const override;
+    virtual double evaluateLikelihood(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex) const override;
+    virtual bool applyUpdate(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex,
+                             CompressedState& target) const override;
+
+   private:
+    struct AssignmentCode {
+        uint64_t valueRegister;
+        storm::expressions::BitVectorVariableLocation location;
+        int64_t upperBound;
+    };
+
+    struct UpdateCode {
+        uint64_t likelihoodBlock;
+        uint64_t likelihoodRegister;
+        uint64_t assignmentBlock;
+        std::vector<AssignmentCode> assignments;
+    };
+
+    BytecodePrismProgram(storm::prism::Program const& program, VariableInformation const& variableInformation);
+
+    // The bytecode of all expressions.
+    storm::expressions::BytecodeProgram bytecode;
+
+    // The block that evaluates all guards and the register of the guard of each command (given by its global index).
+    uint64_t guardBlock;
+    std::vector<std::pair<uint64_t, uint64_t>> guardRegisters;
+
+    // For each global command index, the index of its first update.
+    std::vector<uint64_t> firstUpdateIndices;
+
+    // The code of all updates.
+    std::vector<UpdateCode> updates;
+};
+
+}  // namespace generator
+}  // namespace storm
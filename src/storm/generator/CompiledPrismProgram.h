@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace prism {
+class Command;
+}  // namespace prism
+
+namespace generator {
+
+/*!
+ * The guards, likelihoods and assignments of a PRISM program in a form that is evaluated directly on compressed states
+ * (without unpacking them into an expression evaluator). Updates are addressed by the global index of their command
+ * and their index within the command.
+ */
+class CompiledPrismProgram {
+   public:
+    virtual ~CompiledPrismProgram() = default;
+
+    /*!
+     * Evaluates the guards of all commands in the given state.
+     *
+     * @param state The state.
+     * @param guardValues Is resized and filled such that the value at the global index of a command is non-zero iff
+     * the command is enabled.
+     */
+    virtual void evaluateGuards(CompressedState const& state, std::vector<char>& guardValues) const = 0;
+
+    /*!
+     * Evaluates the likelihood of the given update in the given state.
+     */
+    virtual double evaluateLikelihood(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex) const = 0;
+
+    /*!
+     * Applies the given update to the given state.
+     *
+     * @param state The state in which the assignments are evaluated.
+     * @param command The command of the update.
+     * @param updateIndex The index of the update within the command.
+     * @param target The state to which the assignments are written. It needs to be a copy of the given state.
+     * @return False iff an integer variable is assigned a value outside of its bounds. In this case, the target is
+     * unchanged.
+     */
+    virtual bool applyUpdate(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex, CompressedState& target) const = 0;
+};
+
+}  // namespace generator
+}  // namespace storm
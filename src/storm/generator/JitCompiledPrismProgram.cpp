@@ -0,0 +1,334 @@
+#include "storm/generator/JitCompiledPrismProgram.h"
+
+#include <dlfcn.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ToCppVisitor.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+// Helpers of the generated code that mirror the bit layout of storm::storage::BitVector.
+char const* const sourcePreamble = R"(#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace {
+inline bool getBool(uint64_t const* buckets, uint64_t bitIndex) {
+    return (buckets[bitIndex >> 6] >> (63 - (bitIndex & 63))) & 1ull;
+}
+
+inline void setBool(uint64_t* buckets, uint64_t bitIndex, bool value) {
+    uint64_t const mask = 1ull << (63 - (bitIndex & 63));
+    buckets[bitIndex >> 6] = value ? (buckets[bitIndex >> 6] | mask) : (buckets[bitIndex >> 6] & ~mask);
+}
+
+inline uint64_t getInt(uint64_t const* buckets, uint64_t bitIndex, uint64_t numberOfBits) {
+    uint64_t const bucket = bitIndex >> 6;
+    uint64_t const bitIndexInBucket = bitIndex & 63;
+    uint64_t const mask = bitIndexInBucket == 0 ? ~0ull : (1ull << (64 - bitIndexInBucket)) - 1ull;
+    if (bitIndexInBucket + numberOfBits < 64) {
+        return (buckets[bucket] & mask) >> (64 - (bitIndexInBucket + numberOfBits));
+    } else if (bitIndexInBucket + numberOfBits > 64) {
+        uint64_t const remainingBits = numberOfBits - (64 - bitIndexInBucket);
+        return ((buckets[bucket] & mask) << remainingBits) | (buckets[bucket + 1] >> (64 - remainingBits));
+    } else {
+        return buckets[bucket] & mask;
+    }
+}
+
+inline void setInt(uint64_t* buckets, uint64_t bitIndex, uint64_t numberOfBits, uint64_t value) {
+    uint64_t const bucket = bitIndex >> 6;
+    uint64_t const bitIndexInBucket = bitIndex & 63;
+    uint64_t mask = bitIndexInBucket == 0 ? ~0ull : (1ull << (64 - bitIndexInBucket)) - 1ull;
+    if (bitIndexInBucket + numberOfBits < 64) {
+        mask &= ~((1ull << (64 - (bitIndexInBucket + numberOfBits))) - 1ull);
+        buckets[bucket] = (buckets[bucket] & ~mask) | (value << (64 - (bitIndexInBucket + numberOfBits)));
+    } else if (bitIndexInBucket + numberOfBits > 64) {
+        uint64_t const remainingBits = numberOfBits - (64 - bitIndexInBucket);
+        buckets[bucket] = (buckets[bucket] & ~mask) | (value >> remainingBits);
+        buckets[bucket + 1] = (buckets[bucket + 1] & ((1ull << (64 - remainingBits)) - 1ull)) | (value << (64 - remainingBits));
+    } else {
+        buckets[bucket] = (buckets[bucket] & ~mask) | value;
+    }
+}
+}  // namespace
+)";
+
+/*!
+ * Translates expressions of a PRISM program to C++ code that reads the variables from a compressed state.
+ */
+class SourceWriter {
+   public:
+    SourceWriter(VariableInformation const& variableInformation) : variableInformation(variableInformation) {
+        for (auto const& booleanVariable : variableInformation.booleanVariables) {
+            names.emplace(booleanVariable.variable, "v" + std::to_string(booleanVariable.variable.getIndex()));
+        }
+        for (auto const& integerVariable : variableInformation.integerVariables) {
+            names.emplace(integerVariable.variable, "v" + std::to_string(integerVariable.variable.getIndex()));
+        }
+    }
+
+    /*!
+     * Translates the given expression. All numerical values are computed as doubles, just like the evaluator does.
+     * The used variables are added to the given set.
+     */
+    std::string translate(storm::expressions::Expression const& expression, std::set<storm::expressions::Variable>& usedVariables) {
+        for (auto const& variable : expression.getVariables()) {
+            STORM_LOG_THROW(names.count(variable) > 0, storm::exceptions::NotSupportedException,
+                            "The expression '" << expression << "' refers to the variable '" << variable.getName() << "' that is not part of the state.");
+            usedVariables.insert(variable);
+        }
+        storm::expressions::ToCppTranslationOptions options(prefixes, names, storm::expressions::ToCppTranslationMode::CastDouble);
+        return visitor.translate(expression, options);
+    }
+
+    /*!
+     * Writes declarations that load the given variables from the state.
+     */
+    void writeLoads(std::ostream& out, std::set<storm::expressions::Variable> const& variables, std::string const& indentation) const {
+        for (auto const& booleanVariable : variableInformation.booleanVariables) {
+            if (variables.count(booleanVariable.variable) > 0) {
+                out << indentation << "bool const " << names.at(booleanVariable.variable) << " = getBool(state, " << booleanVariable.bitOffset << ");\n";
+            }
+        }
+        for (auto const& integerVariable : variableInformation.integerVariables) {
+            if (variables.count(integerVariable.variable) > 0) {
+                out << indentation << "int64_t const " << names.at(integerVariable.variable) << " = ";
+                if (integerVariable.bitWidth == 0) {
+                    out << "INT64_C(" << integerVariable.lowerBound << ");\n";
+                } else {
+                    out << "static_cast<int64_t>(getInt(state, " << integerVariable.bitOffset << ", " << integerVariable.bitWidth << ")) + INT64_C("
+                        << integerVariable.lowerBound << ");\n";
+                }
+            }
+        }
+    }
+
+    VariableInformation const& variableInformation;
+
+   private:
+    std::unordered_map<storm::expressions::Variable, std::string> prefixes;
+    std::unordered_map<storm::expressions::Variable, std::string> names;
+    storm::expressions::ToCppVisitor visitor;
+};
+
+// The compiled programs, indexed by their source code.
+std::mutex compiledProgramsMutex;
+std::map<std::string, std::weak_ptr<JitCompiledPrismProgram const>> compiledPrograms;
+std::atomic<uint64_t> nextLibraryIndex(0);
+}  // namespace
+
+JitCompiledPrismProgram::JitCompiledPrismProgram(void* libraryHandle, std::vector<uint64_t>&& firstUpdateIndices)
+    : libraryHandle(libraryHandle), firstUpdateIndices(std::move(firstUpdateIndices)) {
+    evaluateGuardsFunction = reinterpret_cast<EvaluateGuardsFunction>(dlsym(libraryHandle, "storm_jit_evaluate_guards"));
+    evaluateLikelihoodFunction = reinterpret_cast<EvaluateLikelihoodFunction>(dlsym(libraryHandle, "storm_jit_evaluate_likelihood"));
+    applyUpdateFunction = reinterpret_cast<ApplyUpdateFunction>(dlsym(libraryHandle, "storm_jit_apply_update"));
+}
+
+JitCompiledPrismProgram::~JitCompiledPrismProgram() {
+    dlclose(libraryHandle);
+}
+
+std::shared_ptr<JitCompiledPrismProgram const> JitCompiledPrismProgram::compile(storm::prism::Program const& program,
+                                                                                 VariableInformation const& variableInformation,
+                                                                                 std::string const& compiler) {
+    std::string source;
+    try {
+        source = generateSource(program, variableInformation);
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_WARN("The program can not be compiled and is explored by interpreting its expressions instead: " << e.what());
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(compiledProgramsMutex);
+    auto compiledProgramIt = compiledPrograms.find(source);
+    if (compiledProgramIt != compiledPrograms.end()) {
+        if (auto compiledProgram = compiledProgramIt->second.lock()) {
+            return compiledProgram;
+        }
+    }
+
+    // Write the source and invoke the compiler.
+    std::filesystem::path const directory = std::filesystem::temp_directory_path();
+    std::string const baseName = "storm-jit-" + std::to_string(getpid()) + "-" + std::to_string(nextLibraryIndex++);
+    std::filesystem::path const sourceFile = directory / (baseName + ".cpp");
+    std::filesystem::path const libraryFile = directory / (baseName + ".so");
+    std::filesystem::path const logFile = directory / (baseName + ".log");
+    {
+        std::ofstream out(sourceFile);
+        out << source;
+        if (!out) {
+            STORM_LOG_WARN("Unable to write the generated code to " << sourceFile << ", the program is explored by interpreting its expressions instead.");
+            std::error_code errorCode;
+            std::filesystem::remove(sourceFile, errorCode);
+            return nullptr;
+        }
+    }
+    std::string const command =
+        compiler + " -std=c++17 -O2 -shared -fPIC -o \"" + libraryFile.string() + "\" \"" + sourceFile.string() + "\" > \"" + logFile.string() + "\" 2>&1";
+    STORM_LOG_DEBUG("Compiling the program with command: " << command);
+    int const status = std::system(command.c_str());
+
+    std::shared_ptr<JitCompiledPrismProgram const> result;
+    if (status != 0) {
+        std::ifstream log(logFile);
+        std::stringstream logContent;
+        logContent << log.rdbuf();
+        STORM_LOG_WARN("Compiling the program failed (exit status " << status << "), the program is explored by interpreting its expressions instead.\n"
+                                                                    << logContent.str());
+    } else if (void* libraryHandle = dlopen(libraryFile.c_str(), RTLD_NOW | RTLD_LOCAL)) {
+        std::vector<uint64_t> firstUpdateIndices;
+        uint64_t updateIndex = 0;
+        for (auto const& module : program.getModules()) {
+            for (auto const& command : module.getCommands()) {
+                if (command.getGlobalIndex() >= firstUpdateIndices.size()) {
+                    firstUpdateIndices.resize(command.getGlobalIndex() + 1, 0);
+                }
+                firstUpdateIndices[command.getGlobalIndex()] = updateIndex;
+                updateIndex += command.getNumberOfUpdates();
+            }
+        }
+        result = std::shared_ptr<JitCompiledPrismProgram const>(new JitCompiledPrismProgram(libraryHandle, std::move(firstUpdateIndices)));
+
+        // Drop the entries of programs that are no longer in use, so the cache does not keep their sources alive.
+        for (auto it = compiledPrograms.begin(); it != compiledPrograms.end();) {
+            if (it->second.expired()) {
+                it = compiledPrograms.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        compiledPrograms[source] = result;
+        STORM_LOG_INFO("Compiled the guards and updates of the program to native code.");
+    } else {
+        STORM_LOG_WARN("Loading the compiled program failed (" << dlerror() << "), the program is explored by interpreting its expressions instead.");
+    }
+
+    // The library is not needed on disk anymore once it is loaded.
+    std::error_code errorCode;
+    std::filesystem::remove(sourceFile, errorCode);
+    std::filesystem::remove(libraryFile, errorCode);
+    std::filesystem::remove(logFile, errorCode);
+    return result;
+}
+
+bool JitCompiledPrismProgram::isCompilerAvailable(std::string const& compiler) {
+    std::string const command = compiler + " --version > /dev/null 2>&1";
+    return std::system(command.c_str()) == 0;
+}
+
+std::string JitCompiledPrismProgram::generateSource(storm::prism::Program const& program, VariableInformation const& variableInformation) {
+    STORM_LOG_THROW(variableInformation.locationVariables.empty(), storm::exceptions::NotSupportedException, "Location variables are not supported.");
+    SourceWriter writer(variableInformation);
+    std::stringstream out;
+    out << sourcePreamble;
+
+    // Guards
+    std::stringstream body;
+    std::set<storm::expressions::Variable> usedVariables;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            body << "    result[" << command.getGlobalIndex() << "] = " << writer.translate(command.getGuardExpression(), usedVariables) << ";\n";
+        }
+    }
+    out << "\nextern \"C\" void storm_jit_evaluate_guards(uint64_t const* state, char* result) {\n";
+    writer.writeLoads(out, usedVariables, "    ");
+    out << body.str() << "}\n";
+
+    // Likelihoods
+    out << "\nextern \"C\" double storm_jit_evaluate_likelihood(uint64_t const* state, uint64_t update) {\n    switch (update) {\n";
+    uint64_t updateIndex = 0;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            for (auto const& update : command.getUpdates()) {
+                usedVariables.clear();
+                std::string likelihood = writer.translate(update.getLikelihoodExpression(), usedVariables);
+                out << "        case " << updateIndex++ << ": {\n";
+                writer.writeLoads(out, usedVariables, "            ");
+                out << "            return " << likelihood << ";\n        }\n";
+            }
+        }
+    }
+    out << "    }\n    return 0.0;\n}\n";
+
+    // Assignments. All assignments of an update are evaluated before any of them is written.
+    out << "\nextern \"C\" int storm_jit_apply_update(uint64_t const* state, uint64_t* target, uint64_t update) {\n    switch (update) {\n";
+    updateIndex = 0;
+    std::map<storm::expressions::Variable, BooleanVariableInformation const*> booleanVariables;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        booleanVariables.emplace(booleanVariable.variable, &booleanVariable);
+    }
+    std::map<storm::expressions::Variable, IntegerVariableInformation const*> integerVariables;
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        integerVariables.emplace(integerVariable.variable, &integerVariable);
+    }
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            for (auto const& update : command.getUpdates()) {
+                usedVariables.clear();
+                std::stringstream evaluations, checks, writes;
+                uint64_t assignmentIndex = 0;
+                for (auto const& assignment : update.getAssignments()) {
+                    std::string value = writer.translate(assignment.getExpression(), usedVariables);
+                    std::string name = "a" + std::to_string(assignmentIndex++);
+                    auto booleanIt = booleanVariables.find(assignment.getVariable());
+                    if (booleanIt != booleanVariables.end()) {
+                        evaluations << "            bool const " << name << " = " << value << ";\n";
+                        writes << "            setBool(target, " << booleanIt->second->bitOffset << ", " << name << ");\n";
+                        continue;
+                    }
+                    auto integerIt = integerVariables.find(assignment.getVariable());
+                    STORM_LOG_THROW(integerIt != integerVariables.end(), storm::exceptions::NotSupportedException,
+                                    "The assignment to variable '" << assignment.getVariableName() << "' is not supported.");
+                    IntegerVariableInformation const& integerVariable = *integerIt->second;
+                    evaluations << "            int64_t const " << name << " = static_cast<int64_t>(" << value << ");\n";
+                    checks << "            if (" << name << " < INT64_C(" << integerVariable.lowerBound << ") || " << name << " > INT64_C("
+                           << integerVariable.upperBound << ")) {\n                return 1;\n            }\n";
+                    if (integerVariable.bitWidth > 0) {
+                        writes << "            setInt(target, " << integerVariable.bitOffset << ", " << integerVariable.bitWidth << ", static_cast<uint64_t>("
+                               << name << " - INT64_C(" << integerVariable.lowerBound << ")));\n";
+                    }
+                }
+                out << "        case " << updateIndex++ << ": {\n";
+                writer.writeLoads(out, usedVariables, "            ");
+                out << evaluations.str() << checks.str() << writes.str() << "            return 0;\n        }\n";
+            }
+        }
+    }
+    out << "    }\n    return 0;\n}\n";
+    return out.str();
+}
+
+void JitCompiledPrismProgram::evaluateGuards(CompressedState const& state, std::vector<char>& guardValues) const {
+    guardValues.resize(firstUpdateIndices.size());
+    evaluateGuardsFunction(state.buckets, guardValues.data());
+}
+
+double JitCompiledPrismProgram::evaluateLikelihood(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex) const {
+    return evaluateLikelihoodFunction(state.buckets, firstUpdateIndices[command.getGlobalIndex()] + updateIndex);
+}
+
+bool JitCompiledPrismProgram::applyUpdate(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex,
+                                          CompressedState& target) const {
+    return applyUpdateFunction(state.buckets, target.buckets, firstUpdateIndices[command.getGlobalIndex()] + updateIndex) == 0;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/generator/CompiledPrismProgram.h"
+
+namespace storm {
+namespace prism {
+class Program;
+class Command;
+}  // namespace prism
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * Native code for the guards, likelihoods and assignments of a PRISM program. The code is generated as C++ that
+ * operates directly on the bits of compressed states, compiled with the system compiler and loaded at runtime.
+ */
+class JitCompiledPrismProgram : public CompiledPrismProgram {
+   public:
+    virtual ~JitCompiledPrismProgram();
+
+    JitCompiledPrismProgram(JitCompiledPrismProgram const&) = delete;
+    JitCompiledPrismProgram& operator=(JitCompiledPrismProgram const&) = delete;
+
+    /*!
+     * Compiles the given program (whose constants and formulas need to be substituted already). The compiled code is
+     * shared between all callers that compile the same program.
+     *
+     * @param program The program to compile.
+     * @param variableInformation The layout of the compressed states.
+     * @param compiler The command used to invoke the C++ compiler.
+     * @return The compiled program or a null pointer if the program is not supported or could not be compiled.
+     */
+    static std::shared_ptr<JitCompiledPrismProgram const> compile(storm::prism::Program const& program, VariableInformation const& variableInformation,
+                                                                  std::string const& compiler);
+
+    /*!
+     * Checks whether the given command invokes a working C++ compiler.
+     */
+    static bool isCompilerAvailable(std::string const& compiler);
+
+    virtual void evaluateGuards(CompressedState const& state, std::vector<char>& guardValues) const override;
+    virtual double evaluateLikelihood(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex) const override;
+    virtual bool applyUpdate(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex,
+                             CompressedState& target) const override;
+
+   private:
+    typedef void (*EvaluateGuardsFunction)(uint64_t const*, char*);
+    typedef double (*EvaluateLikelihoodFunction)(uint64_t const*, uint64_t);
+    typedef int (*ApplyUpdateFunction)(uint64_t const*, uint64_t*, uint64_t);
+
+    JitCompiledPrismProgram(void* libraryHandle, std::vector<uint64_t>&& firstUpdateIndices);
+
+    /*!
+     * Generates the C++ code for the given program.
+     */
+    static std::string generateSource(storm::prism::Program const& program, VariableInformation const& variableInformation);
+
+    // The handle of the loaded shared library.
+    void* libraryHandle;
+
+    // The entry points of the compiled code.
+    EvaluateGuardsFunction evaluateGuardsFunction;
+    EvaluateLikelihoodFunction evaluateLikelihoodFunction;
+    ApplyUpdateFunction applyUpdateFunction;
+
+    // For each global command index, the index of its first update in the compiled code.
+    std::vector<uint64_t> firstUpdateIndices;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -11,6 +11,8 @@
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 
 #include "storm/generator/Distribution.h"
+#include "storm/generator/BytecodePrismProgram.h"
+#include "storm/generator/JitCompiledPrismProgram.h"
 
 #include "storm/solver/SmtSolver.h"
 
@@ -49,6 +51,19 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
     // Create a proper evalator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
 
+    if (this->options.isJitCompilationSet() || this->options.isBytecodeEvaluationSet()) {
+        if (std::is_same<ValueType, double>::value) {
+            if (this->options.isJitCompilationSet()) {
+                compiledProgram = JitCompiledPrismProgram::compile(this->program, this->variableInformation, this->options.getJitCompiler());
+            }
+            if (!compiledProgram && this->options.isBytecodeEvaluationSet()) {
+                compiledProgram = BytecodePrismProgram::compile(this->program, this->variableInformation);
+            }
+        } else {
+            STORM_LOG_WARN("Compiling the program to native code or bytecode is only supported for models with floating point values.");
+        }
+    }
+
     if (this->options.isBuildAllRewardModelsSet()) {
         for (auto const& rewardModel : this->program.getRewardModels()) {
             rewardModels.push_back(rewardModel);
@@ -308,6 +323,9 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // Get all choices for the state.
     result.setExpanded();
+    if (compiledProgram) {
+        compiledProgram->evaluateGuards(*this->state, guardValues);
+    }
 
     std::vector<Choice<ValueType>> allChoices;
     if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
@@ -429,6 +447,35 @@ bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInC
     return this->evaluator->asBool(expr);
 }
 
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isEnabled(storm::prism::Command const& command) const {
+    if (compiledProgram) {
+        return guardValues[command.getGlobalIndex()] != 0;
+    }
+    return this->evaluator->asBool(command.getGuardExpression());
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::getLikelihood(storm::prism::Command const& command, uint64_t updateIndex) const {
+    if (compiledProgram) {
+        return storm::utility::convertNumber<ValueType>(compiledProgram->evaluateLikelihood(*this->state, command, updateIndex));
+    }
+    return this->evaluator->asRational(command.getUpdate(updateIndex).getLikelihoodExpression());
+}
+
+template<typename ValueType, typename StateType>
+CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Command const& command,
+                                                                           uint64_t updateIndex) {
+    if (compiledProgram) {
+        CompressedState newState(state);
+        if (compiledProgram->applyUpdate(*this->state, command, updateIndex, newState)) {
+            return newState;
+        }
+        // Out-of-bounds values are handled by the interpreted update.
+    }
+    return applyUpdate(state, command.getUpdate(updateIndex));
+}
+
 template<typename ValueType, typename StateType>
 CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
     CompressedState newState(state);
@@ -531,7 +578,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isEnabled(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
                 activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
@@ -565,7 +612,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isEnabled(command)) {
                 commands.push_back(command);
             }
         }
@@ -608,7 +655,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!isEnabled(command)) {
                 continue;
             }
 
@@ -624,13 +671,11 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             // Iterate over all updates of the current command.
             ValueType probabilitySum = storm::utility::zero<ValueType>();
             for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                storm::prism::Update const& update = command.getUpdate(k);
-
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                ValueType probability = getLikelihood(command, k);
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
                     // seen, we also add it to the set of states that have yet to be explored.
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+                    StateType stateIndex = stateToIdCallback(applyUpdate(state, command, k));
 
                     // Update the choice by adding the probability/target state to it.
                     choice.addProbability(stateIndex, probability);
@@ -691,9 +736,8 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
     } else {
         storm::prism::Command const& command = *iteratorList[position];
         for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
-            storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
-                                             position + 1, iteratorList, distribution, stateToIdCallback);
+            generateSynchronizedDistribution(applyUpdate(state, command, j), probability * getLikelihood(command, j), position + 1, iteratorList, distribution,
+                                             stateToIdCallback);
         }
     }
 }
@@ -905,6 +949,11 @@ std::shared_ptr<storm::storage::sparse::ChoiceOrigins> PrismNextStateGenerator<V
                                                                         std::move(identifierToCommandSetMapping));
 }
 
+template<typename ValueType, typename StateType>
+std::shared_ptr<CompiledPrismProgram const> const& PrismNextStateGenerator<ValueType, StateType>::getCompiledProgram() const {
+    return compiledProgram;
+}
+
 template<typename ValueType, typename StateType>
 bool PrismNextStateGenerator<ValueType, StateType>::isCommandPotentiallySynchronizing(const prism::Command& command) const {
     return program.getPossiblySynchronizingCommands().get(command.getGlobalIndex());
@@ -11,6 +11,8 @@ namespace generator {
 template<typename StateType, typename ValueType>
 class Distribution;
 
+class CompiledPrismProgram;
+
 template<typename ValueType, typename StateType = uint32_t>
 class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
    public:
@@ -47,6 +49,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+    /*!
+     * Retrieves the compiled form of the program that is used to evaluate guards, likelihoods and assignments. If the
+     * expressions of the program are interpreted, this is a null pointer.
+     */
+    std::shared_ptr<CompiledPrismProgram const> const& getCompiledProgram() const;
+
    private:
     void checkValid() const;
 
@@ -67,6 +75,26 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
      */
     CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
 
+    /*!
+     * Applies the given update of the given command to the given state. The assignments are evaluated in the
+     * currently loaded state (using the compiled program, if available).
+     * @params state The state to which to apply the new values.
+     * @params command The command of the update.
+     * @params updateIndex The index of the update within the command.
+     * @return The resulting state.
+     */
+    CompressedState applyUpdate(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex);
+
+    /*!
+     * Retrieves whether the given command is enabled in the currently loaded state.
+     */
+    bool isEnabled(storm::prism::Command const& command) const;
+
+    /*!
+     * Evaluates the likelihood of the given update of the given command in the currently loaded state.
+     */
+    ValueType getLikelihood(storm::prism::Command const& command, uint64_t updateIndex) const;
+
     /*!
      * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
      * modules.
@@ -137,6 +165,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // If set, the guards, likelihoods and assignments are evaluated by native code or bytecode.
+    std::shared_ptr<CompiledPrismProgram const> compiledProgram;
+
+    // The values of the guards in the currently expanded state (if the program is compiled).
+    std::vector<char> guardValues;
 };
 
 }  // namespace generator
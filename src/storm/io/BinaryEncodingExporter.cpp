@@ -0,0 +1,195 @@
+#include "storm/io/BinaryEncodingExporter.h"
+
+#include <map>
+#include <set>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+/*!
+ * Writes the components of a model into the sections of the binary encoding.
+ */
+class BinaryWriter {
+   public:
+    explicit BinaryWriter(std::ostream& os) : os(os) {
+        // Intentionally left empty.
+    }
+
+    void writeNumber(uint64_t number) {
+        os.write(reinterpret_cast<char const*>(&number), sizeof(number));
+    }
+
+    void writeSection(void const* data, uint64_t size) {
+        static char const padding[8] = {};
+        writeNumber(size);
+        os.write(static_cast<char const*>(data), size);
+        os.write(padding, (8 - size % 8) % 8);
+    }
+
+    template<typename T>
+    void writeSection(std::vector<T> const& vector) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable data can be written.");
+        writeSection(vector.data(), vector.size() * sizeof(T));
+    }
+
+    void writeString(std::string const& string) {
+        writeSection(string.data(), string.size());
+    }
+
+    void writeBitVector(storm::storage::BitVector const& bitVector) {
+        std::vector<uint64_t> buckets;
+        buckets.reserve((bitVector.size() + 63) / 64);
+        for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+            buckets.push_back(bitVector.getAsInt(index, std::min<uint64_t>(64, bitVector.size() - index)));
+        }
+        writeNumber(bitVector.size());
+        writeSection(buckets);
+    }
+
+    void writeLabeling(storm::models::sparse::StateLabeling const& labeling) {
+        writeLabels(labeling.getLabels(), [&labeling](std::string const& label) -> storm::storage::BitVector const& { return labeling.getStates(label); });
+    }
+
+    void writeLabeling(storm::models::sparse::ChoiceLabeling const& labeling) {
+        writeLabels(labeling.getLabels(), [&labeling](std::string const& label) -> storm::storage::BitVector const& { return labeling.getChoices(label); });
+    }
+
+    /*!
+     * Writes the row indications, columns and values of the given matrix. The row grouping is not written.
+     */
+    template<typename ValueType>
+    void writeMatrixEntries(storm::storage::SparseMatrix<ValueType> const& matrix) {
+        std::vector<uint64_t> rowIndications;
+        rowIndications.reserve(matrix.getRowCount() + 1);
+        rowIndications.push_back(0);
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            rowIndications.push_back(matrix.end(row) - matrix.begin());
+        }
+        writeSection(rowIndications);
+
+        // Write the columns and values in blocks to avoid copying the entire matrix.
+        uint64_t const entryCount = rowIndications.back();
+        writeColumnsOrValues<uint64_t>(matrix, entryCount, [](auto const& entry) { return entry.getColumn(); });
+        writeColumnsOrValues<ValueType>(matrix, entryCount, [](auto const& entry) { return entry.getValue(); });
+    }
+
+   private:
+    template<typename GetItems>
+    void writeLabels(std::set<std::string> const& labels, GetItems const& getItems) {
+        writeNumber(labels.size());
+        for (auto const& label : labels) {
+            writeString(label);
+            writeBitVector(getItems(label));
+        }
+    }
+
+    template<typename T, typename ValueType, typename Projection>
+    void writeColumnsOrValues(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t entryCount, Projection const& projection) {
+        static uint64_t const blockSize = 4096;
+        static char const padding[8] = {};
+        std::vector<T> block;
+        block.reserve(blockSize);
+        writeNumber(entryCount * sizeof(T));
+        for (auto entryIt = matrix.begin(), entryEnd = matrix.begin() + entryCount; entryIt != entryEnd; ++entryIt) {
+            block.push_back(projection(*entryIt));
+            if (block.size() == blockSize) {
+                os.write(reinterpret_cast<char const*>(block.data()), block.size() * sizeof(T));
+                block.clear();
+            }
+        }
+        os.write(reinterpret_cast<char const*>(block.data()), block.size() * sizeof(T));
+        os.write(padding, (8 - (entryCount * sizeof(T)) % 8) % 8);
+    }
+
+    std::ostream& os;
+};
+}  // namespace
+
+template<typename ValueType>
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel) {
+    if constexpr (!std::is_trivially_copyable<ValueType>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary encoding is only supported for models with floating point values.");
+    } else {
+        auto const type = sparseModel->getType();
+        STORM_LOG_THROW(type != storm::models::ModelType::S2pg && type != storm::models::ModelType::Smg, storm::exceptions::NotSupportedException,
+                        "The binary encoding does not support models of type " << type << ".");
+        STORM_LOG_WARN_COND(!sparseModel->hasStateValuations(), "State valuations are not exported in the binary encoding.");
+        STORM_LOG_WARN_COND(!sparseModel->hasChoiceOrigins(), "Choice origins are not exported in the binary encoding.");
+
+        // Notice that for CTMCs we write the rate matrix, as the exit rates can be derived from it.
+        auto const& matrix = sparseModel->getTransitionMatrix();
+        BinaryWriter writer(os);
+        os.write(binaryEncodingMagic, sizeof(binaryEncodingMagic));
+        writer.writeNumber(binaryEncodingVersion);
+        writer.writeNumber(sizeof(ValueType));
+        writer.writeNumber(static_cast<uint64_t>(type));
+        writer.writeNumber(matrix.getRowGroupCount());
+        writer.writeNumber(matrix.getRowCount());
+        writer.writeNumber(matrix.getEntryCount());
+
+        // Transition matrix
+        writer.writeNumber(matrix.hasTrivialRowGrouping() ? 0 : 1);
+        if (!matrix.hasTrivialRowGrouping()) {
+            writer.writeSection(matrix.getRowGroupIndices());
+        }
+        writer.writeMatrixEntries(matrix);
+
+        // Labelings
+        writer.writeLabeling(sparseModel->getStateLabeling());
+        writer.writeNumber(sparseModel->hasChoiceLabeling() ? 1 : 0);
+        if (sparseModel->hasChoiceLabeling()) {
+            writer.writeLabeling(sparseModel->getChoiceLabeling());
+        }
+
+        // Reward models (sorted by name to obtain a deterministic output)
+        std::map<std::string, typename storm::models::sparse::Model<ValueType>::RewardModelType const*> rewardModels;
+        for (auto const& rewardModel : sparseModel->getRewardModels()) {
+            rewardModels.emplace(rewardModel.first, &rewardModel.second);
+        }
+        writer.writeNumber(rewardModels.size());
+        for (auto const& rewardModel : rewardModels) {
+            writer.writeString(rewardModel.first);
+            writer.writeNumber(rewardModel.second->hasStateRewards() ? 1 : 0);
+            if (rewardModel.second->hasStateRewards()) {
+                writer.writeSection(rewardModel.second->getStateRewardVector());
+            }
+            writer.writeNumber(rewardModel.second->hasStateActionRewards() ? 1 : 0);
+            if (rewardModel.second->hasStateActionRewards()) {
+                writer.writeSection(rewardModel.second->getStateActionRewardVector());
+            }
+            writer.writeNumber(rewardModel.second->hasTransitionRewards() ? 1 : 0);
+            if (rewardModel.second->hasTransitionRewards()) {
+                writer.writeMatrixEntries(rewardModel.second->getTransitionRewardMatrix());
+            }
+        }
+
+        // Model type specific components
+        if (type == storm::models::ModelType::MarkovAutomaton) {
+            auto ma = sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+            writer.writeSection(ma->getExitRates());
+            writer.writeBitVector(ma->getMarkovianStates());
+        } else if (type == storm::models::ModelType::Pomdp) {
+            writer.writeSection(sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservations());
+        }
+        STORM_LOG_THROW(os, storm::exceptions::FileIoException, "Error while writing the binary encoding of the model.");
+    }
+}
+
+// Template instantiations.
+template void binaryExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel);
+template void binaryExportSparseModel<storm::RationalNumber>(std::ostream& os,
+                                                             std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> sparseModel);
+template void binaryExportSparseModel<storm::RationalFunction>(std::ostream& os,
+                                                               std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel);
+}  // namespace exporter
+}  // namespace storm
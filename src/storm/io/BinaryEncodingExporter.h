@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * The binary encoding consists of a header followed by a sequence of sections. Every section starts with its size (in
+ * bytes) and is padded to a multiple of eight bytes, so that all sections are aligned when the file is mapped into
+ * memory. All numbers are stored in the native byte order. The header consists of
+ * - the magic string "STORMDRB",
+ * - the version of the format,
+ * - the size of a value (in bytes),
+ * - the model type,
+ * - the number of states, choices and transitions.
+ * Then, the transition matrix (row group indices, row indications, columns, values), the state labeling, the choice
+ * labeling, the reward models and the model type specific components (exit rates and Markovian states for Markov
+ * automata, observations for POMDPs) follow.
+ */
+uint64_t const binaryEncodingVersion = 1;
+char const binaryEncodingMagic[8] = {'S', 'T', 'O', 'R', 'M', 'D', 'R', 'B'};
+
+/*!
+ * Exports a sparse model into the binary encoding. This is only supported for models whose values have a fixed size.
+ *
+ * @param os           Stream to export to. The stream should be opened in binary mode.
+ * @param sparseModel  Model to export
+ */
+template<typename ValueType>
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
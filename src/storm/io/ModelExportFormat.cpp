@@ -13,6 +13,8 @@ ModelExportFormat getModelExportFormatFromString(std::string const& input) {
         return ModelExportFormat::Drdd;
     } else if (input == "drn") {
         return ModelExportFormat::Drn;
+    } else if (input == "drb") {
+        return ModelExportFormat::Drb;
     } else if (input == "json") {
         return ModelExportFormat::Json;
     }
@@ -27,6 +29,8 @@ std::string toString(ModelExportFormat const& input) {
             return "drdd";
         case ModelExportFormat::Drn:
             return "drn";
+        case ModelExportFormat::Drb:
+            return "drb";
         case ModelExportFormat::Json:
             return "json";
     }
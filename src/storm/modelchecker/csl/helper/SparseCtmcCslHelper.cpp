@@ -9,6 +9,7 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/KrylovExponentialHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
@@ -550,12 +551,24 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
                                                                              storm::storage::BitVector const& phiStates,
                                                                              storm::storage::BitVector const& psiStates,
                                                                              std::vector<ValueType> const& exitRates, double timeBound) {
+    std::vector<double> timeBounds = {timeBound};
+    return std::move(computeAllTransientProbabilities(env, rateMatrix, initialStates, phiStates, psiStates, exitRates, timeBounds).front());
+}
+
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeAllTransientProbabilities(Environment const& env,
+                                                                                          storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                          storm::storage::BitVector const& initialStates,
+                                                                                          storm::storage::BitVector const& phiStates,
+                                                                                          storm::storage::BitVector const& psiStates,
+                                                                                          std::vector<ValueType> const& exitRates,
+                                                                                          std::vector<double> const& timeBounds) {
     // Compute transient probabilities going from initial state
     // Instead of y=Px we now compute y=xP <=> y^T=P^Tx^T via transposition
     uint_fast64_t numberOfStates = rateMatrix.getRowCount();
 
-    // Create the result vector.
-    std::vector<ValueType> result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+    // Create the result vectors.
+    std::vector<std::vector<ValueType>> result(timeBounds.size(), std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
 
     storm::storage::SparseMatrix<ValueType> transposedMatrix(rateMatrix);
     transposedMatrix.makeRowsAbsorbing(psiStates);
@@ -606,11 +619,18 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
             }
             ++i;
         }
-        // Finally compute the transient probabilities.
-        std::vector<ValueType> subresult =
-            computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
+        // Finally compute the transient probabilities for all time bounds at once.
+        std::vector<ValueType> valueTypeTimeBounds;
+        valueTypeTimeBounds.reserve(timeBounds.size());
+        for (auto const& timeBound : timeBounds) {
+            valueTypeTimeBounds.push_back(storm::utility::convertNumber<ValueType>(timeBound));
+        }
+        std::vector<std::vector<ValueType>> subresults =
+            computeTransientProbabilitiesForTimeBounds<ValueType>(env, uniformizedMatrix, nullptr, valueTypeTimeBounds, uniformizationRate, values, epsilon);
 
-        storm::utility::vector::setVectorValues(result, relevantStates, subresult);
+        for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+            storm::utility::vector::setVectorValues(result[timeBoundIndex], relevantStates, subresults[timeBoundIndex]);
+        }
     }
 
     return result;
@@ -623,6 +643,14 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeAllTransientProbabilities(Environment const&, storm::storage::SparseMatrix<ValueType> const&,
+                                                                                          storm::storage::BitVector const&, storm::storage::BitVector const&,
+                                                                                          storm::storage::BitVector const&, std::vector<ValueType> const&,
+                                                                                          std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing transient probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       storm::storage::BitVector const& maybeStates,
@@ -666,6 +694,10 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
         return values;
     }
 
+    if (!useMixedPoissonProbabilities && env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::Krylov) {
+        return computeTransientProbabilitiesKrylov(env, uniformizedMatrix, addVector, timeBound, uniformizationRate, std::move(values), epsilon);
+    }
+
     // Use Fox-Glynn to get the truncation points and the weights.
     storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
     STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
@@ -738,6 +770,145 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType>
+std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilitiesKrylov(Environment const& env,
+                                                                                storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                                std::vector<ValueType> const* addVector, ValueType timeBound,
+                                                                                ValueType uniformizationRate, std::vector<ValueType> values,
+                                                                                ValueType epsilon) {
+    // The iteration x <- P*x + b of uniformization corresponds to the differential equation dx/dt = q*(P-I)*x + q*b. If the add vector is present,
+    // we augment the system by a constant component s (initially one) such that the equation becomes linear, i.e., A*(x,s) = (q*(P-I)*x + q*b*s, 0).
+    uint64_t const numberOfStates = uniformizedMatrix.getRowCount();
+    uint64_t const dimension = addVector ? numberOfStates + 1 : numberOfStates;
+    if (addVector) {
+        values.push_back(storm::utility::one<ValueType>());
+    }
+
+    // Compute the infinity norm of A.
+    ValueType norm = storm::utility::zero<ValueType>();
+    for (uint64_t row = 0; row < numberOfStates; ++row) {
+        ValueType rowNorm = storm::utility::zero<ValueType>();
+        bool hasDiagonalEntry = false;
+        for (auto const& entry : uniformizedMatrix.getRow(row)) {
+            if (entry.getColumn() == row) {
+                hasDiagonalEntry = true;
+                rowNorm += storm::utility::abs<ValueType>(entry.getValue() - storm::utility::one<ValueType>());
+            } else {
+                rowNorm += storm::utility::abs<ValueType>(entry.getValue());
+            }
+        }
+        if (!hasDiagonalEntry) {
+            rowNorm += storm::utility::one<ValueType>();
+        }
+        if (addVector) {
+            rowNorm += storm::utility::abs<ValueType>((*addVector)[row]);
+        }
+        norm = std::max(norm, rowNorm * uniformizationRate);
+    }
+
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    std::vector<ValueType> states(numberOfStates), successors(numberOfStates);
+    auto multiply = [&](std::vector<ValueType> const& x, std::vector<ValueType>& result) {
+        std::copy(x.begin(), x.begin() + numberOfStates, states.begin());
+        multiplier->multiply(env, states, nullptr, successors);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            result[state] = uniformizationRate * (successors[state] - states[state]);
+        }
+        if (addVector) {
+            // The add vector only has entries for the states, so the constant component is handled separately.
+            ValueType const factor = uniformizationRate * x.back();
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                result[state] += factor * (*addVector)[state];
+            }
+            result.back() = storm::utility::zero<ValueType>();
+        }
+    };
+
+    // The tolerance of the Krylov method refers to a single time unit.
+    storm::solver::helper::KrylovExponentialHelper<ValueType> krylovHelper(multiply, norm, env.solver().timeBounded().getKrylovDimension());
+    STORM_LOG_DEBUG("Starting Krylov subspace method with " << dimension << " x " << dimension << " matrix of norm " << norm << ".");
+    std::vector<ValueType> result = krylovHelper.computeExponentialTimesVector(timeBound, values, epsilon / timeBound);
+    STORM_LOG_INFO("Krylov subspace method performed " << krylovHelper.getNumberOfSteps() << " steps with estimated error "
+                                                       << krylovHelper.getErrorEstimate() << ".");
+    result.resize(numberOfStates);
+
+    // Probabilities can not be negative. Small negative values may occur due to numerical inaccuracies.
+    for (auto& value : result) {
+        value = std::max(value, storm::utility::zero<ValueType>());
+    }
+    return result;
+}
+
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+    std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+
+    if (env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::Krylov) {
+        // The Krylov method adapts its steps to the time bound, so there are no iterations that could be shared between the time bounds.
+        std::vector<std::vector<ValueType>> result;
+        result.reserve(timeBounds.size());
+        for (auto const& timeBound : timeBounds) {
+            if (storm::utility::isZero(timeBound * uniformizationRate)) {
+                result.push_back(values);
+            } else {
+                result.push_back(computeTransientProbabilitiesKrylov(env, uniformizedMatrix, addVector, timeBound, uniformizationRate, values, epsilon));
+            }
+        }
+        return result;
+    }
+
+    // Use Fox-Glynn to get the truncation points and the weights for each time bound.
+    // Time bounds at which no time can pass are marked as finished right away.
+    std::vector<std::vector<ValueType>> result(timeBounds.size());
+    std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults(timeBounds.size());
+    storm::storage::BitVector unfinishedTimeBounds(timeBounds.size(), false);
+    uint64_t lastIteration = 0;
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        ValueType lambda = timeBounds[timeBoundIndex] * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            result[timeBoundIndex] = values;
+            continue;
+        }
+        auto& foxGlynnResult = foxGlynnResults[timeBoundIndex];
+        foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+        STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[timeBoundIndex] << ": left=" << foxGlynnResult.left
+                                                                  << ", right=" << foxGlynnResult.right);
+        lastIteration = std::max<uint64_t>(lastIteration, foxGlynnResult.right);
+        unfinishedTimeBounds.set(timeBoundIndex);
+        // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
+        result[timeBoundIndex] = std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>());
+        if (foxGlynnResult.left == 0) {
+            storm::utility::vector::addScaledVector(result[timeBoundIndex], values, foxGlynnResult.weights.front());
+        }
+    }
+
+    if (!unfinishedTimeBounds.empty()) {
+        STORM_LOG_DEBUG("Starting " << lastIteration << " iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount()
+                                    << " matrix for " << unfinishedTimeBounds.getNumberOfSetBits() << " time bounds.");
+        // Each multiplication is shared by all time bounds whose truncation points enclose the current iteration.
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+        for (uint64_t index = 1; index <= lastIteration; ++index) {
+            multiplier->multiply(env, values, addVector, values);
+            for (auto timeBoundIndex : unfinishedTimeBounds) {
+                auto const& foxGlynnResult = foxGlynnResults[timeBoundIndex];
+                if (foxGlynnResult.left <= index && index <= foxGlynnResult.right) {
+                    storm::utility::vector::addScaledVector(result[timeBoundIndex], values, foxGlynnResult.weights[index - foxGlynnResult.left]);
+                }
+            }
+        }
+
+        // Finally, divide the results by the total weight
+        for (auto timeBoundIndex : unfinishedTimeBounds) {
+            storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result[timeBoundIndex],
+                                                                             storm::utility::one<ValueType>() / foxGlynnResults[timeBoundIndex].totalWeight);
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -826,6 +997,11 @@ template std::vector<double> SparseCtmcCslHelper::computeAllTransientProbabiliti
     Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& initialStates,
     storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, double timeBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeAllTransientProbabilities(
+    Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& initialStates,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates,
+    std::vector<double> const& timeBounds);
+
 template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                                             storm::storage::BitVector const& maybeStates,
                                                                                             double uniformizationRate, std::vector<double> const& exitRates);
@@ -835,6 +1011,10 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
+
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
@@ -924,6 +1104,14 @@ template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeAllTra
     Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::BitVector const& initialStates,
     storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates,
     double timeBound);
+template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeAllTransientProbabilities(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::BitVector const& initialStates,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates,
+    std::vector<double> const& timeBounds);
+template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeAllTransientProbabilities(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::BitVector const& initialStates,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates,
+    std::vector<double> const& timeBounds);
 
 template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                                             std::vector<double> const& exitRates);
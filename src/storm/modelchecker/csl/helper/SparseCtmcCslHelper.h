@@ -108,6 +108,27 @@ class SparseCtmcCslHelper {
                                                                    storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
                                                                    double timeBound);
 
+    /*!
+     * Computes the transient probabilities for each of the given time bounds, where the psi states are made absorbing.
+     * All time bounds are handled in a single uniformization sweep, i.e., the matrix-vector multiplications are shared among all time bounds.
+     *
+     * @return The vector of transient probabilities for each time bound (in the order of the given time bounds).
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeAllTransientProbabilities(Environment const& env,
+                                                                                storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                storm::storage::BitVector const& initialStates,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                storm::storage::BitVector const& psiStates,
+                                                                                std::vector<ValueType> const& exitRates, std::vector<double> const& timeBounds);
+    template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeAllTransientProbabilities(Environment const& env,
+                                                                                storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                storm::storage::BitVector const& initialStates,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                storm::storage::BitVector const& psiStates,
+                                                                                std::vector<ValueType> const& exitRates, std::vector<double> const& timeBounds);
+
     /*!
      * Computes the matrix representing the transitions of the uniformized CTMC.
      *
@@ -134,6 +155,8 @@ class SparseCtmcCslHelper {
      * @param epsilon The precision used for computing the truncation points
      * @tparam useMixedPoissonProbabilities If set to true, instead of taking the poisson probabilities,  mixed
      * poisson probabilities are used.
+     * @note If the Krylov method is selected in the environment, the computation is delegated to computeTransientProbabilitiesKrylov
+     * (unless mixed poisson probabilities are used).
      * @return The vector of transient probabilities.
      */
     template<typename ValueType, bool useMixedPoissonProbabilities = false,
@@ -142,6 +165,44 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for several time bounds at once. Compared to invoking computeTransientProbabilities for each time bound,
+     * the matrix-vector multiplications are only performed once (up to the right truncation point of the largest time bound) and the Fox-Glynn
+     * weighted iterates are accumulated into the results of all time bounds simultaneously.
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+     * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+     * @param timeBounds The time bounds to use.
+     * @param uniformizationRate The used uniformization rate.
+     * @param values A vector mapping each state to an initial probability.
+     * @param epsilon The precision used for computing the truncation points
+     * @note If the Krylov method is selected in the environment, each time bound is handled by computeTransientProbabilitiesKrylov.
+     * @return The vector of transient probabilities for each time bound (in the order of the given time bounds).
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilitiesForTimeBounds(
+        Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+        std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
+
+    /*!
+     * Computes the transient probabilities using a Krylov subspace method instead of uniformization. Rather than performing a number of
+     * matrix-vector multiplications that is linear in timeBound * uniformizationRate, the step size is adapted to the required precision,
+     * which is beneficial for stiff CTMCs.
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each (uniformization) step. If this is not supposed to be used, it can be set to nullptr.
+     * @param timeBound The time bound to use.
+     * @param uniformizationRate The used uniformization rate.
+     * @param values A vector mapping each state to an initial probability.
+     * @param epsilon The (approximate) bound on the absolute error of the result.
+     * @return The vector of transient probabilities.
+     */
+    template<typename ValueType>
+    static std::vector<ValueType> computeTransientProbabilitiesKrylov(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                      std::vector<ValueType> const* addVector, ValueType timeBound,
+                                                                      ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
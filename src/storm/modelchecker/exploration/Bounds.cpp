@@ -6,6 +6,49 @@ namespace storm {
 namespace modelchecker {
 namespace exploration_detail {
 
+// The bounds do not guard any other data, so relaxed atomic accesses suffice. The structure of the explored model
+// (including the number of bounds) is synchronized by the lock of the exploration.
+
+template<typename StateType, typename ValueType>
+Bounds<StateType, ValueType>::AtomicBounds::AtomicBounds(std::pair<ValueType, ValueType> const& values) : lower(values.first), upper(values.second) {
+    // Intentionally left empty.
+}
+
+template<typename StateType, typename ValueType>
+Bounds<StateType, ValueType>::AtomicBounds::AtomicBounds(AtomicBounds const& other)
+    : lower(other.lower.load(std::memory_order_relaxed)), upper(other.upper.load(std::memory_order_relaxed)) {
+    // Intentionally left empty.
+}
+
+template<typename StateType, typename ValueType>
+typename Bounds<StateType, ValueType>::AtomicBounds& Bounds<StateType, ValueType>::AtomicBounds::operator=(AtomicBounds const& other) {
+    lower.store(other.lower.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    upper.store(other.upper.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+}
+
+template<typename StateType, typename ValueType>
+bool Bounds<StateType, ValueType>::raiseTo(std::atomic<ValueType>& bound, ValueType const& value) {
+    ValueType oldValue = bound.load(std::memory_order_relaxed);
+    while (oldValue < value) {
+        if (bound.compare_exchange_weak(oldValue, value, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename StateType, typename ValueType>
+bool Bounds<StateType, ValueType>::lowerTo(std::atomic<ValueType>& bound, ValueType const& value) {
+    ValueType oldValue = bound.load(std::memory_order_relaxed);
+    while (value < oldValue) {
+        if (bound.compare_exchange_weak(oldValue, value, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template<typename StateType, typename ValueType>
 std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::getBoundsForState(
     StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const {
@@ -13,7 +56,7 @@ std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::getBoundsForState(
     if (index == explorationInformation.getUnexploredMarker()) {
         return std::make_pair(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
     } else {
-        return boundsPerState[index];
+        return std::make_pair(getLowerBoundForRowGroup(index), getUpperBoundForRowGroup(index));
     }
 }
 
@@ -29,8 +72,8 @@ ValueType Bounds<StateType, ValueType>::getLowerBoundForState(StateType const& s
 }
 
 template<typename StateType, typename ValueType>
-ValueType const& Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
-    return boundsPerState[rowGroup].first;
+ValueType Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
+    return boundsPerState[rowGroup].lower.load(std::memory_order_relaxed);
 }
 
 template<typename StateType, typename ValueType>
@@ -45,27 +88,27 @@ ValueType Bounds<StateType, ValueType>::getUpperBoundForState(StateType const& s
 }
 
 template<typename StateType, typename ValueType>
-ValueType const& Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
-    return boundsPerState[rowGroup].second;
+ValueType Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
+    return boundsPerState[rowGroup].upper.load(std::memory_order_relaxed);
 }
 
 template<typename StateType, typename ValueType>
-std::pair<ValueType, ValueType> const& Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
-    return boundsPerAction[action];
+std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
+    return std::make_pair(getLowerBoundForAction(action), getUpperBoundForAction(action));
 }
 
 template<typename StateType, typename ValueType>
-ValueType const& Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
-    return boundsPerAction[action].first;
+ValueType Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
+    return boundsPerAction[action].lower.load(std::memory_order_relaxed);
 }
 
 template<typename StateType, typename ValueType>
-ValueType const& Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
-    return boundsPerAction[action].second;
+ValueType Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
+    return boundsPerAction[action].upper.load(std::memory_order_relaxed);
 }
 
 template<typename StateType, typename ValueType>
-ValueType const& Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
+ValueType Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
     if (direction == storm::OptimizationDirection::Maximize) {
         return getUpperBoundForAction(action);
     } else {
@@ -82,12 +125,12 @@ ValueType Bounds<StateType, ValueType>::getDifferenceOfStateBounds(StateType con
 
 template<typename StateType, typename ValueType>
 void Bounds<StateType, ValueType>::initializeBoundsForNextState(std::pair<ValueType, ValueType> const& vals) {
-    boundsPerState.push_back(vals);
+    boundsPerState.emplace_back(vals);
 }
 
 template<typename StateType, typename ValueType>
 void Bounds<StateType, ValueType>::initializeBoundsForNextAction(std::pair<ValueType, ValueType> const& vals) {
-    boundsPerAction.push_back(vals);
+    boundsPerAction.emplace_back(vals);
 }
 
 template<typename StateType, typename ValueType>
@@ -98,7 +141,7 @@ void Bounds<StateType, ValueType>::setLowerBoundForState(StateType const& state,
 
 template<typename StateType, typename ValueType>
 void Bounds<StateType, ValueType>::setLowerBoundForRowGroup(StateType const& group, ValueType const& value) {
-    boundsPerState[group].first = value;
+    boundsPerState[group].lower.store(value, std::memory_order_relaxed);
 }
 
 template<typename StateType, typename ValueType>
@@ -109,12 +152,12 @@ void Bounds<StateType, ValueType>::setUpperBoundForState(StateType const& state,
 
 template<typename StateType, typename ValueType>
 void Bounds<StateType, ValueType>::setUpperBoundForRowGroup(StateType const& group, ValueType const& value) {
-    boundsPerState[group].second = value;
+    boundsPerState[group].upper.store(value, std::memory_order_relaxed);
 }
 
 template<typename StateType, typename ValueType>
 void Bounds<StateType, ValueType>::setBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values) {
-    boundsPerAction[action] = values;
+    boundsPerAction[action] = AtomicBounds(values);
 }
 
 template<typename StateType, typename ValueType>
@@ -126,31 +169,37 @@ void Bounds<StateType, ValueType>::setBoundsForState(StateType const& state, Exp
 
 template<typename StateType, typename ValueType>
 void Bounds<StateType, ValueType>::setBoundsForRowGroup(StateType const& rowGroup, std::pair<ValueType, ValueType> const& values) {
-    boundsPerState[rowGroup] = values;
+    boundsPerState[rowGroup] = AtomicBounds(values);
 }
 
 template<typename StateType, typename ValueType>
 bool Bounds<StateType, ValueType>::setLowerBoundOfStateIfGreaterThanOld(StateType const& state,
                                                                         ExplorationInformation<StateType, ValueType> const& explorationInformation,
                                                                         ValueType const& newLowerValue) {
-    StateType const& rowGroup = explorationInformation.getRowGroup(state);
-    if (boundsPerState[rowGroup].first < newLowerValue) {
-        boundsPerState[rowGroup].first = newLowerValue;
-        return true;
-    }
-    return false;
+    return setLowerBoundOfRowGroupIfGreaterThanOld(explorationInformation.getRowGroup(state), newLowerValue);
 }
 
 template<typename StateType, typename ValueType>
 bool Bounds<StateType, ValueType>::setUpperBoundOfStateIfLessThanOld(StateType const& state,
                                                                      ExplorationInformation<StateType, ValueType> const& explorationInformation,
                                                                      ValueType const& newUpperValue) {
-    StateType const& rowGroup = explorationInformation.getRowGroup(state);
-    if (newUpperValue < boundsPerState[rowGroup].second) {
-        boundsPerState[rowGroup].second = newUpperValue;
-        return true;
-    }
-    return false;
+    return setUpperBoundOfRowGroupIfLessThanOld(explorationInformation.getRowGroup(state), newUpperValue);
+}
+
+template<typename StateType, typename ValueType>
+bool Bounds<StateType, ValueType>::setLowerBoundOfRowGroupIfGreaterThanOld(StateType const& rowGroup, ValueType const& newLowerValue) {
+    return raiseTo(boundsPerState[rowGroup].lower, newLowerValue);
+}
+
+template<typename StateType, typename ValueType>
+bool Bounds<StateType, ValueType>::setUpperBoundOfRowGroupIfLessThanOld(StateType const& rowGroup, ValueType const& newUpperValue) {
+    return lowerTo(boundsPerState[rowGroup].upper, newUpperValue);
+}
+
+template<typename StateType, typename ValueType>
+void Bounds<StateType, ValueType>::tightenBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values) {
+    raiseTo(boundsPerAction[action].lower, values.first);
+    lowerTo(boundsPerAction[action].upper, values.second);
 }
 
 template class Bounds<uint32_t, double>;
@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 
+#include <atomic>
 #include <utility>
 #include <vector>
 
@@ -15,6 +16,10 @@ namespace exploration_detail {
 template<typename StateType, typename ValueType>
 class ExplorationInformation;
 
+/*!
+ * Stores the lower and upper bounds of the explored states and actions. The bounds may be read and tightened
+ * concurrently, but adding bounds and setting them unconditionally requires exclusive access.
+ */
 template<typename StateType, typename ValueType>
 class Bounds {
    public:
@@ -24,19 +29,19 @@ class Bounds {
 
     ValueType getLowerBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
 
-    ValueType const& getLowerBoundForRowGroup(StateType const& rowGroup) const;
+    ValueType getLowerBoundForRowGroup(StateType const& rowGroup) const;
 
     ValueType getUpperBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
 
-    ValueType const& getUpperBoundForRowGroup(StateType const& rowGroup) const;
+    ValueType getUpperBoundForRowGroup(StateType const& rowGroup) const;
 
-    std::pair<ValueType, ValueType> const& getBoundsForAction(ActionType const& action) const;
+    std::pair<ValueType, ValueType> getBoundsForAction(ActionType const& action) const;
 
-    ValueType const& getLowerBoundForAction(ActionType const& action) const;
+    ValueType getLowerBoundForAction(ActionType const& action) const;
 
-    ValueType const& getUpperBoundForAction(ActionType const& action) const;
+    ValueType getUpperBoundForAction(ActionType const& action) const;
 
-    ValueType const& getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
+    ValueType getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
 
     ValueType getDifferenceOfStateBounds(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
 
@@ -67,9 +72,32 @@ class Bounds {
     bool setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation,
                                            ValueType const& newUpperValue);
 
+    bool setLowerBoundOfRowGroupIfGreaterThanOld(StateType const& rowGroup, ValueType const& newLowerValue);
+
+    bool setUpperBoundOfRowGroupIfLessThanOld(StateType const& rowGroup, ValueType const& newUpperValue);
+
+    /*!
+     * Raises the lower and lowers the upper bound of the action to the given values (if they are tighter).
+     */
+    void tightenBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values);
+
    private:
-    std::vector<std::pair<ValueType, ValueType>> boundsPerState;
-    std::vector<std::pair<ValueType, ValueType>> boundsPerAction;
+    // A pair of bounds that can be read and tightened concurrently. Copying is only needed while the vectors grow,
+    // which happens exclusively, and therefore does not need to be atomic as a whole.
+    struct AtomicBounds {
+        AtomicBounds(std::pair<ValueType, ValueType> const& values);
+        AtomicBounds(AtomicBounds const& other);
+        AtomicBounds& operator=(AtomicBounds const& other);
+
+        std::atomic<ValueType> lower;
+        std::atomic<ValueType> upper;
+    };
+
+    static bool raiseTo(std::atomic<ValueType>& bound, ValueType const& value);
+    static bool lowerTo(std::atomic<ValueType>& bound, ValueType const& value);
+
+    std::vector<AtomicBounds> boundsPerState;
+    std::vector<AtomicBounds> boundsPerAction;
 };
 
 }  // namespace exploration_detail
@@ -45,10 +45,17 @@ void ExplorationInformation<StateType, ValueType>::removeUnexploredState(const_i
 
 template<typename StateType, typename ValueType>
 void ExplorationInformation<StateType, ValueType>::addUnexploredState(StateType const& stateId, storm::generator::CompressedState const& compressedState) {
-    stateToRowGroupMapping.push_back(unexploredMarker);
+    addDiscoveredStates(stateId + 1);
     unexploredStates[stateId] = compressedState;
 }
 
+template<typename StateType, typename ValueType>
+void ExplorationInformation<StateType, ValueType>::addDiscoveredStates(std::size_t const& numberOfStates) {
+    if (stateToRowGroupMapping.size() < numberOfStates) {
+        stateToRowGroupMapping.resize(numberOfStates, unexploredMarker);
+    }
+}
+
 template<typename StateType, typename ValueType>
 void ExplorationInformation<StateType, ValueType>::assignStateToRowGroup(StateType const& state, ActionType const& rowGroup) {
     stateToRowGroupMapping[state] = rowGroup;
@@ -169,25 +176,13 @@ bool ExplorationInformation<StateType, ValueType>::minimize() const {
 
 template<typename StateType, typename ValueType>
 bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveExplorationSteps(
-    std::size_t& numberExplorationStepsSinceLastPrecomputation) const {
-    bool result = numberExplorationStepsSinceLastPrecomputation > numberOfExplorationStepsUntilPrecomputation;
-    if (result) {
-        numberExplorationStepsSinceLastPrecomputation = 0;
-    }
-    return result;
+    std::size_t numberOfExplorationStepsSinceLastPrecomputation) const {
+    return numberOfExplorationStepsSinceLastPrecomputation > numberOfExplorationStepsUntilPrecomputation;
 }
 
 template<typename StateType, typename ValueType>
-bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveSampledPaths(std::size_t& numberOfSampledPathsSinceLastPrecomputation) const {
-    if (!numberOfSampledPathsUntilPrecomputation) {
-        return false;
-    } else {
-        bool result = numberOfSampledPathsSinceLastPrecomputation > numberOfSampledPathsUntilPrecomputation.get();
-        if (result) {
-            numberOfSampledPathsSinceLastPrecomputation = 0;
-        }
-        return result;
-    }
+bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveSampledPaths(std::size_t numberOfSampledPathsSinceLastPrecomputation) const {
+    return numberOfSampledPathsUntilPrecomputation && numberOfSampledPathsSinceLastPrecomputation > numberOfSampledPathsUntilPrecomputation.get();
 }
 
 template<typename StateType, typename ValueType>
@@ -38,6 +38,11 @@ class ExplorationInformation {
 
     void addUnexploredState(StateType const& stateId, storm::generator::CompressedState const& compressedState);
 
+    // Makes all states with an index below the given number known without making them available for exploration. This
+    // is needed if states are discovered concurrently, as a state may be the successor of an explored state before the
+    // thread that discovered it added it as unexplored state.
+    void addDiscoveredStates(std::size_t const& numberOfStates);
+
     void assignStateToRowGroup(StateType const& state, ActionType const& rowGroup);
 
     StateType assignStateToNextRowGroup(StateType const& state);
@@ -84,9 +89,9 @@ class ExplorationInformation {
 
     bool minimize() const;
 
-    bool performPrecomputationExcessiveExplorationSteps(std::size_t& numberExplorationStepsSinceLastPrecomputation) const;
+    bool performPrecomputationExcessiveExplorationSteps(std::size_t numberOfExplorationStepsSinceLastPrecomputation) const;
 
-    bool performPrecomputationExcessiveSampledPaths(std::size_t& numberOfSampledPathsSinceLastPrecomputation) const;
+    bool performPrecomputationExcessiveSampledPaths(std::size_t numberOfSampledPathsSinceLastPrecomputation) const;
 
     bool useLocalPrecomputation() const;
 
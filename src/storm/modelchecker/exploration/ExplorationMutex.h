@@ -0,0 +1,56 @@
+#ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_EXPLORATIONMUTEX_H_
+#define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_EXPLORATIONMUTEX_H_
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <thread>
+
+namespace storm {
+namespace modelchecker {
+namespace exploration_detail {
+
+/*!
+ * Guards the explored fragment of the model that is shared by all threads sampling paths. Sampling paths and updating
+ * bounds only requires shared access, whereas adding states and performing precomputations requires exclusive access.
+ * As the underlying shared mutex may prefer readers, threads that acquire shared access first wait for all pending
+ * requests for exclusive access. This way, a thread that wants to add a state is not starved by the others.
+ *
+ * The class satisfies the requirements of std::unique_lock and std::shared_lock.
+ */
+class ExplorationMutex {
+   public:
+    void lock() {
+        ++pendingExclusiveAccesses;
+        mutex.lock();
+        --pendingExclusiveAccesses;
+    }
+
+    void unlock() {
+        mutex.unlock();
+    }
+
+    void lock_shared() {
+        while (pendingExclusiveAccesses.load() > 0) {
+            std::this_thread::yield();
+        }
+        mutex.lock_shared();
+    }
+
+    void unlock_shared() {
+        mutex.unlock_shared();
+    }
+
+   private:
+    // The mutex that actually provides the shared and exclusive access.
+    std::shared_mutex mutex;
+
+    // The number of threads waiting for exclusive access.
+    std::atomic<uint64_t> pendingExclusiveAccesses{0};
+};
+
+}  // namespace exploration_detail
+}  // namespace modelchecker
+}  // namespace storm
+
+#endif /* STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_EXPLORATIONMUTEX_H_ */
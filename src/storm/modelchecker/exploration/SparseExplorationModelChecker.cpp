@@ -1,7 +1,15 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include <boost/optional.hpp>
+
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
+#include "storm/modelchecker/exploration/ExplorationMutex.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/modelchecker/exploration/Statistics.h"
 
@@ -12,6 +20,7 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SparseMatrix.h"
 
+#include "storm/storage/jani/Model.h"
 #include "storm/storage/prism/Program.h"
 
 #include "storm/logic/FragmentSpecification.h"
@@ -31,6 +40,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/prism.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -40,12 +50,29 @@ namespace modelchecker {
 
 template<typename ModelType, typename StateType>
 SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program)
-    : program(program.substituteConstantsFormulas()),
-      randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
-      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+    : SparseExplorationModelChecker(storm::storage::SymbolicModelDescription(program)) {
     // Intentionally left empty.
 }
 
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::storage::SymbolicModelDescription const& model)
+    : randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
+      numberOfThreads(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()),
+      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+    STORM_LOG_THROW(!model.hasUndefinedConstants(), storm::exceptions::InvalidArgumentException,
+                    "The exploration engine requires all constants to be defined.");
+    if (model.isPrismProgram()) {
+        this->model = storm::storage::SymbolicModelDescription(model.asPrismProgram().substituteConstantsFormulas());
+    } else {
+        this->model = storm::storage::SymbolicModelDescription(model.asJaniModel().substituteConstantsFunctions());
+    }
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    this->numberOfThreads = numberOfThreads;
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
     storm::logic::Formula const& formula = checkTask.getFormula();
@@ -59,7 +86,8 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
     storm::logic::UntilFormula const& untilFormula = checkTask.getFormula();
     storm::logic::Formula const& conditionFormula = untilFormula.getLeftSubformula();
     storm::logic::Formula const& targetFormula = untilFormula.getRightSubformula();
-    STORM_LOG_THROW(program.isDeterministicModel() || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+    STORM_LOG_THROW(model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC || checkTask.isOptimizationDirectionSet(),
+                    storm::exceptions::InvalidPropertyException,
                     "For nondeterministic systems, an optimization direction (min/max) must be given in the property.");
 
     ExplorationInformation<StateType, ValueType> explorationInformation(checkTask.isOptimizationDirectionSet() ? checkTask.getOptimizationDirection()
@@ -68,62 +96,127 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
     // The first row group starts at action 0.
     explorationInformation.newRowGroup(0);
 
-    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
-    StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation,
-                                                          conditionFormula.toExpression(program.getManager(), labelToExpressionMapping),
-                                                          targetFormula.toExpression(program.getManager(), labelToExpressionMapping));
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = getLabelToExpressionMapping();
 
     // Compute and return result.
-    std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+    std::tuple<StateType, ValueType, ValueType> boundsForInitialState =
+        performExploration(explorationInformation, conditionFormula.toExpression(model.getManager(), labelToExpressionMapping),
+                           targetFormula.toExpression(model.getManager(), labelToExpressionMapping));
     return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
 }
 
 template<typename ModelType, typename StateType>
 std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performExploration(
-    StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation) const {
+    ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation, storm::expressions::Expression const& conditionStateExpression,
+    storm::expressions::Expression const& targetStateExpression) const {
     // Generate the initial state so we know where to start the simulation.
-    stateGeneration.computeInitialStates();
-    STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
+    std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>> stateGenerations;
+    stateGenerations.push_back(std::make_unique<StateGeneration<StateType, ValueType>>(model, conditionStateExpression, targetStateExpression));
+    stateGenerations.front()->computeInitialStates();
+    STORM_LOG_THROW(stateGenerations.front()->getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
                     "Currently only models with one initial state are supported by the exploration engine.");
-    StateType initialStateIndex = stateGeneration.getFirstInitialState();
+    stateGenerations.front()->addNewStatesAsUnexplored(explorationInformation);
+    StateType initialStateIndex = stateGenerations.front()->getFirstInitialState();
+
+    // Every thread needs its own state generation and random number generator. The state generations are created
+    // before any thread starts, as they share the expression manager of the model.
+    uint64_t const numberOfWorkers = getNumberOfWorkers();
+    std::vector<std::default_random_engine> randomGenerators;
+    for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+        if (worker > 0) {
+            stateGenerations.push_back(std::make_unique<StateGeneration<StateType, ValueType>>(model, *stateGenerations.front()));
+        }
+        randomGenerators.emplace_back(randomGenerator());
+    }
 
     // Create a structure that holds the bounds for the states and actions.
     Bounds<StateType, ValueType> bounds;
 
-    // Create a stack that is used to track the path we sampled.
-    StateActionStack stack;
-
-    // Now perform the actual sampling.
+    // Now perform the actual sampling. The explored fragment of the model, the bounds and the statistics are shared by
+    // all threads. Sampling paths and updating the (atomic) bounds only requires shared access, whereas adding states
+    // and precomputations (that may collapse ECs) require exclusive access.
     Statistics<StateType, ValueType> stats;
-    bool convergenceCriterionMet = false;
-    while (!convergenceCriterionMet) {
-        bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
-
-        stats.sampledPath();
-        stats.updateMaxPathLength(stack.size());
-
-        // If a terminal state was found, we update the probabilities along the path contained in the stack.
-        if (result) {
-            // Update the bounds along the path to the terminal state.
-            STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
-            updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
-        } else {
-            // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
-            // case, we cannot update the probabilities.
-            STORM_LOG_TRACE("Did not find terminal state.");
+    ExplorationMutex explorationMutex;
+    std::atomic<bool> convergenceCriterionMet(false);
+    std::vector<std::exception_ptr> exceptions(numberOfWorkers);
+
+    auto samplePaths = [&](uint64_t worker) {
+        try {
+            // Create a stack that is used to track the path we sampled.
+            StateActionStack stack;
+
+            while (!convergenceCriterionMet.load()) {
+                // The shared lock is released after every path, so pending requests for exclusive access are served.
+                std::shared_lock<ExplorationMutex> lock(explorationMutex);
+                SampledPathResult result = samplePathFromInitialState(initialStateIndex, *stateGenerations[worker], explorationInformation, stack, bounds,
+                                                                      stats, randomGenerators[worker], lock);
+
+                // If the search was aborted because of another thread, e.g. because it expands a state of the path, the
+                // path does not count as a sampled path. We give the other thread the chance to finish and sample anew.
+                if (result == SampledPathResult::AbortedByContention) {
+                    STORM_LOG_TRACE("Aborted path because of another thread.");
+                    lock.unlock();
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                stats.sampledPath();
+                stats.updateMaxPathLength(stack.size());
+
+                // If a terminal state was found, we update the probabilities along the path contained in the stack.
+                if (result == SampledPathResult::TerminalState) {
+                    // Update the bounds along the path to the terminal state.
+                    STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                    updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+                } else {
+                    // If not terminal state was found, the search aborted because of an EC-detection. In this case, we
+                    // cannot update the probabilities.
+                    STORM_LOG_TRACE("Did not find terminal state.");
+                }
+
+                STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates
+                                                      << " explored, " << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
+                STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", "
+                                                                 << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
+                ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+                STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
+                if (comparator.isZero(difference)) {
+                    convergenceCriterionMet.store(true);
+                }
+
+                // If the number of sampled paths exceeds a certain threshold, do a precomputation.
+                if (!convergenceCriterionMet.load() &&
+                    explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+                    lock.unlock();
+                    std::unique_lock<ExplorationMutex> exclusiveLock(explorationMutex);
+
+                    // Another thread may have performed the precomputation in the meantime.
+                    if (explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+                        stats.pathsSampledSinceLastPrecomputation = 0;
+                        performPrecomputation(stack, explorationInformation, bounds, stats);
+                    }
+                }
+            }
+        } catch (...) {
+            exceptions[worker] = std::current_exception();
+            convergenceCriterionMet.store(true);
         }
+    };
 
-        STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates << " explored, "
-                                              << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
-        STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", "
-                                                         << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
-        ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
-        STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
-        convergenceCriterionMet = comparator.isZero(difference);
-
-        // If the number of sampled paths exceeds a certain threshold, do a precomputation.
-        if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
-            performPrecomputation(stack, explorationInformation, bounds, stats);
+    if (numberOfWorkers > 1) {
+        STORM_LOG_DEBUG("Sampling paths using " << numberOfWorkers << " threads.");
+    }
+    std::vector<std::thread> threads;
+    for (uint64_t worker = 1; worker < numberOfWorkers; ++worker) {
+        threads.emplace_back(samplePaths, worker);
+    }
+    samplePaths(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
         }
     }
 
@@ -137,12 +230,15 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
 }
 
 template<typename ModelType, typename StateType>
-bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
-                                                                                     ExplorationInformation<StateType, ValueType>& explorationInformation,
-                                                                                     StateActionStack& stack, Bounds<StateType, ValueType>& bounds,
-                                                                                     Statistics<StateType, ValueType>& stats) const {
+typename SparseExplorationModelChecker<ModelType, StateType>::SampledPathResult SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(
+    StateType const& initialStateIndex, StateGeneration<StateType, ValueType>& stateGeneration,
+    ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds,
+    Statistics<StateType, ValueType>& stats, std::default_random_engine& randomGenerator, std::shared_lock<ExplorationMutex>& lock) const {
     // Start the search from the initial state.
-    stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
+    stack.push_back(std::make_pair(initialStateIndex, 0));
+
+    // A precomputation (of another thread) may collapse ECs and thereby move the actions stored in the stack.
+    std::size_t const numberOfPrecomputationsAtStart = stats.numberOfPrecomputations;
 
     // As long as we didn't find a terminal (accepting or rejecting) state in the search, sample a new successor.
     bool foundTerminalState = false;
@@ -151,25 +247,51 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         STORM_LOG_TRACE("State on top of stack is: " << currentStateId << ".");
 
         // If the state is not yet explored, we need to retrieve its behaviors.
-        auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
-        if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+        if (explorationInformation.isUnexplored(currentStateId)) {
             STORM_LOG_TRACE("State was not yet explored.");
 
-            // Explore the previously unexplored state.
-            storm::generator::CompressedState const& compressedState = unexploredIt->second;
-            foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats);
-            if (foundTerminalState) {
-                STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
+            // We remove the state from the unexplored states first, so other threads do not explore it as well. As
+            // this changes the explored fragment, it requires exclusive access.
+            lock.unlock();
+            boost::optional<storm::generator::CompressedState> compressedState;
+            {
+                std::unique_lock<ExplorationMutex> exclusiveLock(*lock.mutex());
+                auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                    compressedState = unexploredIt->second;
+                    explorationInformation.removeUnexploredState(unexploredIt);
+                }
+            }
+
+            if (compressedState) {
+                foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState.get(), explorationInformation, bounds, stats, lock);
+                if (foundTerminalState) {
+                    STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
+                }
+            } else {
+                lock.lock();
+            }
+
+            if (stats.numberOfPrecomputations != numberOfPrecomputationsAtStart) {
+                STORM_LOG_TRACE("Aborting the search, because another thread performed a precomputation.");
+                stack.clear();
+                return SampledPathResult::AbortedByContention;
             }
-            explorationInformation.removeUnexploredState(unexploredIt);
-        } else {
-            // If the state was already explored, we check whether it is a terminal state or not.
-            if (explorationInformation.isTerminal(currentStateId)) {
-                STORM_LOG_TRACE("Found already explored terminal state: " << currentStateId << ".");
-                foundTerminalState = true;
+            if (!compressedState && explorationInformation.isUnexplored(currentStateId)) {
+                // The state is currently expanded by another thread (or the thread that discovered it did not yet make
+                // it available), so we cannot continue the path.
+                STORM_LOG_TRACE("Aborting the search, because state " << currentStateId << " is not yet available.");
+                stack.clear();
+                return SampledPathResult::AbortedByContention;
             }
         }
 
+        // If the state was already explored (possibly by another thread), we check whether it is a terminal state or not.
+        if (!foundTerminalState && explorationInformation.isTerminal(currentStateId)) {
+            STORM_LOG_TRACE("Found already explored terminal state: " << currentStateId << ".");
+            foundTerminalState = true;
+        }
+
         // Notify the stats about the performed exploration step.
         stats.explorationStep();
 
@@ -177,11 +299,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         if (!foundTerminalState) {
             // At this point, we can be sure that the state was expanded and that we can sample according to the
             // probabilities in the matrix.
-            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
             stack.back().second = chosenAction;
             STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
 
-            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
             STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
 
             // Put the successor state and a dummy action on top of the stack.
@@ -189,25 +311,53 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
 
             // If the number of exploration steps exceeds a certain threshold, do a precomputation.
             if (explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation)) {
-                performPrecomputation(stack, explorationInformation, bounds, stats);
+                // Precomputations need exclusive access. If another thread performed a precomputation in the meantime,
+                // the counter was reset and the path may be outdated, so we do not perform another one.
+                bool performedPrecomputation = false;
+                lock.unlock();
+                {
+                    std::unique_lock<ExplorationMutex> exclusiveLock(*lock.mutex());
+                    if (stats.numberOfPrecomputations == numberOfPrecomputationsAtStart) {
+                        stats.explorationStepsSinceLastPrecomputation = 0;
+                        performPrecomputation(stack, explorationInformation, bounds, stats);
+                        performedPrecomputation = true;
+                    }
+                }
+                lock.lock();
 
                 STORM_LOG_TRACE("Aborting the search after precomputation.");
                 stack.clear();
-                break;
+                return performedPrecomputation ? SampledPathResult::AbortedAfterPrecomputation : SampledPathResult::AbortedByContention;
             }
         }
     }
 
-    return foundTerminalState;
+    return SampledPathResult::TerminalState;
 }
 
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId,
                                                                        storm::generator::CompressedState const& currentState,
                                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
-                                                                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+                                                                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats,
+                                                                       std::shared_lock<ExplorationMutex>& lock) const {
     bool isTerminalState = false;
-    bool isTargetState = false;
+
+    // Before generating the behavior of the state, we need to determine whether it's a target state that
+    // does not need to be expanded. If it needs to be expanded, we use the generator to retrieve the behavior of the
+    // new state. As this only involves the state generation of the current thread, other threads may proceed meanwhile.
+    STORM_LOG_ASSERT(!lock.owns_lock(), "Expected the lock to be released while exploring a state.");
+    stateGeneration.load(currentState);
+    bool isTargetState = stateGeneration.isTargetState();
+    bool isConditionState = !isTargetState && stateGeneration.isConditionState();
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
+    if (isConditionState) {
+        behavior = stateGeneration.expand();
+    }
+
+    // Adding the state to the explored fragment requires exclusive access.
+    std::unique_lock<ExplorationMutex> exclusiveLock(*lock.mutex());
+    stateGeneration.addNewStatesAsUnexplored(explorationInformation);
 
     ++stats.numberOfExploredStates;
 
@@ -219,18 +369,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
     // all states that have been assigned to a row-group.
     bounds.initializeBoundsForNextState();
 
-    // Before generating the behavior of the state, we need to determine whether it's a target state that
-    // does not need to be expanded.
-    stateGeneration.load(currentState);
-    if (stateGeneration.isTargetState()) {
+    if (isTargetState) {
         ++stats.numberOfTargetStates;
-        isTargetState = true;
         isTerminalState = true;
-    } else if (stateGeneration.isConditionState()) {
+    } else if (isConditionState) {
         STORM_LOG_TRACE("Exploring state.");
-
-        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-        storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
         STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
 
         // Clumsily check whether we have found a state that forms a trivial BMEC.
@@ -309,12 +452,15 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
         explorationInformation.newRowGroup();
     }
 
+    exclusiveLock.unlock();
+    lock.lock();
     return isTerminalState;
 }
 
 template<typename ModelType, typename StateType>
 typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(
-    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds,
+    std::default_random_engine& randomGenerator) const {
     // Determine the values of all available actions.
     std::vector<std::pair<ActionType, ValueType>> actionValues;
     StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -355,8 +501,8 @@ typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseE
 
 template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
-    ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-    Bounds<StateType, ValueType> const& bounds) const {
+    ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& randomGenerator) const {
     std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
@@ -676,8 +822,9 @@ void SparseExplorationModelChecker<ModelType, StateType>::updateProbabilityOfAct
     // Compute the new lower/upper values of the action.
     std::pair<ValueType, ValueType> newBoundsForAction = computeBoundsOfAction(action, explorationInformation, bounds);
 
-    // And set them as the current value.
-    bounds.setBoundsForAction(action, newBoundsForAction);
+    // And set them as the current value. As other threads may update the bounds concurrently, the bounds are only
+    // ever tightened.
+    bounds.tightenBoundsForAction(action, newBoundsForAction);
 
     // Check if we need to update the values for the states.
     if (explorationInformation.maximize()) {
@@ -690,7 +837,7 @@ void SparseExplorationModelChecker<ModelType, StateType>::updateProbabilityOfAct
                                                                                                                 action, explorationInformation, bounds));
             }
 
-            bounds.setUpperBoundForRowGroup(rowGroup, newBoundsForAction.second);
+            bounds.setUpperBoundOfRowGroupIfLessThanOld(rowGroup, newBoundsForAction.second);
         }
     } else {
         bounds.setUpperBoundOfStateIfLessThanOld(state, explorationInformation, newBoundsForAction.second);
@@ -702,7 +849,7 @@ void SparseExplorationModelChecker<ModelType, StateType>::updateProbabilityOfAct
                 newBoundsForAction.first = std::min(newBoundsForAction.first, min);
             }
 
-            bounds.setLowerBoundForRowGroup(rowGroup, newBoundsForAction.first);
+            bounds.setLowerBoundOfRowGroupIfGreaterThanOld(rowGroup, newBoundsForAction.first);
         }
     }
 }
@@ -745,6 +892,31 @@ typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType
     }
 }
 
+template<typename ModelType, typename StateType>
+std::map<std::string, storm::expressions::Expression> SparseExplorationModelChecker<ModelType, StateType>::getLabelToExpressionMapping() const {
+    if (model.isPrismProgram()) {
+        return model.asPrismProgram().getLabelToExpressionMapping();
+    }
+
+    // In JANI models, labels are given by transient boolean variables.
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
+    storm::jani::Model const& janiModel = model.asJaniModel();
+    for (auto const& variable : janiModel.getGlobalVariables().getBooleanVariables()) {
+        if (variable.isTransient()) {
+            labelToExpressionMapping[variable.getName()] = janiModel.getLabelExpression(variable);
+        }
+    }
+    return labelToExpressionMapping;
+}
+
+template<typename ModelType, typename StateType>
+uint64_t SparseExplorationModelChecker<ModelType, StateType>::getNumberOfWorkers() const {
+    if (numberOfThreads == 0) {
+        return std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
+    return numberOfThreads;
+}
+
 template<typename ModelType, typename StateType>
 std::pair<typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::combineBounds(
     storm::OptimizationDirection const& direction, std::pair<ValueType, ValueType> const& bounds1, std::pair<ValueType, ValueType> const& bounds2) const {
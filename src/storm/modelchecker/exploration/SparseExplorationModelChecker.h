@@ -2,9 +2,11 @@
 #define STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 
 #include <random>
+#include <shared_mutex>
 
 #include "storm/modelchecker/AbstractModelChecker.h"
 
+#include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/prism/Program.h"
 
 #include "storm/generator/CompressedState.h"
@@ -35,6 +37,7 @@ template<typename StateType, typename ValueType>
 class Bounds;
 template<typename StateType, typename ValueType>
 struct Statistics;
+class ExplorationMutex;
 }  // namespace exploration_detail
 
 using namespace exploration_detail;
@@ -48,28 +51,56 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
     SparseExplorationModelChecker(storm::prism::Program const& program);
 
+    SparseExplorationModelChecker(storm::storage::SymbolicModelDescription const& model);
+
+    /*!
+     * Sets the number of threads that concurrently sample paths. All threads share the explored part of the model and
+     * the bounds. Zero selects the number of hardware threads.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
 
     virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
                                                                    CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
 
    private:
-    std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
-                                                                   ExplorationInformation<StateType, ValueType>& explorationInformation) const;
-
-    bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
-                                    ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
-                                    Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
-
+    /*!
+     * The possible outcomes of sampling a path.
+     */
+    enum class SampledPathResult {
+        // The path reached a terminal state, so the bounds along the path can be updated.
+        TerminalState,
+        // The path was aborted, because this thread performed a precomputation (that may have collapsed ECs).
+        AbortedAfterPrecomputation,
+        // The path was aborted because of another thread, e.g. because it expands a state of the path or performed a
+        // precomputation. Such paths are not counted as sampled paths.
+        AbortedByContention
+    };
+
+    std::tuple<StateType, ValueType, ValueType> performExploration(ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                   storm::expressions::Expression const& conditionStateExpression,
+                                                                   storm::expressions::Expression const& targetStateExpression) const;
+
+    SampledPathResult samplePathFromInitialState(StateType const& initialStateIndex, StateGeneration<StateType, ValueType>& stateGeneration,
+                                                 ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
+                                                 Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats,
+                                                 std::default_random_engine& randomGenerator, std::shared_lock<ExplorationMutex>& lock) const;
+
+    /*!
+     * Explores the given state, which the calling thread must have removed from the unexplored states. The state is
+     * expanded without holding the lock and added to the explored fragment with exclusive access. Afterwards, the
+     * (previously released) shared lock is held again.
+     */
     bool exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId,
                       storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation,
-                      Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+                      Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::shared_lock<ExplorationMutex>& lock) const;
 
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                   Bounds<StateType, ValueType>& bounds) const;
+                                   Bounds<StateType, ValueType>& bounds, std::default_random_engine& randomGenerator) const;
 
     StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                        Bounds<StateType, ValueType> const& bounds) const;
+                                        Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomGenerator) const;
 
     bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation,
                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -102,12 +133,19 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     std::pair<ValueType, ValueType> combineBounds(storm::OptimizationDirection const& direction, std::pair<ValueType, ValueType> const& bounds1,
                                                   std::pair<ValueType, ValueType> const& bounds2) const;
 
-    // The program that defines the model to check.
-    storm::prism::Program program;
+    std::map<std::string, storm::expressions::Expression> getLabelToExpressionMapping() const;
+
+    uint64_t getNumberOfWorkers() const;
 
-    // The random number generator.
+    // The PRISM program or JANI model that defines the model to check.
+    storm::storage::SymbolicModelDescription model;
+
+    // The random number generator. It is only used to seed the random number generators of the threads.
     mutable std::default_random_engine randomGenerator;
 
+    // The number of threads that sample paths.
+    uint64_t numberOfThreads;
+
     // A comparator used to determine whether values are equal.
     storm::utility::ConstantsComparator<ValueType> comparator;
 };
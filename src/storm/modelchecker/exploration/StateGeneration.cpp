@@ -1,73 +1,104 @@
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
+#include "storm/storage/SymbolicModelDescription.h"
 
 namespace storm {
 namespace modelchecker {
 namespace exploration_detail {
 
 template<typename StateType, typename ValueType>
-StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program const& program,
-                                                       ExplorationInformation<StateType, ValueType>& explorationInformation,
+StateGeneration<StateType, ValueType>::StateGeneration(storm::storage::SymbolicModelDescription const& model,
                                                        storm::expressions::Expression const& conditionStateExpression,
                                                        storm::expressions::Expression const& targetStateExpression)
-    : generator(program),
-      stateStorage(generator.getStateSize()),
-      conditionStateExpression(conditionStateExpression),
-      targetStateExpression(targetStateExpression) {
-    stateToIdCallback = [&explorationInformation, this](storm::generator::CompressedState const& state) -> StateType {
-        StateType newIndex = stateStorage.getNumberOfStates();
-
-        // Check, if the state was already registered.
-        std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
-
-        if (actualIndexBucketPair.first == newIndex) {
-            explorationInformation.addUnexploredState(newIndex, state);
+    : conditionStateExpression(conditionStateExpression), targetStateExpression(targetStateExpression) {
+    createGenerator(model);
+    stateToId = std::make_shared<StateToIdMap>(generator->getStateSize());
+}
+
+template<typename StateType, typename ValueType>
+StateGeneration<StateType, ValueType>::StateGeneration(storm::storage::SymbolicModelDescription const& model,
+                                                       StateGeneration<StateType, ValueType> const& other)
+    : stateToId(other.stateToId),
+      initialStateIndices(other.initialStateIndices),
+      conditionStateExpression(other.conditionStateExpression),
+      targetStateExpression(other.targetStateExpression) {
+    createGenerator(model);
+}
+
+template<typename StateType, typename ValueType>
+void StateGeneration<StateType, ValueType>::createGenerator(storm::storage::SymbolicModelDescription const& model) {
+    if (model.isPrismProgram()) {
+        generator = std::make_unique<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(model.asPrismProgram());
+    } else {
+        generator = std::make_unique<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model.asJaniModel());
+    }
+
+    stateToIdCallback = [this](storm::generator::CompressedState const& state) -> StateType {
+        // Check, if the state was already registered (possibly by another state generation).
+        std::pair<StateType, bool> indexAndInserted = stateToId->findOrAdd(state);
+
+        if (indexAndInserted.second) {
+            newStates.emplace_back(indexAndInserted.first, state);
         }
 
-        return actualIndexBucketPair.first;
+        return indexAndInserted.first;
     };
 }
 
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedState const& state) {
-    generator.load(state);
+    generator->load(state);
 }
 
 template<typename StateType, typename ValueType>
 std::vector<StateType> StateGeneration<StateType, ValueType>::getInitialStates() {
-    return stateStorage.initialStateIndices;
+    return initialStateIndices;
 }
 
 template<typename StateType, typename ValueType>
 storm::generator::StateBehavior<ValueType, StateType> StateGeneration<StateType, ValueType>::expand() {
-    return generator.expand(stateToIdCallback);
+    return generator->expand(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 bool StateGeneration<StateType, ValueType>::isConditionState() const {
-    return generator.satisfies(conditionStateExpression);
+    return generator->satisfies(conditionStateExpression);
 }
 
 template<typename StateType, typename ValueType>
 bool StateGeneration<StateType, ValueType>::isTargetState() const {
-    return generator.satisfies(targetStateExpression);
+    return generator->satisfies(targetStateExpression);
 }
 
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::computeInitialStates() {
-    stateStorage.initialStateIndices = generator.getInitialStates(stateToIdCallback);
+    initialStateIndices = generator->getInitialStates(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 StateType StateGeneration<StateType, ValueType>::getFirstInitialState() const {
-    return stateStorage.initialStateIndices.front();
+    return initialStateIndices.front();
 }
 
 template<typename StateType, typename ValueType>
 std::size_t StateGeneration<StateType, ValueType>::getNumberOfInitialStates() const {
-    return stateStorage.initialStateIndices.size();
+    return initialStateIndices.size();
+}
+
+template<typename StateType, typename ValueType>
+void StateGeneration<StateType, ValueType>::addNewStatesAsUnexplored(ExplorationInformation<StateType, ValueType>& explorationInformation) {
+    for (auto const& indexAndState : newStates) {
+        explorationInformation.addUnexploredState(indexAndState.first, indexAndState.second);
+    }
+    newStates.clear();
+
+    // Other state generations may have discovered states that are already successors of the states expanded by this
+    // one, but that they did not yet add as unexplored states.
+    explorationInformation.addDiscoveredStates(stateToId->size());
 }
 
 template class StateGeneration<uint32_t, double>;
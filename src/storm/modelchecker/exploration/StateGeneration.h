@@ -1,15 +1,17 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 
+#include <memory>
+#include <vector>
+
 #include "storm/generator/CompressedState.h"
-#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/NextStateGenerator.h"
 
-#include "storm/storage/sparse/StateStorage.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 
 namespace storm {
-namespace generator {
-template<typename ValueType, typename StateType>
-class PrismNextStateGenerator;
+namespace storage {
+class SymbolicModelDescription;
 }
 
 namespace modelchecker {
@@ -18,11 +20,20 @@ namespace exploration_detail {
 template<typename StateType, typename ValueType>
 class ExplorationInformation;
 
+// Generates the behavior of states of a PRISM program or JANI model. Multiple objects of this class may share the mapping
+// from states to their indices and be used by different threads concurrently. The states that were discovered by one of
+// the objects are only added to the exploration information by an explicit call to addNewStatesAsUnexplored (which
+// needs to be synchronized by the caller).
 template<typename StateType, typename ValueType>
 class StateGeneration {
    public:
-    StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation,
-                    storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
+    typedef storm::storage::ConcurrentBitVectorHashMap<StateType> StateToIdMap;
+
+    StateGeneration(storm::storage::SymbolicModelDescription const& model, storm::expressions::Expression const& conditionStateExpression,
+                    storm::expressions::Expression const& targetStateExpression);
+
+    // Creates a state generation that shares the mapping from states to indices and the initial states with the given one.
+    StateGeneration(storm::storage::SymbolicModelDescription const& model, StateGeneration<StateType, ValueType> const& other);
 
     void load(storm::generator::CompressedState const& state);
 
@@ -40,11 +51,19 @@ class StateGeneration {
 
     bool isTargetState() const;
 
+    void addNewStatesAsUnexplored(ExplorationInformation<StateType, ValueType>& explorationInformation);
+
    private:
-    storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
+    void createGenerator(storm::storage::SymbolicModelDescription const& model);
+
+    std::unique_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
     std::function<StateType(storm::generator::CompressedState const&)> stateToIdCallback;
 
-    storm::storage::sparse::StateStorage<StateType> stateStorage;
+    std::shared_ptr<StateToIdMap> stateToId;
+    std::vector<StateType> initialStateIndices;
+
+    // The states that were discovered by this object, but were not yet added to the exploration information.
+    std::vector<std::pair<StateType, storm::generator::CompressedState>> newStates;
 
     storm::expressions::Expression conditionStateExpression;
     storm::expressions::Expression targetStateExpression;
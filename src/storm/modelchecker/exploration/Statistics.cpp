@@ -36,7 +36,10 @@ void Statistics<StateType, ValueType>::sampledPath() {
 
 template<typename StateType, typename ValueType>
 void Statistics<StateType, ValueType>::updateMaxPathLength(std::size_t const& currentPathLength) {
-    maxPathLength = std::max(maxPathLength, currentPathLength);
+    std::size_t oldMaxPathLength = maxPathLength.load();
+    while (oldMaxPathLength < currentPathLength && !maxPathLength.compare_exchange_weak(oldMaxPathLength, currentPathLength)) {
+        // Intentionally left empty.
+    }
 }
 
 template<typename StateType, typename ValueType>
@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATISTICS_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATISTICS_H_
 
+#include <atomic>
 #include <cstddef>
 #include <iostream>
 
@@ -11,7 +12,7 @@ namespace exploration_detail {
 template<typename StateType, typename ValueType>
 class ExplorationInformation;
 
-// A struct that keeps track of certain statistics during the exploration.
+// A struct that keeps track of certain statistics during the exploration. The counters may be updated concurrently.
 template<typename StateType, typename ValueType>
 struct Statistics {
     Statistics();
@@ -24,17 +25,17 @@ struct Statistics {
 
     void printToStream(std::ostream& out, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
 
-    std::size_t pathsSampled;
-    std::size_t pathsSampledSinceLastPrecomputation;
-    std::size_t explorationSteps;
-    std::size_t explorationStepsSinceLastPrecomputation;
-    std::size_t maxPathLength;
-    std::size_t numberOfTargetStates;
-    std::size_t numberOfExploredStates;
-    std::size_t numberOfPrecomputations;
-    std::size_t ecDetections;
-    std::size_t failedEcDetections;
-    std::size_t totalNumberOfEcDetected;
+    std::atomic<std::size_t> pathsSampled;
+    std::atomic<std::size_t> pathsSampledSinceLastPrecomputation;
+    std::atomic<std::size_t> explorationSteps;
+    std::atomic<std::size_t> explorationStepsSinceLastPrecomputation;
+    std::atomic<std::size_t> maxPathLength;
+    std::atomic<std::size_t> numberOfTargetStates;
+    std::atomic<std::size_t> numberOfExploredStates;
+    std::atomic<std::size_t> numberOfPrecomputations;
+    std::atomic<std::size_t> ecDetections;
+    std::atomic<std::size_t> failedEcDetections;
+    std::atomic<std::size_t> totalNumberOfEcDetected;
 };
 
 }  // namespace exploration_detail
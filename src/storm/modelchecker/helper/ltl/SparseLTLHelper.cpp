@@ -17,10 +17,82 @@
 
 #include "storm/exceptions/InvalidPropertyException.h"
 
+#include <algorithm>
+
 namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+typedef std::vector<automata::AcceptanceCondition::acceptance_expr::ptr> Conjunction;
+
+/*!
+ * Computes the states that do not violate any Fin-literal of the given conjunction of the acceptance condition (in DNF).
+ */
+storm::storage::BitVector computeAllowedStates(automata::AcceptanceCondition const& acceptance, Conjunction const& conjunction, uint64_t numberOfStates) {
+    storm::storage::BitVector allowed(numberOfStates, true);
+    for (auto const& literal : conjunction) {
+        if (literal->isTRUE()) {
+            // skip
+        } else if (literal->isFALSE()) {
+            allowed.clear();
+            break;
+        } else if (literal->isAtom()) {
+            const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
+            if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
+                // only deal with FIN, ignore INF here
+                const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
+                if (atom.isNegated()) {
+                    // allowed = allowed \ ~accSet = allowed & accSet
+                    allowed &= accSet;
+                } else {
+                    // allowed = allowed \ accSet = allowed & ~accSet
+                    allowed &= ~accSet;
+                }
+            }
+        }
+    }
+    return allowed;
+}
+
+/*!
+ * Checks whether an end component within the allowed states of the given conjunction satisfies its Inf-literals.
+ * @param containsAnyState returns true iff the end component contains one of the given states
+ */
+template<typename ContainsAnyStateFunction>
+bool isAcceptingEndComponent(automata::AcceptanceCondition const& acceptance, Conjunction const& conjunction,
+                             ContainsAnyStateFunction const& containsAnyState) {
+    for (auto const& literal : conjunction) {
+        if (literal->isTRUE()) {
+            // skip
+
+        } else if (literal->isFALSE()) {
+            return false;
+        } else if (literal->isAtom()) {
+            const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
+            const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
+            if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_INF) {
+                if (atom.isNegated()) {
+                    if (!containsAnyState(~accSet)) {
+                        return false;
+                    }
+                } else {
+                    if (!containsAnyState(accSet)) {
+                        return false;
+                    }
+                }
+
+            } else if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
+                // Do only sanity checks here.
+                STORM_LOG_ASSERT(atom.isNegated() ? !containsAnyState(~accSet) : !containsAnyState(accSet),
+                                 "MEC contains Fin-states, which should have been removed");
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
 template<typename ValueType, bool Nondeterministic>
 SparseLTLHelper<ValueType, Nondeterministic>::SparseLTLHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix)
     : _transitionMatrix(transitionMatrix) {
@@ -88,29 +160,7 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
 
     for (auto const& conjunction : dnf) {
         // Determine the set of states of the subMDP that can satisfy the condition, remove all states that would violate Fins in the conjunction.
-        storm::storage::BitVector allowed(transitionMatrix.getRowGroupCount(), true);
-
-        for (auto const& literal : conjunction) {
-            if (literal->isTRUE()) {
-                // skip
-            } else if (literal->isFALSE()) {
-                allowed.clear();
-                break;
-            } else if (literal->isAtom()) {
-                const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
-                if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
-                    // only deal with FIN, ignore INF here
-                    const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
-                    if (atom.isNegated()) {
-                        // allowed = allowed \ ~accSet = allowed & accSet
-                        allowed &= accSet;
-                    } else {
-                        // allowed = allowed \ accSet = allowed & ~accSet
-                        allowed &= ~accSet;
-                    }
-                }
-            }
-        }
+        storm::storage::BitVector allowed = computeAllowedStates(acceptance, conjunction, transitionMatrix.getRowGroupCount());
 
         if (allowed.empty()) {
             // skip
@@ -121,37 +171,8 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
         storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed);
         allMECs += mecs.size();
         for (const auto& mec : mecs) {
-            bool accepting = true;
-            for (auto const& literal : conjunction) {
-                if (literal->isTRUE()) {
-                    // skip
-
-                } else if (literal->isFALSE()) {
-                    accepting = false;
-                    break;
-                } else if (literal->isAtom()) {
-                    const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
-                    const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
-                    if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_INF) {
-                        if (atom.isNegated()) {
-                            if (!mec.containsAnyState(~accSet)) {
-                                accepting = false;
-                                break;
-                            }
-                        } else {
-                            if (!mec.containsAnyState(accSet)) {
-                                accepting = false;
-                                break;
-                            }
-                        }
-
-                    } else if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
-                        // Do only sanity checks here.
-                        STORM_LOG_ASSERT(atom.isNegated() ? !mec.containsAnyState(~accSet) : !mec.containsAnyState(accSet),
-                                         "MEC contains Fin-states, which should have been removed");
-                    }
-                }
-            }
+            bool accepting =
+                isAcceptingEndComponent(acceptance, conjunction, [&mec](storm::storage::BitVector const& states) { return mec.containsAnyState(states); });
 
             if (accepting) {
                 accMECs++;
@@ -196,6 +217,143 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
     return acceptingStates;
 }
 
+template<typename ValueType, bool Nondeterministic>
+storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(automata::AcceptanceCondition const& acceptance,
+                                                                                            transformer::ImplicitDAProduct<ValueType> const& product) {
+    STORM_LOG_INFO("Computing accepting states for acceptance condition " << *acceptance.getAcceptanceExpression());
+    if (acceptance.getAcceptanceExpression()->isTRUE()) {
+        STORM_LOG_INFO(" TRUE -> all states accepting (assumes no deadlock in the model)");
+        return storm::storage::BitVector(product.getNumberOfStates(), true);
+    } else if (acceptance.getAcceptanceExpression()->isFALSE()) {
+        STORM_LOG_INFO(" FALSE -> all states rejecting");
+        return storm::storage::BitVector(product.getNumberOfStates(), false);
+    }
+
+    storm::storage::BitVector acceptingStates(product.getNumberOfStates(), false);
+    std::size_t accMECs = 0;
+    std::size_t allMECs = 0;
+    for (auto const& conjunction : acceptance.extractFromDNF()) {
+        storm::storage::BitVector allowed = computeAllowedStates(acceptance, conjunction, product.getNumberOfStates());
+        if (allowed.empty()) {
+            continue;
+        }
+
+        std::vector<storm::storage::StateBlock> mecs = product.computeMaximalEndComponents(allowed);
+        allMECs += mecs.size();
+        for (auto const& mec : mecs) {
+            auto containsAnyState = [&mec](storm::storage::BitVector const& states) {
+                return std::any_of(mec.begin(), mec.end(), [&states](uint64_t state) { return states.get(state); });
+            };
+            if (isAcceptingEndComponent(acceptance, conjunction, containsAnyState)) {
+                accMECs++;
+                for (auto state : mec) {
+                    acceptingStates.set(state);
+                }
+            }
+        }
+    }
+
+    STORM_LOG_INFO("Found " << acceptingStates.getNumberOfSetBits() << " states in " << accMECs << " accepting MECs (considered " << allMECs << " MECs).");
+    return acceptingStates;
+}
+
+template<typename ValueType, bool Nondeterministic>
+storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingBCCs(automata::AcceptanceCondition const& acceptance,
+                                                                                             transformer::ImplicitDAProduct<ValueType> const& product) {
+    storm::storage::BitVector acceptingStates(product.getNumberOfStates(), false);
+
+    std::size_t checkedBSCCs = 0, acceptingBSCCs = 0, acceptingBSCCStates = 0;
+    for (auto const& scc : product.computeBottomSccs()) {
+        checkedBSCCs++;
+        if (acceptance.isAccepting(scc)) {
+            acceptingBSCCs++;
+            for (auto state : scc) {
+                acceptingStates.set(state);
+                acceptingBSCCStates++;
+            }
+        }
+    }
+    STORM_LOG_INFO("BSCC analysis: " << acceptingBSCCs << " of " << checkedBSCCs << " BSCCs were acceptingStates (" << acceptingBSCCStates
+                                     << " states in acceptingStates BSCCs).");
+    return acceptingStates;
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeImplicitDAProductProbabilities(
+    Environment const& env, transformer::DAProductBuilder const& productBuilder, storm::storage::BitVector const& statesOfInterest) {
+    transformer::ImplicitDAProduct<ValueType> product(this->_transitionMatrix, productBuilder, statesOfInterest);
+
+    STORM_LOG_INFO("Product " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " has " << product.getNumberOfStates()
+                                                                                                         << " states and " << product.getNumberOfChoices()
+                                                                                                         << " choices (transitions are not materialized).");
+
+    // Compute accepting states
+    storm::storage::BitVector acceptingStates;
+    if (Nondeterministic) {
+        STORM_LOG_INFO("Computing MECs and checking for acceptance...");
+        acceptingStates = computeAcceptingECs(*product.getAcceptance(), product);
+    } else {
+        STORM_LOG_INFO("Computing BSCCs and checking for acceptance...");
+        acceptingStates = computeAcceptingBCCs(*product.getAcceptance(), product);
+    }
+
+    std::vector<ValueType> numericResult(this->_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+    if (acceptingStates.empty()) {
+        STORM_LOG_INFO("No accepting states, skipping probability computation.");
+        return numericResult;
+    }
+
+    // Accepting states have probability one and states that can not reach them probability zero. Only the remaining states are materialized.
+    storm::storage::BitVector maybeStates = product.computeStatesReaching(acceptingStates) & ~acceptingStates;
+    std::vector<uint64_t> productStateToSubsystemState = maybeStates.getNumberOfSetBitsBeforeIndices();
+    storm::storage::BitVector subsystemStatesOfInterest(maybeStates.getNumberOfSetBits() + 2, false);
+    for (auto const& modelAndProductState : product.getInitialStates()) {
+        if (acceptingStates.get(modelAndProductState.second)) {
+            numericResult[modelAndProductState.first] = storm::utility::one<ValueType>();
+        } else if (maybeStates.get(modelAndProductState.second)) {
+            subsystemStatesOfInterest.set(productStateToSubsystemState[modelAndProductState.second]);
+        }
+    }
+    if (subsystemStatesOfInterest.empty()) {
+        return numericResult;
+    }
+
+    STORM_LOG_INFO("Computing probabilities for reaching accepting components from " << maybeStates.getNumberOfSetBits() << " product states...");
+    storm::storage::SparseMatrix<ValueType> subsystemMatrix = product.buildSubsystemMatrix(maybeStates, acceptingStates);
+    storm::storage::SparseMatrix<ValueType> subsystemBackwardTransitions = subsystemMatrix.transpose(true);
+    storm::storage::BitVector bvTrue(subsystemMatrix.getRowGroupCount(), true);
+    storm::storage::BitVector subsystemTargetStates(subsystemMatrix.getRowGroupCount(), false);
+    subsystemTargetStates.set(maybeStates.getNumberOfSetBits());
+
+    // Create goal for computeUntilProbabilities, always compute maximizing probabilities
+    storm::solver::SolveGoal<ValueType> solveGoal;
+    if (this->isValueThresholdSet()) {
+        solveGoal = storm::solver::SolveGoal<ValueType>(OptimizationDirection::Maximize, this->getValueThresholdComparisonType(),
+                                                        this->getValueThresholdValue(), std::move(subsystemStatesOfInterest));
+    } else {
+        solveGoal = storm::solver::SolveGoal<ValueType>(OptimizationDirection::Maximize);
+        solveGoal.setRelevantValues(std::move(subsystemStatesOfInterest));
+    }
+
+    std::vector<ValueType> subsystemResult;
+    if (Nondeterministic) {
+        MDPSparseModelCheckingHelperReturnType<ValueType> subsystemCheckResult =
+            storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
+                env, std::move(solveGoal), subsystemMatrix, subsystemBackwardTransitions, bvTrue, subsystemTargetStates, this->isQualitativeSet(), false);
+        subsystemResult = std::move(subsystemCheckResult.values);
+    } else {
+        subsystemResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
+            env, std::move(solveGoal), subsystemMatrix, subsystemBackwardTransitions, bvTrue, subsystemTargetStates, this->isQualitativeSet());
+    }
+
+    for (auto const& modelAndProductState : product.getInitialStates()) {
+        if (maybeStates.get(modelAndProductState.second)) {
+            numericResult[modelAndProductState.first] = subsystemResult[productStateToSubsystemState[modelAndProductState.second]];
+        }
+    }
+    return numericResult;
+}
+
 template<typename ValueType, bool Nondeterministic>
 std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAProductProbabilities(
     Environment const& env, storm::automata::DeterministicAutomaton const& da, std::map<std::string, storm::storage::BitVector>& apSatSets) {
@@ -223,6 +381,11 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
                    << statesOfInterest.getNumberOfSetBits() << " model states...");
     transformer::DAProductBuilder productBuilder(da, statesForAP);
 
+    if (!this->isProduceSchedulerSet()) {
+        // The scheduler construction needs the choices of the complete product, otherwise only the relevant part of the product is materialized.
+        return computeImplicitDAProductProbabilities(env, productBuilder, statesOfInterest);
+    }
+
     auto product = productBuilder.build<productModelType>(this->_transitionMatrix, statesOfInterest);
 
     STORM_LOG_INFO("Product " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " has "
@@ -235,12 +398,15 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
         this->_schedulerHelper.emplace(product->getProductModel().getNumberOfStates());
     }
 
+    // The backward transitions are needed both for the end component analysis and the reachability computation, so we only compute them once.
+    storm::storage::SparseMatrix<ValueType> productBackwardTransitions = product->getProductModel().getBackwardTransitions();
+
     // Compute accepting states
     storm::storage::BitVector acceptingStates;
     if (Nondeterministic) {
         STORM_LOG_INFO("Computing MECs and checking for acceptance...");
-        acceptingStates = computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
-                                              product->getProductModel().getBackwardTransitions(), product);
+        acceptingStates =
+            computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(), productBackwardTransitions, product);
 
     } else {
         STORM_LOG_INFO("Computing BSCCs and checking for acceptance...");
@@ -276,7 +442,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     if (Nondeterministic) {
         MDPSparseModelCheckingHelperReturnType<ValueType> prodCheckResult =
             storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
-                env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), product->getProductModel().getBackwardTransitions(), bvTrue,
+                env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), productBackwardTransitions, bvTrue,
                 acceptingStates, this->isQualitativeSet(),
                 this->isProduceSchedulerSet()  // Whether to create memoryless scheduler for the Model-DA Product.
             );
@@ -289,7 +455,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
 
     } else {
         prodNumericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
-            env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), product->getProductModel().getBackwardTransitions(), bvTrue,
+            env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), productBackwardTransitions, bvTrue,
             acceptingStates, this->isQualitativeSet());
     }
 
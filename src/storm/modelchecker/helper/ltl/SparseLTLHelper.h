@@ -6,6 +6,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/transformer/DAProductBuilder.h"
+#include "storm/transformer/ImplicitDAProduct.h"
 
 namespace storm {
 
@@ -112,6 +113,30 @@ class SparseLTLHelper : public SingleValueModelCheckerHelper<ValueType, storm::m
     storm::storage::BitVector computeAcceptingBCCs(automata::AcceptanceCondition const& acceptance,
                                                    storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
 
+    /*!
+     * Computes the states of the given implicit product that are contained in accepting MECs, see computeAcceptingECs above.
+     * @param acceptance the acceptance condition (in DNF), lifted to the product
+     * @param product the implicit product
+     */
+    storm::storage::BitVector computeAcceptingECs(automata::AcceptanceCondition const& acceptance, transformer::ImplicitDAProduct<ValueType> const& product);
+
+    /*!
+     * Computes the states of the given implicit product that are contained in BSCCs that satisfy the given acceptance condition.
+     * @param acceptance the acceptance condition, lifted to the product
+     * @param product the implicit product
+     */
+    storm::storage::BitVector computeAcceptingBCCs(automata::AcceptanceCondition const& acceptance, transformer::ImplicitDAProduct<ValueType> const& product);
+
+    /*!
+     * Computes the (maximizing) probabilities of the DA product without materializing it. The accepting components and the states that can not
+     * reach them are determined on the implicit product. Only the choices of the remaining states are materialized for the numerical computation.
+     * @param productBuilder the builder for the DA product
+     * @param statesOfInterest the model states from which the product is explored
+     * @return a value for each state
+     */
+    std::vector<ValueType> computeImplicitDAProductProbabilities(Environment const& env, transformer::DAProductBuilder const& productBuilder,
+                                                                 storm::storage::BitVector const& statesOfInterest);
+
     storm::storage::SparseMatrix<ValueType> const& _transitionMatrix;
 
     boost::optional<storm::modelchecker::helper::internal::SparseLTLSchedulerHelper<ValueType, Nondeterministic>> _schedulerHelper;
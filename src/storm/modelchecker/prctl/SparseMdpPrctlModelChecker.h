@@ -10,6 +10,11 @@ namespace storm {
 class Environment;
 
 namespace modelchecker {
+namespace helper {
+template<typename ValueType>
+class SparseMdpAnalysisCache;
+}
+
 template<class SparseMdpModelType>
 class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<SparseMdpModelType> {
    public:
@@ -18,6 +23,19 @@ class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<Sparse
 
     explicit SparseMdpPrctlModelChecker(SparseMdpModelType const& model);
 
+    /*!
+     * Sets a cache in which intermediate results (qualitative state sets, end component decompositions and previous results) are stored
+     * and from which they are retrieved when checking subsequent properties. The cache can be shared among several model checkers for the same model.
+     *
+     * @param analysisCache The cache. It has to be created for the transition matrix of the model. If null, no cache is used.
+     */
+    void setAnalysisCache(std::shared_ptr<helper::SparseMdpAnalysisCache<ValueType>> const& analysisCache);
+
+    /*!
+     * Retrieves the cache set via setAnalysisCache (if any).
+     */
+    std::shared_ptr<helper::SparseMdpAnalysisCache<ValueType>> const& getAnalysisCache() const;
+
     /*!
      * Returns false, if this task can certainly not be handled by this model checker (independent of the concrete model).
      * @param requiresSingleInitialState if not nullptr, this flag is set to true iff checking this formula requires a model with a single initial state
@@ -61,6 +79,12 @@ class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<Sparse
                                                                   CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkQuantileFormula(Environment const& env,
                                                               CheckTask<storm::logic::QuantileFormula, ValueType> const& checkTask) override;
+
+   private:
+    // Retrieves the backward transitions of the model, either from the analysis cache or by computing them.
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions() const;
+
+    std::shared_ptr<helper::SparseMdpAnalysisCache<ValueType>> analysisCache;
 };
 }  // namespace modelchecker
 }  // namespace storm
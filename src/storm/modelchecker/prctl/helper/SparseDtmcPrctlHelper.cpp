@@ -1,5 +1,8 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include <thread>
+#include <unordered_map>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
@@ -19,6 +22,7 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -77,8 +81,9 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
     preciseEnv.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
 
-    // In case of cdf export we store the necessary data.
-    std::vector<std::vector<ValueType>> cdfData;
+    // In case of cdf export we store the necessary data. The entries are indexed by the position of their epoch in the computation order, which
+    // ensures that the export does not depend on the order in which the epochs are analyzed.
+    std::map<uint64_t, std::vector<ValueType>> cdfData;
 
     // Set the correct equation problem format.
     storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
@@ -88,13 +93,8 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto addCdfEntry = [&](uint64_t epochIndex) {
+        auto const& epoch = epochOrder[epochIndex];
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -104,13 +104,53 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
                                    rewardUnfolding.getDimension(i).scalingFactor);
             }
             cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
+            cdfData.emplace(epochIndex, std::move(cdfEntry));
+        }
+    };
+    uint64_t numberOfThreads = env.modelchecker().getEpochThreadCount();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
+    if (numberOfThreads == 1) {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            addCdfEntry(numCheckedEpochs);
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
         }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    } else {
+        // Each thread needs its own solver and auxiliary vectors. The time for building the epoch models is included in the checking time.
+        std::vector<std::vector<ValueType>> xs(numberOfThreads), bs(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> solvers(numberOfThreads);
+        // The epochs are not necessarily analyzed in the computation order, so we need to look up their positions.
+        std::unordered_map<uint64_t, uint64_t> epochIndices;
+        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+            for (uint64_t epochIndex = 0; epochIndex < epochOrder.size(); ++epochIndex) {
+                epochIndices.emplace(epochOrder[epochIndex], epochIndex);
+            }
         }
+        swCheck.start();
+        rewardUnfolding.analyzeEpochs(
+            epochOrder, numberOfThreads,
+            [&](uint64_t thread, auto& epochModel) {
+                return epochModel.analyzeSingleObjective(preciseEnv, xs[thread], bs[thread], solvers[thread], lowerBound, upperBound);
+            },
+            [&](auto const& epoch) {
+                if (!epochIndices.empty()) {
+                    addCdfEntry(epochIndices.at(epoch));
+                }
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+            });
+        swCheck.stop();
     }
 
     std::map<storm::storage::sparse::state_type, ValueType> result;
@@ -126,8 +166,13 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
             headers.push_back(rewardUnfolding.getDimension(i).formula->toString());
         }
         headers.push_back("Result");
+        std::vector<std::vector<ValueType>> cdfRows;
+        cdfRows.reserve(cdfData.size());
+        for (auto& cdfEntry : cdfData) {
+            cdfRows.push_back(std::move(cdfEntry.second));
+        }
         storm::utility::exportDataToCSVFile<ValueType, std::string, std::string>(
-            storm::settings::getModule<storm::settings::modules::IOSettings>().getExportCdfDirectory() + "cdf.csv", cdfData, headers);
+            storm::settings::getModule<storm::settings::modules::IOSettings>().getExportCdfDirectory() + "cdf.csv", cdfRows, headers);
     }
 
     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
@@ -0,0 +1,178 @@
+#include "storm/modelchecker/prctl/helper/SparseMdpAnalysisCache.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+SparseMdpAnalysisCache<ValueType>::SparseMdpAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t maximalNumberOfEntries)
+    : transitionMatrix(transitionMatrix),
+      backwardTransitions(std::make_shared<storm::storage::SparseMatrix<ValueType> const>(transitionMatrix.transpose(true))),
+      maximalNumberOfEntries(std::max<uint64_t>(maximalNumberOfEntries, 1)),
+      numberOfHits(0),
+      numberOfMisses(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool SparseMdpAnalysisCache<ValueType>::isCacheFor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) const {
+    return &this->transitionMatrix == &transitionMatrix;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& SparseMdpAnalysisCache<ValueType>::getBackwardTransitions() const {
+    return backwardTransitions;
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> SparseMdpAnalysisCache<ValueType>::getProb01(storm::solver::OptimizationDirection dir,
+                                                                                                            storm::storage::BitVector const& phiStates,
+                                                                                                            storm::storage::BitVector const& psiStates) {
+    return getQualitativeResult(storm::solver::minimize(dir) ? QualitativeQuery::Prob01Min : QualitativeQuery::Prob01Max, phiStates, psiStates);
+}
+
+template<typename ValueType>
+storm::storage::BitVector SparseMdpAnalysisCache<ValueType>::getProb1(storm::solver::OptimizationDirection dir, storm::storage::BitVector const& phiStates,
+                                                                      storm::storage::BitVector const& psiStates) {
+    return getQualitativeResult(storm::solver::minimize(dir) ? QualitativeQuery::Prob1E : QualitativeQuery::Prob1A, phiStates, psiStates).first;
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> const& SparseMdpAnalysisCache<ValueType>::getQualitativeResult(
+    QualitativeQuery query, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    std::hash<storm::storage::BitVector> hasher;
+    std::size_t hash = hasher(phiStates) ^ (hasher(psiStates) << 1) ^ static_cast<std::size_t>(query);
+    for (auto entryIt = qualitativeEntries.begin(); entryIt != qualitativeEntries.end(); ++entryIt) {
+        if (entryIt->hash == hash && entryIt->query == query && entryIt->phiStates == phiStates && entryIt->psiStates == psiStates) {
+            ++numberOfHits;
+            qualitativeEntries.splice(qualitativeEntries.begin(), qualitativeEntries, entryIt);
+            return qualitativeEntries.front().result;
+        }
+    }
+
+    ++numberOfMisses;
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    switch (query) {
+        case QualitativeQuery::Prob01Min:
+            result = storm::utility::graph::performProb01Min(transitionMatrix, rowGroupIndices, *backwardTransitions, phiStates, psiStates);
+            break;
+        case QualitativeQuery::Prob01Max:
+            result = storm::utility::graph::performProb01Max(transitionMatrix, rowGroupIndices, *backwardTransitions, phiStates, psiStates);
+            break;
+        case QualitativeQuery::Prob1E:
+            result.first = storm::utility::graph::performProb1E(transitionMatrix, rowGroupIndices, *backwardTransitions, phiStates, psiStates);
+            break;
+        case QualitativeQuery::Prob1A:
+            result.first = storm::utility::graph::performProb1A(transitionMatrix, rowGroupIndices, *backwardTransitions, phiStates, psiStates);
+            break;
+    }
+    qualitativeEntries.push_front(QualitativeEntry{query, hash, phiStates, psiStates, std::move(result)});
+    if (qualitativeEntries.size() > maximalNumberOfEntries) {
+        qualitativeEntries.pop_back();
+    }
+    return qualitativeEntries.front().result;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> SparseMdpAnalysisCache<ValueType>::getMaximalEndComponentDecomposition(
+    storm::storage::BitVector const& states, boost::optional<storm::storage::BitVector> const& choices) {
+    std::hash<storm::storage::BitVector> hasher;
+    std::size_t hash = hasher(states) ^ (choices ? (hasher(choices.get()) << 1) : 0);
+    for (auto entryIt = endComponentEntries.begin(); entryIt != endComponentEntries.end(); ++entryIt) {
+        if (entryIt->hash == hash && entryIt->states == states && entryIt->choices == choices) {
+            ++numberOfHits;
+            endComponentEntries.splice(endComponentEntries.begin(), endComponentEntries, entryIt);
+            return endComponentEntries.front().decomposition;
+        }
+    }
+
+    ++numberOfMisses;
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> decomposition;
+    if (choices) {
+        decomposition =
+            std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, *backwardTransitions, states, choices.get());
+    } else {
+        decomposition = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, *backwardTransitions, states);
+    }
+    endComponentEntries.push_front(EndComponentEntry{hash, states, choices, decomposition});
+    if (endComponentEntries.size() > maximalNumberOfEntries) {
+        endComponentEntries.pop_back();
+    }
+    return decomposition;
+}
+
+template<typename ValueType>
+ExplicitModelCheckerHint<ValueType> SparseMdpAnalysisCache<ValueType>::getWarmStartHint(SolutionType const& type,
+                                                                                        storm::solver::OptimizationDirection dir) const {
+    ExplicitModelCheckerHint<ValueType> result;
+    result.setComputeOnlyMaybeStates(false);
+    result.setNoEndComponentsInMaybeStates(false);
+    for (auto const& entry : warmStartEntries) {
+        if (entry.type == type && entry.dir == dir) {
+            result.setResultHint(entry.values);
+            result.setSchedulerHint(entry.scheduler);
+            break;
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void SparseMdpAnalysisCache<ValueType>::storeResult(SolutionType const& type, storm::solver::OptimizationDirection dir, std::vector<ValueType> const& values,
+                                                    storm::storage::Scheduler<ValueType> const* scheduler) {
+    STORM_LOG_ASSERT(values.size() == transitionMatrix.getRowGroupCount(), "Unexpected size of result vector.");
+    WarmStartEntry* entry = nullptr;
+    for (auto& existingEntry : warmStartEntries) {
+        if (existingEntry.type == type && existingEntry.dir == dir) {
+            entry = &existingEntry;
+            break;
+        }
+    }
+    if (!entry) {
+        warmStartEntries.push_back(WarmStartEntry{type, dir, {}, boost::none});
+        entry = &warmStartEntries.back();
+    }
+
+    // States with infinite values can not be used as a starting point of the iteration.
+    entry->values = values;
+    for (auto& value : entry->values) {
+        if (storm::utility::isInfinity(value)) {
+            value = storm::utility::zero<ValueType>();
+        }
+    }
+    if (scheduler && scheduler->isMemorylessScheduler() && scheduler->isDeterministicScheduler() && !scheduler->isPartialScheduler()) {
+        entry->scheduler = *scheduler;
+    } else {
+        entry->scheduler = boost::none;
+    }
+}
+
+template<typename ValueType>
+void SparseMdpAnalysisCache<ValueType>::clear() {
+    qualitativeEntries.clear();
+    endComponentEntries.clear();
+    warmStartEntries.clear();
+}
+
+template<typename ValueType>
+uint64_t SparseMdpAnalysisCache<ValueType>::getNumberOfHits() const {
+    return numberOfHits;
+}
+
+template<typename ValueType>
+uint64_t SparseMdpAnalysisCache<ValueType>::getNumberOfMisses() const {
+    return numberOfMisses;
+}
+
+template class SparseMdpAnalysisCache<double>;
+template class SparseMdpAnalysisCache<storm::RationalNumber>;
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
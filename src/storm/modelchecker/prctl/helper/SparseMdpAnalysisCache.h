@@ -0,0 +1,150 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/prctl/helper/SolutionType.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Stores intermediate results of the analysis of a sparse MDP so that they can be reused when checking several properties on the same model.
+ * This includes the backward transitions, qualitative state sets (computed via graph analysis), maximal end component decompositions and the
+ * results of previous quantitative queries, which are provided as hints to warm-start subsequent computations.
+ *
+ * @note The cache only refers to the transition matrix it was created for. It is the responsibility of the caller to make sure that the
+ * matrix outlives the cache and is not modified in the meantime.
+ */
+template<typename ValueType>
+class SparseMdpAnalysisCache {
+   public:
+    /*!
+     * Creates an (empty) cache for the given transition matrix.
+     *
+     * @param transitionMatrix The transition matrix of the MDP.
+     * @param maximalNumberOfEntries The maximal number of qualitative state sets and end component decompositions that are kept. If more results are
+     * inserted, the least recently used ones are dropped.
+     */
+    SparseMdpAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t maximalNumberOfEntries = 64);
+
+    /*!
+     * Retrieves whether this cache was created for the given transition matrix.
+     */
+    bool isCacheFor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) const;
+
+    /*!
+     * Retrieves the backward transitions of the transition matrix.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& getBackwardTransitions() const;
+
+    /*!
+     * Retrieves the states with probability 0 and 1, respectively, of satisfying phi until psi under an optimal scheduler (as computed by
+     * storm::utility::graph::performProb01Min or storm::utility::graph::performProb01Max).
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> getProb01(storm::solver::OptimizationDirection dir,
+                                                                            storm::storage::BitVector const& phiStates,
+                                                                            storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the states that satisfy phi until psi with probability 1 under some scheduler, if the direction is minimize, and under all schedulers,
+     * if the direction is maximize (as computed by storm::utility::graph::performProb1E and storm::utility::graph::performProb1A, respectively).
+     */
+    storm::storage::BitVector getProb1(storm::solver::OptimizationDirection dir, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the maximal end component decomposition of the sub-MDP induced by the given states and (optionally) the given choices.
+     */
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> getMaximalEndComponentDecomposition(
+        storm::storage::BitVector const& states, boost::optional<storm::storage::BitVector> const& choices = boost::none);
+
+    /*!
+     * Retrieves a hint that can be used to warm-start the computation of values of the given type and direction. The hint consists of the values
+     * (and the scheduler, if one was produced) of the last query with the same type and direction. If there was no such query, the hint is empty.
+     */
+    ExplicitModelCheckerHint<ValueType> getWarmStartHint(SolutionType const& type, storm::solver::OptimizationDirection dir) const;
+
+    /*!
+     * Stores the result of a query such that it can be used to warm-start later queries.
+     *
+     * @param type The type of the computed values.
+     * @param dir The optimization direction.
+     * @param values The values of all states. Infinite values are not stored.
+     * @param scheduler If not null, the scheduler that induces the values.
+     */
+    void storeResult(SolutionType const& type, storm::solver::OptimizationDirection dir, std::vector<ValueType> const& values,
+                     storm::storage::Scheduler<ValueType> const* scheduler = nullptr);
+
+    /*!
+     * Drops all cached information (except for the backward transitions).
+     */
+    void clear();
+
+    /*!
+     * Retrieves how often a requested qualitative state set or end component decomposition was found in the cache.
+     */
+    uint64_t getNumberOfHits() const;
+
+    /*!
+     * Retrieves how often a requested qualitative state set or end component decomposition had to be computed.
+     */
+    uint64_t getNumberOfMisses() const;
+
+   private:
+    enum class QualitativeQuery { Prob01Min, Prob01Max, Prob1E, Prob1A };
+
+    struct QualitativeEntry {
+        QualitativeQuery query;
+        std::size_t hash;
+        storm::storage::BitVector phiStates;
+        storm::storage::BitVector psiStates;
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    };
+
+    struct EndComponentEntry {
+        std::size_t hash;
+        storm::storage::BitVector states;
+        boost::optional<storm::storage::BitVector> choices;
+        std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> decomposition;
+    };
+
+    struct WarmStartEntry {
+        SolutionType type;
+        storm::solver::OptimizationDirection dir;
+        std::vector<ValueType> values;
+        boost::optional<storm::storage::Scheduler<ValueType>> scheduler;
+    };
+
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> const& getQualitativeResult(QualitativeQuery query,
+                                                                                              storm::storage::BitVector const& phiStates,
+                                                                                              storm::storage::BitVector const& psiStates);
+
+    // The transition matrix (and its transpose) for which the results are cached.
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitions;
+
+    // The cached results. The most recently used entries are at the front.
+    uint64_t maximalNumberOfEntries;
+    std::list<QualitativeEntry> qualitativeEntries;
+    std::list<EndComponentEntry> endComponentEntries;
+    std::vector<WarmStartEntry> warmStartEntries;
+
+    uint64_t numberOfHits;
+    uint64_t numberOfMisses;
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,10 +1,14 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
+#include <thread>
+#include <unordered_map>
+
 #include <boost/container/flat_map.hpp>
 
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpAnalysisCache.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
@@ -38,6 +42,7 @@
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -75,20 +80,16 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
     Environment preciseEnv = env;
     preciseEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
 
-    // In case of cdf export we store the necessary data.
-    std::vector<std::vector<ValueType>> cdfData;
+    // In case of cdf export we store the necessary data. The entries are indexed by the position of their epoch in the computation order, which
+    // ensures that the export does not depend on the order in which the epochs are analyzed.
+    std::map<uint64_t, std::vector<ValueType>> cdfData;
 
     storm::utility::ProgressMeasurement progress("epochs");
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto addCdfEntry = [&](uint64_t epochIndex) {
+        auto const& epoch = epochOrder[epochIndex];
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -98,13 +99,53 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
                                    rewardUnfolding.getDimension(i).scalingFactor);
             }
             cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
+            cdfData.emplace(epochIndex, std::move(cdfEntry));
         }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    };
+    uint64_t numberOfThreads = env.modelchecker().getEpochThreadCount();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
+    if (numberOfThreads == 1) {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+            swCheck.stop();
+            addCdfEntry(numCheckedEpochs);
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
         }
+    } else {
+        // Each thread needs its own solver and auxiliary vectors. The time for building the epoch models is included in the checking time.
+        std::vector<std::vector<ValueType>> xs(numberOfThreads), bs(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> solvers(numberOfThreads);
+        // The epochs are not necessarily analyzed in the computation order, so we need to look up their positions.
+        std::unordered_map<uint64_t, uint64_t> epochIndices;
+        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+            for (uint64_t epochIndex = 0; epochIndex < epochOrder.size(); ++epochIndex) {
+                epochIndices.emplace(epochOrder[epochIndex], epochIndex);
+            }
+        }
+        swCheck.start();
+        rewardUnfolding.analyzeEpochs(
+            epochOrder, numberOfThreads,
+            [&](uint64_t thread, auto& epochModel) {
+                return epochModel.analyzeSingleObjective(preciseEnv, dir, xs[thread], bs[thread], solvers[thread], lowerBound, upperBound);
+            },
+            [&](auto const& epoch) {
+                if (!epochIndices.empty()) {
+                    addCdfEntry(epochIndices.at(epoch));
+                }
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+            });
+        swCheck.stop();
     }
 
     std::map<storm::storage::sparse::state_type, ValueType> result;
@@ -120,8 +161,13 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
             headers.push_back(rewardUnfolding.getDimension(i).formula->toString());
         }
         headers.push_back("Result");
+        std::vector<std::vector<ValueType>> cdfRows;
+        cdfRows.reserve(cdfData.size());
+        for (auto& cdfEntry : cdfData) {
+            cdfRows.push_back(std::move(cdfEntry.second));
+        }
         storm::utility::exportDataToCSVFile<ValueType, std::string, std::string>(
-            storm::settings::getModule<storm::settings::modules::IOSettings>().getExportCdfDirectory() + "cdf.csv", cdfData, headers);
+            storm::settings::getModule<storm::settings::modules::IOSettings>().getExportCdfDirectory() + "cdf.csv", cdfRows, headers);
     }
 
     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
@@ -260,11 +306,12 @@ template<typename ValueType>
 void extractValueAndSchedulerHint(SparseMdpHintType<ValueType>& hintStorage, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& maybeStates,
                                   boost::optional<storm::storage::BitVector> const& selectedChoices, ModelCheckerHint const& hint,
-                                  bool skipECWithinMaybeStatesCheck) {
+                                  bool skipECWithinMaybeStatesCheck, bool isWarmStartHint) {
     // Deal with scheduler hint.
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasSchedulerHint()) {
         if (hintStorage.hasSchedulerHint()) {
-            STORM_LOG_WARN("A scheduler hint was provided, but the solver requires a specific one. The provided scheduler hint will be ignored.");
+            STORM_LOG_WARN_COND(isWarmStartHint,
+                                "A scheduler hint was provided, but the solver requires a specific one. The provided scheduler hint will be ignored.");
         } else {
             auto const& schedulerHint = hint.template asExplicitModelCheckerHint<ValueType>().getSchedulerHint();
             std::vector<uint64_t> hintChoices;
@@ -318,7 +365,7 @@ SparseMdpHintType<ValueType> computeHints(Environment const& env, SolutionType c
                                           storm::OptimizationDirection const& dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& maybeStates,
                                           storm::storage::BitVector const& phiStates, storm::storage::BitVector const& targetStates, bool produceScheduler,
-                                          boost::optional<storm::storage::BitVector> const& selectedChoices = boost::none) {
+                                          boost::optional<storm::storage::BitVector> const& selectedChoices = boost::none, bool isWarmStartHint = false) {
     SparseMdpHintType<ValueType> result;
 
     // There are no end components if we minimize until probabilities or
@@ -377,9 +424,10 @@ SparseMdpHintType<ValueType> computeHints(Environment const& env, SolutionType c
     // Only if there is no end component decomposition that we will need to do later, we use value and scheduler
     // hints from the provided hint.
     if (!result.eliminateEndComponents) {
-        extractValueAndSchedulerHint(result, transitionMatrix, backwardTransitions, maybeStates, selectedChoices, hint, result.uniqueSolution);
+        extractValueAndSchedulerHint(result, transitionMatrix, backwardTransitions, maybeStates, selectedChoices, hint, result.uniqueSolution,
+                                     isWarmStartHint);
     } else {
-        STORM_LOG_WARN_COND(hint.isEmpty(), "A non-empty hint was provided, but its information will be disregarded.");
+        STORM_LOG_WARN_COND(hint.isEmpty() || isWarmStartHint, "A non-empty hint was provided, but its information will be disregarded.");
     }
 
     // Only set bounds if we did not obtain them from the hint.
@@ -511,12 +559,15 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
-                                                                                     storm::storage::BitVector const& psiStates) {
+                                                                                     storm::storage::BitVector const& psiStates,
+                                                                                     SparseMdpAnalysisCache<ValueType>* analysisCache) {
     QualitativeStateSetsUntilProbabilities result;
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
+    if (analysisCache) {
+        statesWithProbability01 = analysisCache->getProb01(goal.direction(), phiStates, psiStates);
+    } else if (goal.minimize()) {
         statesWithProbability01 =
             storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
     } else {
@@ -535,11 +586,12 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint) {
+                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint,
+                                                                                 SparseMdpAnalysisCache<ValueType>* analysisCache) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
     } else {
-        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, analysisCache);
     }
 }
 
@@ -596,24 +648,29 @@ template<typename ValueType>
 boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(
     storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets,
-    storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler) {
+    storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler, SparseMdpAnalysisCache<ValueType>* analysisCache) {
     // Get the set of states that (under some scheduler) can stay in the set of maybestates forever
     storm::storage::BitVector candidateStates = storm::utility::graph::performProb0E(
         transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, qualitativeStateSets.maybeStates, ~qualitativeStateSets.maybeStates);
 
     bool doDecomposition = !candidateStates.empty();
 
-    storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> endComponentDecomposition;
     if (doDecomposition) {
         // Compute the states that are in MECs.
-        endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+        if (analysisCache) {
+            endComponentDecomposition = analysisCache->getMaximalEndComponentDecomposition(candidateStates);
+        } else {
+            endComponentDecomposition =
+                std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, backwardTransitions, candidateStates);
+        }
     }
 
     // Only do more work if there are actually end-components.
-    if (doDecomposition && !endComponentDecomposition.empty()) {
-        STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition.size() << " EC(s).");
+    if (doDecomposition && !endComponentDecomposition->empty()) {
+        STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition->size() << " EC(s).");
         SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(
-            endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr,
+            *endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr,
             submatrix, &b, nullptr, produceScheduler);
 
         // If the solve goal has relevant values, we need to adjust them.
@@ -642,9 +699,12 @@ template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpAnalysisCache<ValueType>* analysisCache) {
     STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException,
                     "Cannot produce scheduler when performing qualitative model checking only.");
+    STORM_LOG_ASSERT(!analysisCache || analysisCache->isCacheFor(transitionMatrix), "The analysis cache was created for a different transition matrix.");
+    storm::solver::OptimizationDirection const direction = goal.minimize() ? storm::solver::OptimizationDirection::Minimize
+                                                                           : storm::solver::OptimizationDirection::Maximize;
 
     // Prepare resulting vector.
     std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
@@ -652,7 +712,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
     // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
     QualitativeStateSetsUntilProbabilities qualitativeStateSets =
-        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint, analysisCache);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
                                      << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 ("
@@ -684,10 +744,16 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
         if (!qualitativeStateSets.maybeStates.empty()) {
             // In this case we have have to compute the remaining probabilities.
 
+            // If no hint was provided, we try to warm-start the computation with the result of a previous query on the same model.
+            bool useWarmStartHint = analysisCache && hint.isEmpty();
+            ExplicitModelCheckerHint<ValueType> warmStartHint =
+                useWarmStartHint ? analysisCache->getWarmStartHint(SolutionType::UntilProbabilities, direction) : ExplicitModelCheckerHint<ValueType>();
+
             // Obtain proper hint information either from the provided hint or from requirements of the solver.
-            SparseMdpHintType<ValueType> hintInformation =
-                computeHints(env, SolutionType::UntilProbabilities, hint, goal.direction(), transitionMatrix, backwardTransitions,
-                             qualitativeStateSets.maybeStates, phiStates, qualitativeStateSets.statesWithProbability1, produceScheduler);
+            SparseMdpHintType<ValueType> hintInformation = computeHints(
+                env, SolutionType::UntilProbabilities, useWarmStartHint ? static_cast<ModelCheckerHint const&>(warmStartHint) : hint, goal.direction(),
+                transitionMatrix, backwardTransitions, qualitativeStateSets.maybeStates, phiStates, qualitativeStateSets.statesWithProbability1,
+                produceScheduler, boost::none, useWarmStartHint);
 
             // Declare the components of the equation system we will solve.
             storm::storage::SparseMatrix<ValueType> submatrix;
@@ -696,8 +762,8 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
             // If the hint information tells us that we have to eliminate MECs, we do so now.
             boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
             if (hintInformation.getEliminateEndComponents()) {
-                ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions,
-                                                                                                qualitativeStateSets, submatrix, b, produceScheduler);
+                ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(
+                    goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler, analysisCache);
             } else {
                 // Otherwise, we compute the standard equations.
                 computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
@@ -729,6 +795,11 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
         extendScheduler(*scheduler, goal, qualitativeStateSets, transitionMatrix, backwardTransitions, phiStates, psiStates);
     }
 
+    // Remember the result such that subsequent queries on the same model can start from it.
+    if (analysisCache && !qualitative && !maybeStatesNotRelevant) {
+        analysisCache->storeResult(SolutionType::UntilProbabilities, direction, result, scheduler.get());
+    }
+
     // Sanity check for created scheduler.
     STORM_LOG_ASSERT(!produceScheduler || scheduler, "Expected that a scheduler was obtained.");
     STORM_LOG_ASSERT((!produceScheduler && !scheduler) || !scheduler->isPartialScheduler(), "Expected a fully defined scheduler");
@@ -743,24 +814,30 @@ template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeGloballyProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler,
-    bool useMecBasedTechnique) {
+    bool useMecBasedTechnique, SparseMdpAnalysisCache<ValueType>* analysisCache) {
     if (useMecBasedTechnique) {
         // TODO: does this really work for minimizing objectives?
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, psiStates);
+        std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> mecDecomposition;
+        if (analysisCache) {
+            mecDecomposition = analysisCache->getMaximalEndComponentDecomposition(psiStates);
+        } else {
+            mecDecomposition =
+                std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, backwardTransitions, psiStates);
+        }
         storm::storage::BitVector statesInPsiMecs(transitionMatrix.getRowGroupCount());
-        for (auto const& mec : mecDecomposition) {
+        for (auto const& mec : *mecDecomposition) {
             for (auto const& stateActionsPair : mec) {
                 statesInPsiMecs.set(stateActionsPair.first, true);
             }
         }
 
         return computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, statesInPsiMecs, qualitative,
-                                         produceScheduler);
+                                         produceScheduler, ModelCheckerHint(), analysisCache);
     } else {
         goal.oneMinus();
-        auto result =
-            computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions,
-                                      storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), ~psiStates, qualitative, produceScheduler);
+        auto result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions,
+                                                storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), ~psiStates, qualitative,
+                                                produceScheduler, ModelCheckerHint(), analysisCache);
         for (auto& element : result.values) {
             element = storm::utility::one<ValueType>() - element;
         }
@@ -810,7 +887,7 @@ template<typename RewardModelType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, bool produceScheduler,
-    ModelCheckerHint const& hint) {
+    ModelCheckerHint const& hint, SparseMdpAnalysisCache<ValueType>* analysisCache) {
     // Reduce to reachability rewards
     if (goal.minimize()) {
         STORM_LOG_ERROR_COND(!produceScheduler, "Can not produce scheduler for this property (functionality not implemented");
@@ -826,7 +903,8 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
             storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions,
                                                         statesWithZeroRewardChoice, ~statesWithZeroRewardChoice, false, 0, choicesWithoutReward);
         rew0EStates.complement();
-        return computeReachabilityRewards(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, rew0EStates, qualitative, false, hint);
+        return computeReachabilityRewards(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, rew0EStates, qualitative, false, hint,
+                                          analysisCache);
     } else {
         // Identify the states from which only states with zero reward are reachable.
         storm::storage::BitVector statesWithoutReward = rewardModel.getStatesWithZeroReward(transitionMatrix);
@@ -836,10 +914,13 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
         // There might be end components that consists only of states/choices with zero rewards. The reachability reward semantics would assign such
         // end components reward infinity. To avoid this, we potentially need to eliminate such end components
         storm::storage::BitVector trueStates(transitionMatrix.getRowGroupCount(), true);
-        if (storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, trueStates, rew0AStates)
-                .full()) {
+        storm::storage::BitVector prob1AStates =
+            analysisCache ? analysisCache->getProb1(storm::solver::OptimizationDirection::Maximize, trueStates, rew0AStates)
+                          : storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, trueStates,
+                                                                 rew0AStates);
+        if (prob1AStates.full()) {
             return computeReachabilityRewards(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, rew0AStates, qualitative,
-                                              produceScheduler, hint);
+                                              produceScheduler, hint, analysisCache);
         } else {
             // The transformation of schedulers for the ec-eliminated system back to the original one is not implemented.
             STORM_LOG_ERROR_COND(!produceScheduler, "Can not produce scheduler for this property (functionality not implemented");
@@ -905,7 +986,7 @@ template<typename RewardModelType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
-    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpAnalysisCache<ValueType>* analysisCache) {
     // Only compute the result if the model has at least one reward this->getModel().
     STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Reward model for formula is empty. Skipping formula.");
     return computeReachabilityRewardsHelper(
@@ -914,21 +995,21 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
             return rewardModel.getTotalRewardVector(rowCount, transitionMatrix, maybeStates);
         },
         targetStates, qualitative, produceScheduler, [&]() { return rewardModel.getStatesWithZeroReward(transitionMatrix); },
-        [&]() { return rewardModel.getChoicesWithZeroReward(transitionMatrix); }, hint);
+        [&]() { return rewardModel.getChoicesWithZeroReward(transitionMatrix); }, hint, analysisCache);
 }
 
 template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityTimes(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
-    ModelCheckerHint const& hint) {
+    ModelCheckerHint const& hint, SparseMdpAnalysisCache<ValueType>* analysisCache) {
     return computeReachabilityRewardsHelper(
         env, std::move(goal), transitionMatrix, backwardTransitions,
         [](uint_fast64_t rowCount, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&) {
             return std::vector<ValueType>(rowCount, storm::utility::one<ValueType>());
         },
         targetStates, qualitative, produceScheduler, [&]() { return storm::storage::BitVector(transitionMatrix.getRowGroupCount(), false); },
-        [&]() { return storm::storage::BitVector(transitionMatrix.getRowCount(), false); }, hint);
+        [&]() { return storm::storage::BitVector(transitionMatrix.getRowCount(), false); }, hint, analysisCache);
 }
 
 #ifdef STORM_HAVE_CARL
@@ -1004,10 +1085,13 @@ template<typename ValueType>
 QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityRewards(
     storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
-    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
+    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
+    SparseMdpAnalysisCache<ValueType>* analysisCache) {
     QualitativeStateSetsReachabilityRewards result;
     storm::storage::BitVector trueStates(transitionMatrix.getRowGroupCount(), true);
-    if (goal.minimize()) {
+    if (analysisCache) {
+        result.infinityStates = analysisCache->getProb1(goal.direction(), trueStates, targetStates);
+    } else if (goal.minimize()) {
         result.infinityStates =
             storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, trueStates, targetStates);
     } else {
@@ -1037,12 +1121,13 @@ QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewar
                                                                                    storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                    storm::storage::BitVector const& targetStates, ModelCheckerHint const& hint,
                                                                                    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter,
-                                                                                   std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
+                                                                                   std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
+                                                                                   SparseMdpAnalysisCache<ValueType>* analysisCache) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsReachabilityRewardsFromHint<ValueType>(hint, targetStates);
     } else {
         return computeQualitativeStateSetsReachabilityRewards(goal, transitionMatrix, backwardTransitions, targetStates, zeroRewardStatesGetter,
-                                                              zeroRewardChoicesGetter);
+                                                              zeroRewardChoicesGetter, analysisCache);
     }
 }
 
@@ -1130,7 +1215,7 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
     std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const&
         totalStateRewardVectorGetter,
     storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, boost::optional<std::vector<ValueType>>& oneStepTargetProbabilities,
-    bool produceScheduler) {
+    bool produceScheduler, SparseMdpAnalysisCache<ValueType>* analysisCache) {
     // Start by computing the choices with reward 0, as we only want ECs within this fragment.
     storm::storage::BitVector zeroRewardChoices(transitionMatrix.getRowCount());
 
@@ -1169,18 +1254,22 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
 
     bool doDecomposition = !candidateStates.empty();
 
-    storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> endComponentDecomposition;
     if (doDecomposition) {
         // Then compute the states that are in MECs with zero reward.
-        endComponentDecomposition =
-            storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices);
+        if (analysisCache) {
+            endComponentDecomposition = analysisCache->getMaximalEndComponentDecomposition(candidateStates, zeroRewardChoices);
+        } else {
+            endComponentDecomposition = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(
+                transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices);
+        }
     }
 
     // Only do more work if there are actually end-components.
-    if (doDecomposition && !endComponentDecomposition.empty()) {
-        STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition.size() << " ECs.");
+    if (doDecomposition && !endComponentDecomposition->empty()) {
+        STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition->size() << " ECs.");
         SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(
-            endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates,
+            *endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates,
             oneStepTargetProbabilities ? &qualitativeStateSets.rewardZeroStates : nullptr, selectedChoices ? &selectedChoices.get() : nullptr, &rewardVector,
             submatrix, oneStepTargetProbabilities ? &oneStepTargetProbabilities.get() : nullptr, &b, produceScheduler);
 
@@ -1228,13 +1317,17 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
         totalStateRewardVectorGetter,
     storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
     std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
-    ModelCheckerHint const& hint) {
+    ModelCheckerHint const& hint, SparseMdpAnalysisCache<ValueType>* analysisCache) {
+    STORM_LOG_ASSERT(!analysisCache || analysisCache->isCacheFor(transitionMatrix), "The analysis cache was created for a different transition matrix.");
+    storm::solver::OptimizationDirection const direction = goal.minimize() ? storm::solver::OptimizationDirection::Minimize
+                                                                           : storm::solver::OptimizationDirection::Maximize;
+
     // Prepare resulting vector.
     std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
 
     // Determine which states have a reward that is infinity or less than infinity.
     QualitativeStateSetsReachabilityRewards qualitativeStateSets = getQualitativeStateSetsReachabilityRewards(
-        goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter);
+        goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter, analysisCache);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.infinityStates.getNumberOfSetBits() << " states with reward infinity, "
                                      << qualitativeStateSets.rewardZeroStates.getNumberOfSetBits() << " states with reward zero ("
@@ -1267,10 +1360,16 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
                 selectedChoices = transitionMatrix.getRowFilter(qualitativeStateSets.maybeStates, ~qualitativeStateSets.infinityStates);
             }
 
+            // If no hint was provided, we try to warm-start the computation with the result of a previous query on the same model.
+            bool useWarmStartHint = analysisCache && hint.isEmpty();
+            ExplicitModelCheckerHint<ValueType> warmStartHint =
+                useWarmStartHint ? analysisCache->getWarmStartHint(SolutionType::ExpectedRewards, direction) : ExplicitModelCheckerHint<ValueType>();
+
             // Obtain proper hint information either from the provided hint or from requirements of the solver.
-            SparseMdpHintType<ValueType> hintInformation = computeHints(
-                env, SolutionType::ExpectedRewards, hint, goal.direction(), transitionMatrix, backwardTransitions, qualitativeStateSets.maybeStates,
-                ~qualitativeStateSets.rewardZeroStates, qualitativeStateSets.rewardZeroStates, produceScheduler, selectedChoices);
+            SparseMdpHintType<ValueType> hintInformation =
+                computeHints(env, SolutionType::ExpectedRewards, useWarmStartHint ? static_cast<ModelCheckerHint const&>(warmStartHint) : hint,
+                             goal.direction(), transitionMatrix, backwardTransitions, qualitativeStateSets.maybeStates, ~qualitativeStateSets.rewardZeroStates,
+                             qualitativeStateSets.rewardZeroStates, produceScheduler, selectedChoices, useWarmStartHint);
 
             // Declare the components of the equation system we will solve.
             storm::storage::SparseMatrix<ValueType> submatrix;
@@ -1288,7 +1387,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
             if (hintInformation.getEliminateEndComponents()) {
                 ecInformation = computeFixedPointSystemReachabilityRewardsEliminateEndComponents(
                     goal, transitionMatrix, backwardTransitions, qualitativeStateSets, selectedChoices, totalStateRewardVectorGetter, submatrix, b,
-                    oneStepTargetProbabilities, produceScheduler);
+                    oneStepTargetProbabilities, produceScheduler, analysisCache);
             } else {
                 // Otherwise, we compute the standard equations.
                 computeFixedPointSystemReachabilityRewards(goal, transitionMatrix, qualitativeStateSets, selectedChoices, totalStateRewardVectorGetter,
@@ -1328,6 +1427,11 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
         extendScheduler(*scheduler, goal, qualitativeStateSets, transitionMatrix, backwardTransitions, targetStates, zeroRewardChoicesGetter);
     }
 
+    // Remember the result such that subsequent queries on the same model can start from it.
+    if (analysisCache && !qualitative && !maybeStatesNotRelevant) {
+        analysisCache->storeResult(SolutionType::ExpectedRewards, direction, result, scheduler.get());
+    }
+
     // Sanity check for created scheduler.
     STORM_LOG_ASSERT(!produceScheduler || scheduler, "Expected that a scheduler was obtained.");
     STORM_LOG_ASSERT((!produceScheduler && !scheduler) || !scheduler->isPartialScheduler(), "Expected a fully defined scheduler");
@@ -1517,11 +1621,12 @@ template std::vector<double> SparseMdpPrctlHelper<double>::computeCumulativeRewa
 template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel,
-    storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+    storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint,
+    SparseMdpAnalysisCache<double>* analysisCache);
 template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool qualitative,
-    bool produceScheduler, ModelCheckerHint const& hint);
+    bool produceScheduler, ModelCheckerHint const& hint, SparseMdpAnalysisCache<double>* analysisCache);
 
 #ifdef STORM_HAVE_CARL
 template class SparseMdpPrctlHelper<storm::RationalNumber>;
@@ -1535,12 +1640,12 @@ template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdp
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
     storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative,
-    bool produceScheduler, ModelCheckerHint const& hint);
+    bool produceScheduler, ModelCheckerHint const& hint, SparseMdpAnalysisCache<storm::RationalNumber>* analysisCache);
 template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
     storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, bool qualitative, bool produceScheduler,
-    ModelCheckerHint const& hint);
+    ModelCheckerHint const& hint, SparseMdpAnalysisCache<storm::RationalNumber>* analysisCache);
 #endif
 }  // namespace helper
 }  // namespace modelchecker
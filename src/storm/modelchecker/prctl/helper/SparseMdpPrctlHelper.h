@@ -35,6 +35,9 @@ class CheckResult;
 
 namespace helper {
 
+template<typename ValueType>
+class SparseMdpAnalysisCache;
+
 template<typename ValueType>
 class SparseMdpPrctlHelper {
    public:
@@ -49,13 +52,15 @@ class SparseMdpPrctlHelper {
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(
         Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        SparseMdpAnalysisCache<ValueType>* analysisCache = nullptr);
 
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                           storm::storage::BitVector const& psiStates, bool qualitative,
-                                                                                          bool produceScheduler, bool useMecBasedTechnique = false);
+                                                                                          bool produceScheduler, bool useMecBasedTechnique = false,
+                                                                                          SparseMdpAnalysisCache<ValueType>* analysisCache = nullptr);
 
     template<typename RewardModelType>
     static std::vector<ValueType> computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
@@ -72,19 +77,22 @@ class SparseMdpPrctlHelper {
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                  RewardModelType const& rewardModel, bool qualitative, bool produceScheduler,
-                                                                                 ModelCheckerHint const& hint = ModelCheckerHint());
+                                                                                 ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                                                 SparseMdpAnalysisCache<ValueType>* analysisCache = nullptr);
 
     template<typename RewardModelType>
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeReachabilityRewards(
         Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
-        bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+        bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        SparseMdpAnalysisCache<ValueType>* analysisCache = nullptr);
 
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                                       storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                       storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                       storm::storage::BitVector const& targetStates, bool qualitative,
-                                                                                      bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+                                                                                      bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                                                      SparseMdpAnalysisCache<ValueType>* analysisCache = nullptr);
 
 #ifdef STORM_HAVE_CARL
     static std::vector<ValueType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
@@ -108,7 +116,7 @@ class SparseMdpPrctlHelper {
             totalStateRewardVectorGetter,
         storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
         std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
-        ModelCheckerHint const& hint = ModelCheckerHint());
+        ModelCheckerHint const& hint = ModelCheckerHint(), SparseMdpAnalysisCache<ValueType>* analysisCache = nullptr);
 };
 
 }  // namespace helper
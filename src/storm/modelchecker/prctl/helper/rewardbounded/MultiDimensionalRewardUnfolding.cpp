@@ -1,8 +1,12 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 
 #include "storm/logic/Formulas.h"
 #include "storm/utility/macros.h"
@@ -15,6 +19,8 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/SignalHandler.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
@@ -399,11 +405,36 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
 
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
+    return setCurrentEpoch(mainInstance, epoch, getSuccessorEpochSolutions(epoch));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+std::map<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch,
+         typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const*>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getSuccessorEpochSolutions(Epoch const& epoch) const {
+    std::map<Epoch, EpochSolution const*> subSolutions;
+    for (auto const& step : possibleEpochSteps) {
+        Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+        if (successorEpoch != epoch) {
+            auto successorSolIt = epochSolutions.find(successorEpoch);
+            STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
+            subSolutions.emplace(successorEpoch, &successorSolIt->second);
+        }
+    }
+    return subSolutions;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(
+    EpochModelInstance& instance, Epoch const& epoch, std::map<Epoch, EpochSolution const*> const& subSolutions) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
+    auto& epochModel = instance.epochModel;
+    auto& currentEpoch = instance.currentEpoch;
+    auto const& epochModelToProductChoiceMap = instance.epochModelToProductChoiceMap;
 
     // Check if we need to update the current epoch class
     if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-        setCurrentEpochClass(epoch);
+        setCurrentEpochClass(instance, epoch);
         epochModel.epochMatrixChanged = true;
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
@@ -421,15 +452,6 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
             break;
         }
     }
-    std::map<Epoch, EpochSolution const*> subSolutions;
-    for (auto const& step : possibleEpochSteps) {
-        Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
-        if (successorEpoch != epoch) {
-            auto successorSolIt = epochSolutions.find(successorEpoch);
-            STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-            subSolutions.emplace(successorEpoch, &successorSolIt->second);
-        }
-    }
     epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
     auto stepSolIt = epochModel.stepSolutions.begin();
     for (auto reducedChoice : epochModel.stepChoices) {
@@ -511,7 +533,10 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(EpochModelInstance& instance, Epoch const& epoch) {
+    auto& epochModel = instance.epochModel;
+    auto& epochModelToProductChoiceMap = instance.epochModelToProductChoiceMap;
+    auto& productStateToEpochModelInStateMap = instance.productStateToEpochModelInStateMap;
     EpochClass epochClass = epochManager.getEpochClass(epoch);
     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << '\n';
     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -668,7 +693,7 @@ template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEquationSystemFormatForEpochModel(
     storm::solver::LinearEquationSolverProblemFormat eqSysFormat) {
     STORM_LOG_ASSERT(model.isOfType(storm::models::ModelType::Dtmc), "Trying to set the equation problem format although the model is not deterministic.");
-    epochModel.equationSolverProblemFormat = eqSysFormat;
+    mainInstance.epochModel.equationSolverProblemFormat = eqSysFormat;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -859,16 +884,21 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
-    STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    STORM_LOG_ASSERT(mainInstance.currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    STORM_LOG_ASSERT(inStateSolutions.size() == mainInstance.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    storeEpochSolution(mainInstance.currentEpoch.get(), mainInstance.productStateToEpochModelInStateMap, std::move(inStateSolutions));
+}
 
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::storeEpochSolution(
+    Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap, std::vector<SolutionType>&& inStateSolutions) {
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
@@ -883,9 +913,141 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     // add the new solution
     EpochSolution solution;
     solution.count = predecessorEpochs.size();
-    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+    solution.productStateToSolutionVectorMap = productStateToSolutionVectorMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions[epoch] = std::move(solution);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(
+    std::vector<Epoch> const& epochs, uint64_t numberOfThreads,
+    std::function<std::vector<SolutionType>(uint64_t, EpochModel<ValueType, SingleObjectiveMode>&)> const& analyzeEpoch,
+    std::function<void(Epoch const&)> const& epochAnalyzed) {
+    uint64_t const requestedNumberOfThreads = numberOfThreads;
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
+    if (storm::NumberTraits<ValueType>::IsExact) {
+        // Exact arithmetic is not safe to be used from several threads.
+        STORM_LOG_WARN_COND(numberOfThreads == 1 || requestedNumberOfThreads == 0, "Epochs are analyzed using a single thread for exact values.");
+        numberOfThreads = 1;
+    }
+    numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, epochs.size()));
+
+    // Build the dependency graph of the given epochs. An epoch can be analyzed once all of its successor epochs are analyzed.
+    // Successor epochs that are not among the given epochs have to be analyzed already.
+    std::map<Epoch, uint64_t> epochToIndexMap;
+    for (uint64_t index = 0; index < epochs.size(); ++index) {
+        epochToIndexMap.emplace(epochs[index], index);
+    }
+    std::vector<uint64_t> numberOfOpenSuccessors(epochs.size(), 0);
+    std::vector<std::vector<uint64_t>> predecessors(epochs.size());
+    for (uint64_t index = 0; index < epochs.size(); ++index) {
+        std::set<uint64_t> successors;
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epochs[index], step);
+            if (successorEpoch != epochs[index]) {
+                auto successorIt = epochToIndexMap.find(successorEpoch);
+                if (successorIt != epochToIndexMap.end()) {
+                    successors.insert(successorIt->second);
+                } else {
+                    STORM_LOG_ASSERT(epochSolutions.count(successorEpoch) > 0, "Solution for successor epoch does not exist (anymore).");
+                }
+            }
+        }
+        numberOfOpenSuccessors[index] = successors.size();
+        for (auto successor : successors) {
+            predecessors[successor].push_back(index);
+        }
+    }
+    // Ready epochs are processed in the given order which keeps the number of stored epoch solutions close to the sequential case.
+    std::set<uint64_t> readyEpochs;
+    for (uint64_t index = 0; index < epochs.size(); ++index) {
+        if (numberOfOpenSuccessors[index] == 0) {
+            readyEpochs.insert(index);
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable readyEpochsChanged;
+    uint64_t numberOfRunningEpochs = 0;
+    uint64_t numberOfAnalyzedEpochs = 0;
+    bool abort = false;
+    std::vector<std::exception_ptr> exceptions(numberOfThreads);
+
+    auto worker = [&](uint64_t thread) {
+        // Each thread has its own epoch model which is only rebuilt if the epoch class changes.
+        EpochModelInstance instance;
+        instance.epochModel.equationSolverProblemFormat = mainInstance.epochModel.equationSolverProblemFormat;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            readyEpochsChanged.wait(lock, [&]() { return abort || !readyEpochs.empty() || numberOfRunningEpochs == 0; });
+            if (abort || readyEpochs.empty()) {
+                break;
+            }
+            auto epochIt = readyEpochs.begin();
+            if (instance.currentEpoch) {
+                auto sameClassIt = std::find_if(readyEpochs.begin(), readyEpochs.end(), [&](uint64_t const& index) {
+                    return epochManager.compareEpochClass(epochs[index], instance.currentEpoch.get());
+                });
+                if (sameClassIt != readyEpochs.end()) {
+                    epochIt = sameClassIt;
+                }
+            }
+            uint64_t epochIndex = *epochIt;
+            readyEpochs.erase(epochIt);
+            ++numberOfRunningEpochs;
+            Epoch const& epoch = epochs[epochIndex];
+            auto subSolutions = getSuccessorEpochSolutions(epoch);
+            lock.unlock();
+
+            try {
+                auto& epochModel = setCurrentEpoch(instance, epoch, subSolutions);
+                std::vector<SolutionType> inStateSolutions = analyzeEpoch(thread, epochModel);
+                STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+                lock.lock();
+                // Solutions of successor epochs are only erased once all of their predecessors are analyzed, so the solutions referred
+                // to by other running epochs stay valid.
+                storeEpochSolution(epoch, instance.productStateToEpochModelInStateMap, std::move(inStateSolutions));
+                ++numberOfAnalyzedEpochs;
+                if (epochAnalyzed) {
+                    epochAnalyzed(epoch);
+                }
+                for (auto predecessor : predecessors[epochIndex]) {
+                    if (--numberOfOpenSuccessors[predecessor] == 0) {
+                        readyEpochs.insert(predecessor);
+                    }
+                }
+            } catch (...) {
+                if (!lock.owns_lock()) {
+                    lock.lock();
+                }
+                exceptions[thread] = std::current_exception();
+                abort = true;
+            }
+            --numberOfRunningEpochs;
+            if (storm::utility::resources::isTerminate()) {
+                abort = true;
+            }
+            readyEpochsChanged.notify_all();
+        }
+    };
+
+    STORM_LOG_INFO("Analyzing " << epochs.size() << " epochs using " << numberOfThreads << " threads.");
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(worker, thread);
+    }
+    worker(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+    return numberOfAnalyzedEpochs;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+#include <map>
+
 #include <boost/optional.hpp>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
@@ -64,6 +67,22 @@ class MultiDimensionalRewardUnfolding {
 
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
+    /*!
+     * Analyzes the given epochs using multiple threads. An epoch is analyzed as soon as the solutions of all its successor epochs are available,
+     * which means that independent epochs (e.g. epochs on the same anti-diagonal) are analyzed concurrently. Each thread works on its own epoch
+     * model. As in the sequential case, the solution of an epoch is dropped as soon as all its predecessor epochs have been analyzed.
+     *
+     * @param epochs The epochs to analyze as given by getEpochComputationOrder.
+     * @param numberOfThreads The number of threads. If zero, the number of hardware threads is used.
+     * @param analyzeEpoch Is called with the index of the calling thread and the epoch model of the current epoch. Has to return the solutions
+     * for the in-states of the epoch model. Calls with different thread indices can happen concurrently.
+     * @param epochAnalyzed If given, is called after the solution of an epoch has been stored. Calls do not happen concurrently.
+     * @return The number of analyzed epochs. This is less than the number of given epochs if the computation was aborted.
+     */
+    uint64_t analyzeEpochs(std::vector<Epoch> const& epochs, uint64_t numberOfThreads,
+                           std::function<std::vector<SolutionType>(uint64_t, EpochModel<ValueType, SingleObjectiveMode>&)> const& analyzeEpoch,
+                           std::function<void(Epoch const&)> const& epochAnalyzed = {});
+
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
 
     /*!
@@ -85,7 +104,24 @@ class MultiDimensionalRewardUnfolding {
     Dimension<ValueType> const& getDimension(uint64_t dim) const;
 
    private:
-    void setCurrentEpochClass(Epoch const& epoch);
+    struct EpochSolution;
+
+    /*!
+     * The epoch model for the current epoch together with the data that relates the epoch model to the product model.
+     */
+    struct EpochModelInstance {
+        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+        boost::optional<Epoch> currentEpoch;
+        std::vector<uint64_t> epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+    };
+
+    EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(EpochModelInstance& instance, Epoch const& epoch,
+                                                                std::map<Epoch, EpochSolution const*> const& subSolutions);
+    void setCurrentEpochClass(EpochModelInstance& instance, Epoch const& epoch);
+    std::map<Epoch, EpochSolution const*> getSuccessorEpochSolutions(Epoch const& epoch) const;
+    void storeEpochSolution(Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap,
+                            std::vector<SolutionType>&& inStateSolutions);
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -129,12 +165,10 @@ class MultiDimensionalRewardUnfolding {
 
     std::unique_ptr<ProductModel<ValueType>> productModel;
 
-    std::vector<uint64_t> epochModelToProductChoiceMap;
-    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
     std::set<Epoch> possibleEpochSteps;
 
-    EpochModel<ValueType, SingleObjectiveMode> epochModel;
-    boost::optional<Epoch> currentEpoch;
+    // The epoch model used by setCurrentEpoch.
+    EpochModelInstance mainInstance;
 
     EpochManager epochManager;
 
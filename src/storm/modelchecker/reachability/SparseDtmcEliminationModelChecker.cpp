@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <exception>
 #include <random>
+#include <thread>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -27,6 +29,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/vector.h"
 
@@ -876,6 +879,14 @@ void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedS
     std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
     storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates,
     bool computeResultsForInitialStatesOnly) {
+    // Exact arithmetic (in particular on rational functions) is not safe to be used from several threads.
+    uint_fast64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfThreads();
+    if (numberOfThreads > 1 && !storm::NumberTraits<ValueType>::IsExact) {
+        performConcurrentStateElimination(priorityQueue, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly,
+                                          numberOfThreads);
+        return;
+    }
+
     storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
 
     while (priorityQueue->hasNext()) {
@@ -891,6 +902,134 @@ void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedS
     }
 }
 
+template<typename SparseDtmcModelType>
+void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performConcurrentStateElimination(
+    std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
+    storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates,
+    bool computeResultsForInitialStatesOnly, uint_fast64_t numberOfThreads) {
+    // Batches that are too small are not worth the overhead of starting threads.
+    uint_fast64_t const minimalConcurrentBatchSize = 16 * numberOfThreads;
+    uint_fast64_t const maximalBatchSize = 256 * numberOfThreads;
+
+    // Every thread uses its own eliminator (and thereby its own row buffers). As the priority queue must not be updated concurrently, the
+    // eliminators do not update priorities. Instead, the priorities of all predecessors are updated once a batch has been eliminated.
+    std::shared_ptr<StatePriorityQueue> noPriorities = createStatePriorityQueue(std::vector<storm::storage::sparse::state_type>());
+    std::vector<std::unique_ptr<storm::solver::stateelimination::PrioritizedStateEliminator<ValueType>>> stateEliminators;
+    for (uint_fast64_t thread = 0; thread < numberOfThreads; ++thread) {
+        stateEliminators.push_back(std::make_unique<storm::solver::stateelimination::PrioritizedStateEliminator<ValueType>>(
+            transitionMatrix, backwardTransitions, noPriorities, values));
+    }
+
+    std::vector<storm::storage::sparse::state_type> batch;
+    std::vector<storm::storage::sparse::state_type> predecessorsOfBatch;
+    std::vector<storm::storage::sparse::state_type> neighborhoodOfBatch;
+    storm::storage::BitVector statesInNeighborhoodOfBatch(transitionMatrix.getRowCount());
+    std::vector<std::exception_ptr> exceptions(numberOfThreads);
+
+    auto eliminateStates = [&](uint_fast64_t thread, uint_fast64_t begin, uint_fast64_t end) {
+        try {
+            for (uint_fast64_t index = begin; index < end; ++index) {
+                storm::storage::sparse::state_type state = batch[index];
+                bool removeForwardTransitions = computeResultsForInitialStatesOnly && !initialStates.get(state);
+                stateEliminators[thread]->eliminateState(state, removeForwardTransitions);
+                if (removeForwardTransitions) {
+                    values[state] = storm::utility::zero<ValueType>();
+                }
+            }
+        } catch (...) {
+            exceptions[thread] = std::current_exception();
+        }
+    };
+
+    auto eliminateBatch = [&]() {
+        if (batch.size() < minimalConcurrentBatchSize) {
+            eliminateStates(0, 0, batch.size());
+        } else {
+            uint_fast64_t const chunkSize = (batch.size() + numberOfThreads - 1) / numberOfThreads;
+            std::vector<std::thread> threads;
+            threads.reserve(numberOfThreads - 1);
+            for (uint_fast64_t thread = 1; thread < numberOfThreads; ++thread) {
+                uint_fast64_t begin = std::min<uint_fast64_t>(thread * chunkSize, batch.size());
+                threads.emplace_back(eliminateStates, thread, begin, std::min<uint_fast64_t>(begin + chunkSize, batch.size()));
+            }
+            eliminateStates(0, 0, std::min<uint_fast64_t>(chunkSize, batch.size()));
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        for (auto const& predecessor : predecessorsOfBatch) {
+            priorityQueue->update(predecessor);
+        }
+        for (auto const& state : neighborhoodOfBatch) {
+            statesInNeighborhoodOfBatch.set(state, false);
+        }
+        batch.clear();
+        predecessorsOfBatch.clear();
+        neighborhoodOfBatch.clear();
+#ifdef STORM_DEV
+        STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
+#endif
+    };
+
+    auto isInNeighborhoodOfBatch = [&](storm::storage::sparse::state_type const& state) {
+        if (statesInNeighborhoodOfBatch.get(state)) {
+            return true;
+        }
+        for (auto const& entry : transitionMatrix.getRow(state)) {
+            if (statesInNeighborhoodOfBatch.get(entry.getColumn())) {
+                return true;
+            }
+        }
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            if (statesInNeighborhoodOfBatch.get(entry.getColumn())) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto addToNeighborhoodOfBatch = [&](storm::storage::sparse::state_type const& state) {
+        if (!statesInNeighborhoodOfBatch.get(state)) {
+            statesInNeighborhoodOfBatch.set(state);
+            neighborhoodOfBatch.push_back(state);
+        }
+    };
+
+    uint_fast64_t numberOfBatches = 0;
+    while (priorityQueue->hasNext()) {
+        storm::storage::sparse::state_type state = priorityQueue->pop();
+
+        // A state that is adjacent to a state of the current batch has to wait until the batch is eliminated.
+        if (batch.size() >= maximalBatchSize || isInNeighborhoodOfBatch(state)) {
+            eliminateBatch();
+            ++numberOfBatches;
+        }
+
+        batch.push_back(state);
+        addToNeighborhoodOfBatch(state);
+        for (auto const& entry : transitionMatrix.getRow(state)) {
+            addToNeighborhoodOfBatch(entry.getColumn());
+        }
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            addToNeighborhoodOfBatch(entry.getColumn());
+            if (entry.getColumn() != state) {
+                predecessorsOfBatch.push_back(entry.getColumn());
+            }
+        }
+    }
+    if (!batch.empty()) {
+        eliminateBatch();
+        ++numberOfBatches;
+    }
+    STORM_LOG_TRACE("Eliminated states in " << numberOfBatches << " batches using " << numberOfThreads << " threads.");
+}
+
 template<typename SparseDtmcModelType>
 void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performOrdinaryStateElimination(
     storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
@@ -89,6 +89,16 @@ class SparseDtmcEliminationModelChecker : public SparsePropositionalModelChecker
                                                    storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values,
                                                    storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly);
 
+    /*!
+     * Eliminates the states of the given queue using the given number of threads. States whose neighborhoods (the state together with its
+     * predecessors and successors) are pairwise disjoint do not influence each other and are therefore eliminated concurrently.
+     */
+    static void performConcurrentStateElimination(std::shared_ptr<StatePriorityQueue>& priorityQueue,
+                                                  storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
+                                                  storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values,
+                                                  storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly,
+                                                  uint_fast64_t numberOfThreads);
+
     static void performOrdinaryStateElimination(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                                 storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
                                                 storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates,
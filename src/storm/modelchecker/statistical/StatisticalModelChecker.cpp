@@ -0,0 +1,496 @@
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace statistical {
+
+namespace {
+template<typename ValueType>
+std::unique_ptr<CheckResult> createEstimateResult(std::map<uint64_t, SampleStatistics> const& statistics) {
+    std::map<uint64_t, ValueType> result;
+    for (auto const& stateStatistics : statistics) {
+        result[stateStatistics.first] = stateStatistics.second.getMean();
+    }
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(result));
+}
+}  // namespace
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(ModelType const& model, StatisticalModelCheckerOptions const& options)
+    : model(&model), options(options) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(storm::storage::SymbolicModelDescription const& modelDescription,
+                                                            StatisticalModelCheckerOptions const& options)
+    : model(nullptr), options(options) {
+    STORM_LOG_THROW(!modelDescription.hasUndefinedConstants(), storm::exceptions::InvalidArgumentException,
+                    "The statistical model checker requires all constants to be defined.");
+    auto expectedModelType =
+        isContinuousTime() ? storm::storage::SymbolicModelDescription::ModelType::CTMC : storm::storage::SymbolicModelDescription::ModelType::DTMC;
+    STORM_LOG_THROW(modelDescription.getModelType() == expectedModelType, storm::exceptions::InvalidArgumentException,
+                    "The model type " << modelDescription.getModelType() << " does not match the type of the model checker.");
+    if (modelDescription.isPrismProgram()) {
+        this->modelDescription = storm::storage::SymbolicModelDescription(modelDescription.asPrismProgram().substituteConstantsFormulas());
+    } else {
+        this->modelDescription = storm::storage::SymbolicModelDescription(modelDescription.asJaniModel().substituteConstantsFunctions());
+    }
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    storm::logic::FragmentSpecification fragment = storm::logic::reachability();
+    fragment.setBoundedUntilFormulasAllowed(true).setStepBoundedUntilFormulasAllowed(true).setTimeBoundedUntilFormulasAllowed(true);
+    fragment.setRewardOperatorsAllowed(true).setReachabilityRewardFormulasAllowed(true);
+    fragment.setCumulativeRewardFormulasAllowed(true).setStepBoundedCumulativeRewardFormulasAllowed(true).setTimeBoundedCumulativeRewardFormulasAllowed(true);
+    return checkTask.getFormula().isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    return canHandleStatic(checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeUntilProbabilities(Environment const& env,
+                                                                                         CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+    ChernoffHoeffdingCriterion criterion(options.precision, options.errorProbability);
+    return createEstimateResult<ValueType>(samplePaths(env, getPathProperty(checkTask.getFormula()), criterion));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    ChernoffHoeffdingCriterion criterion(options.precision, options.errorProbability);
+    return createEstimateResult<ValueType>(samplePaths(env, getPathProperty(checkTask.getFormula()), criterion));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeReachabilityRewards(
+    Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) {
+    PathProperty property;
+    property.type = PathProperty::Type::ReachabilityRewards;
+    property.conditionFormula = std::make_shared<storm::logic::BooleanLiteralFormula>(true);
+    property.targetFormula = checkTask.getFormula().getSubformula().asSharedPointer();
+    if (checkTask.isRewardModelSet()) {
+        property.rewardModelName = checkTask.getRewardModel();
+    }
+
+    ConfidenceIntervalCriterion criterion(options.precision, options.errorProbability);
+    return createEstimateResult<ValueType>(samplePaths(env, property, criterion));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeCumulativeRewards(
+    Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) {
+    storm::logic::CumulativeRewardFormula const& rewardPathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(!rewardPathFormula.isMultiDimensional() && !rewardPathFormula.getTimeBoundReference().isRewardBound(),
+                    storm::exceptions::NotSupportedException, "The statistical model checker only supports cumulative rewards bounded by time or steps.");
+
+    PathProperty property;
+    property.type = PathProperty::Type::CumulativeRewards;
+    property.isTimeBounded = isContinuousTime() && rewardPathFormula.getTimeBoundReference().isTimeBound();
+    if (property.isTimeBounded) {
+        property.timeBound = rewardPathFormula.template getBound<double>();
+    } else {
+        property.stepBound = rewardPathFormula.template getNonStrictBound<uint64_t>();
+    }
+    if (checkTask.isRewardModelSet()) {
+        property.rewardModelName = checkTask.getRewardModel();
+    }
+
+    ConfidenceIntervalCriterion criterion(options.precision, options.errorProbability);
+    return createEstimateResult<ValueType>(samplePaths(env, property, criterion));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    if (!checkTask.isBoundSet()) {
+        return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+    }
+
+    // If the probability only needs to be compared against a bound, a sequential test typically needs far fewer paths.
+    storm::logic::ComparisonType comparisonType = checkTask.getBoundComparisonType();
+    SequentialProbabilityRatioTest criterion(checkTask.getBoundThreshold(), options.precision, options.errorProbability);
+    std::map<uint64_t, SampleStatistics> statistics = samplePaths(env, getPathProperty(checkTask.getFormula().getSubformula()), criterion);
+
+    std::map<uint64_t, bool> result;
+    for (auto const& stateStatistics : statistics) {
+        bool isAbove = criterion.isProbabilityAboveThreshold(stateStatistics.second);
+        result[stateStatistics.first] = storm::logic::isLowerBound(comparisonType) ? isAbove : !isAbove;
+    }
+    return std::make_unique<ExplicitQualitativeCheckResult>(std::move(result));
+}
+
+template<typename ModelType>
+typename StatisticalModelChecker<ModelType>::PathProperty StatisticalModelChecker<ModelType>::getPathProperty(storm::logic::Formula const& pathFormula) {
+    PathProperty property;
+    if (pathFormula.isUntilFormula()) {
+        property.type = PathProperty::Type::Until;
+        property.conditionFormula = pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer();
+        property.targetFormula = pathFormula.asUntilFormula().getRightSubformula().asSharedPointer();
+    } else if (pathFormula.isEventuallyFormula()) {
+        property.type = PathProperty::Type::Until;
+        property.conditionFormula = std::make_shared<storm::logic::BooleanLiteralFormula>(true);
+        property.targetFormula = pathFormula.asEventuallyFormula().getSubformula().asSharedPointer();
+    } else if (pathFormula.isBoundedUntilFormula()) {
+        storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+        STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && !boundedUntilFormula.getTimeBoundReference().isRewardBound(),
+                        storm::exceptions::NotSupportedException,
+                        "The statistical model checker only supports bounded until formulas bounded by time or steps.");
+        STORM_LOG_THROW(!boundedUntilFormula.hasLowerBound(), storm::exceptions::NotSupportedException,
+                        "The statistical model checker does not support lower bounds of until formulas.");
+        STORM_LOG_THROW(boundedUntilFormula.hasUpperBound(), storm::exceptions::InvalidPropertyException, "Expected an upper bound of the until formula.");
+        property.type = PathProperty::Type::BoundedUntil;
+        property.conditionFormula = boundedUntilFormula.getLeftSubformula().asSharedPointer();
+        property.targetFormula = boundedUntilFormula.getRightSubformula().asSharedPointer();
+        property.isTimeBounded = isContinuousTime() && boundedUntilFormula.getTimeBoundReference().isTimeBound();
+        if (property.isTimeBounded) {
+            property.timeBound = boundedUntilFormula.template getUpperBound<double>();
+        } else {
+            property.stepBound = boundedUntilFormula.template getNonStrictUpperBound<uint64_t>();
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The statistical model checker does not support the formula " << pathFormula << ".");
+    }
+    return property;
+}
+
+template<typename ModelType>
+std::map<uint64_t, SampleStatistics> StatisticalModelChecker<ModelType>::samplePaths(Environment const& env, PathProperty const& property,
+                                                                                     StoppingCriterion const& criterion) const {
+    std::map<uint64_t, SampleStatistics> result;
+    bool isRewardProperty = property.type == PathProperty::Type::ReachabilityRewards || property.type == PathProperty::Type::CumulativeRewards;
+
+    if (!model) {
+        std::vector<std::unique_ptr<TrajectoryGenerator<ValueType>>> generators = createNextStateGenerators(property);
+        result[0] = samplePaths(generators, property, criterion);
+    } else {
+        uint64_t numberOfStates = model->getNumberOfStates();
+        storm::storage::BitVector conditionStates(numberOfStates, true);
+        storm::storage::BitVector targetStates(numberOfStates, false);
+        storm::storage::BitVector relevantStates(numberOfStates, true);
+        SparsePropositionalModelChecker<ModelType> propositionalChecker(*model);
+        if (property.conditionFormula) {
+            conditionStates = propositionalChecker.check(env, *property.conditionFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        }
+        if (property.targetFormula) {
+            targetStates = propositionalChecker.check(env, *property.targetFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        }
+
+        storm::models::sparse::StandardRewardModel<ValueType> const* rewardModel = nullptr;
+        storm::storage::BitVector infinityStates(numberOfStates, false);
+        if (isRewardProperty) {
+            rewardModel = property.rewardModelName ? &model->getRewardModel(property.rewardModelName.get()) : &model->getUniqueRewardModel();
+            if (property.type == PathProperty::Type::ReachabilityRewards) {
+                // The reward of states that do not reach the target almost surely is infinite, no paths need to be sampled.
+                infinityStates = ~storm::utility::graph::performProb1(model->getBackwardTransitions(), conditionStates, targetStates);
+            }
+        } else {
+            // Paths that enter a state from which the target is unreachable can be stopped early.
+            relevantStates = storm::utility::graph::performProbGreater0(model->getBackwardTransitions(), conditionStates, targetStates);
+        }
+
+        for (auto initialState : model->getInitialStates()) {
+            if (infinityStates.get(initialState)) {
+                SampleStatistics infiniteStatistics;
+                infiniteStatistics.add(storm::utility::infinity<double>());
+                result[initialState] = infiniteStatistics;
+            } else {
+                std::vector<std::unique_ptr<TrajectoryGenerator<ValueType>>> generators =
+                    createSparseGenerators(initialState, conditionStates, targetStates, relevantStates, rewardModel);
+                result[initialState] = samplePaths(generators, property, criterion);
+            }
+        }
+    }
+    return result;
+}
+
+template<typename ModelType>
+SampleStatistics StatisticalModelChecker<ModelType>::samplePaths(std::vector<std::unique_ptr<TrajectoryGenerator<ValueType>>>& generators,
+                                                                 PathProperty const& property, StoppingCriterion const& criterion) const {
+    uint64_t const seed = options.seed ? options.seed.get() : static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    boost::optional<uint64_t> requiredNumberOfSamples = criterion.getRequiredNumberOfSamples();
+    uint64_t const numberOfWorkers = generators.size();
+
+    // Finished batches are merged strictly in the order of their indices and the stopping criterion is checked after
+    // each merge, so the result does not depend on the number of threads or the order in which batches finish.
+    // Batches that finish before all of their predecessors are buffered, batches after the stopping batch are dropped.
+    SampleStatistics result;
+    std::mutex resultMutex;
+    std::map<uint64_t, SampleStatistics> finishedBatches;
+    uint64_t nextBatchToMerge = 0;
+    std::atomic<uint64_t> nextBatch(0);
+    std::atomic<bool> done(false);
+    std::vector<std::exception_ptr> exceptions(numberOfWorkers);
+
+    auto sampleBatches = [&](uint64_t worker) {
+        try {
+            TrajectoryGenerator<ValueType>& generator = *generators[worker];
+            while (!done.load()) {
+                uint64_t batch = nextBatch.fetch_add(1);
+                uint64_t numberOfPaths = options.batchSize;
+                if (requiredNumberOfSamples) {
+                    uint64_t firstPath = batch * options.batchSize;
+                    if (firstPath >= requiredNumberOfSamples.get()) {
+                        break;
+                    }
+                    numberOfPaths = std::min(numberOfPaths, requiredNumberOfSamples.get() - firstPath);
+                }
+
+                // Each batch has its own stream, so its paths do not depend on the thread sampling it.
+                storm::utility::RandomProbabilityGenerator<double> randomGenerator(storm::utility::getStreamSeed(seed, batch));
+                SampleStatistics batchStatistics;
+                for (uint64_t path = 0; path < numberOfPaths; ++path) {
+                    bool truncated = false;
+                    batchStatistics.add(samplePath(generator, randomGenerator, property, truncated));
+                    if (truncated) {
+                        ++batchStatistics.numberOfTruncatedPaths;
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(resultMutex);
+                if (done.load()) {
+                    break;
+                }
+                finishedBatches.emplace(batch, std::move(batchStatistics));
+                while (!done.load()) {
+                    auto batchIt = finishedBatches.find(nextBatchToMerge);
+                    if (batchIt == finishedBatches.end()) {
+                        break;
+                    }
+                    result.add(batchIt->second);
+                    finishedBatches.erase(batchIt);
+                    ++nextBatchToMerge;
+                    if (criterion.isSatisfied(result)) {
+                        done.store(true);
+                    }
+                }
+            }
+        } catch (...) {
+            exceptions[worker] = std::current_exception();
+            done.store(true);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfWorkers - 1);
+    for (uint64_t worker = 1; worker < numberOfWorkers; ++worker) {
+        threads.emplace_back(sampleBatches, worker);
+    }
+    sampleBatches(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    STORM_LOG_WARN_COND(result.numberOfTruncatedPaths == 0, result.numberOfTruncatedPaths << " of " << result.numberOfSamples
+                                                                                          << " sampled paths exceeded the maximal path length of "
+                                                                                          << options.maximalPathLength << " and were cut off.");
+    STORM_LOG_INFO("Sampled " << result.numberOfSamples << " paths using " << numberOfWorkers << " thread(s), estimated value is " << result.getMean()
+                              << ".");
+    return result;
+}
+
+template<typename ModelType>
+double StatisticalModelChecker<ModelType>::samplePath(TrajectoryGenerator<ValueType>& generator,
+                                                      storm::utility::RandomProbabilityGenerator<double>& randomGenerator, PathProperty const& property,
+                                                      bool& truncated) const {
+    generator.reset();
+    double time = 0.0;
+    double reward = 0.0;
+
+    for (uint64_t steps = 0;; ++steps) {
+        if (steps >= options.maximalPathLength) {
+            truncated = true;
+            return property.type == PathProperty::Type::ReachabilityRewards || property.type == PathProperty::Type::CumulativeRewards ? reward : 0.0;
+        }
+
+        switch (property.type) {
+            case PathProperty::Type::Until:
+            case PathProperty::Type::BoundedUntil: {
+                if (generator.isTargetSatisfied()) {
+                    return 1.0;
+                }
+                if (!generator.isConditionSatisfied() || generator.isTargetUnreachable()) {
+                    return 0.0;
+                }
+                if (property.type == PathProperty::Type::BoundedUntil) {
+                    if (property.isTimeBounded) {
+                        // Sample the sojourn time in the current state.
+                        time += -std::log1p(-randomGenerator.random()) / generator.getExitRate();
+                        if (time > property.timeBound) {
+                            return 0.0;
+                        }
+                    } else if (steps == property.stepBound) {
+                        return 0.0;
+                    }
+                }
+                if (!generator.step(randomGenerator)) {
+                    return 0.0;
+                }
+                break;
+            }
+            case PathProperty::Type::ReachabilityRewards: {
+                if (generator.isTargetSatisfied()) {
+                    return reward;
+                }
+                // In continuous time, the state reward is a rate that is collected for the expected sojourn time.
+                double stateReward = isContinuousTime() ? generator.getStateReward() / generator.getExitRate() : generator.getStateReward();
+                if (!generator.step(randomGenerator)) {
+                    // The target is never reached.
+                    return storm::utility::infinity<double>();
+                }
+                reward += stateReward + generator.getTransitionReward();
+                break;
+            }
+            case PathProperty::Type::CumulativeRewards: {
+                if (!property.isTimeBounded && steps == property.stepBound) {
+                    return reward;
+                }
+                double stateReward = generator.getStateReward();
+                double exitRate = generator.getExitRate();
+                if (!generator.step(randomGenerator)) {
+                    // The path remains in the current state, so the remaining rewards are collected at once.
+                    if (property.isTimeBounded) {
+                        reward += (property.timeBound - time) * (stateReward + exitRate * generator.getTransitionReward());
+                    } else {
+                        reward += static_cast<double>(property.stepBound - steps) * (stateReward + generator.getTransitionReward());
+                    }
+                    return reward;
+                }
+                if (property.isTimeBounded) {
+                    double sojournTime = -std::log1p(-randomGenerator.random()) / exitRate;
+                    if (time + sojournTime >= property.timeBound) {
+                        return reward + (property.timeBound - time) * stateReward;
+                    }
+                    time += sojournTime;
+                    reward += sojournTime * stateReward + generator.getTransitionReward();
+                } else {
+                    reward += stateReward + generator.getTransitionReward();
+                }
+                break;
+            }
+        }
+    }
+}
+
+template<typename ModelType>
+std::vector<std::unique_ptr<TrajectoryGenerator<typename ModelType::ValueType>>> StatisticalModelChecker<ModelType>::createSparseGenerators(
+    uint64_t initialState, storm::storage::BitVector const& conditionStates, storm::storage::BitVector const& targetStates,
+    storm::storage::BitVector const& relevantStates, storm::models::sparse::StandardRewardModel<ValueType> const* rewardModel) const {
+    std::vector<std::unique_ptr<TrajectoryGenerator<ValueType>>> generators;
+    for (uint64_t worker = 0; worker < getNumberOfWorkers(); ++worker) {
+        generators.push_back(
+            std::make_unique<SparseTrajectoryGenerator<ValueType>>(*model, initialState, conditionStates, targetStates, relevantStates, rewardModel));
+    }
+    return generators;
+}
+
+template<typename ModelType>
+std::vector<std::unique_ptr<TrajectoryGenerator<typename ModelType::ValueType>>> StatisticalModelChecker<ModelType>::createNextStateGenerators(
+    PathProperty const& property) const {
+    storm::storage::SymbolicModelDescription const& description = modelDescription.get();
+
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
+    if (description.isPrismProgram()) {
+        labelToExpressionMapping = description.asPrismProgram().getLabelToExpressionMapping();
+    } else {
+        storm::jani::Model const& janiModel = description.asJaniModel();
+        for (auto const& variable : janiModel.getGlobalVariables().getBooleanVariables()) {
+            if (variable.isTransient()) {
+                labelToExpressionMapping[variable.getName()] = janiModel.getLabelExpression(variable);
+            }
+        }
+    }
+    storm::expressions::Expression condition = property.conditionFormula
+                                                   ? property.conditionFormula->toExpression(description.getManager(), labelToExpressionMapping)
+                                                   : description.getManager().boolean(true);
+    storm::expressions::Expression target = property.targetFormula ? property.targetFormula->toExpression(description.getManager(), labelToExpressionMapping)
+                                                                   : description.getManager().boolean(false);
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    bool isRewardProperty = property.type == PathProperty::Type::ReachabilityRewards || property.type == PathProperty::Type::CumulativeRewards;
+    if (isRewardProperty) {
+        if (property.rewardModelName) {
+            generatorOptions.addRewardModel(property.rewardModelName.get());
+        } else {
+            generatorOptions.setBuildAllRewardModels();
+        }
+    }
+
+    // The generators are created before any thread starts, as they share the expression manager of the model.
+    std::vector<std::unique_ptr<TrajectoryGenerator<ValueType>>> generators;
+    for (uint64_t worker = 0; worker < getNumberOfWorkers(); ++worker) {
+        std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+        if (description.isPrismProgram()) {
+            generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(description.asPrismProgram(), generatorOptions);
+        } else {
+            generator = std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(description.asJaniModel(), generatorOptions);
+        }
+
+        boost::optional<uint64_t> rewardModelIndex;
+        if (isRewardProperty) {
+            STORM_LOG_THROW(generator->getNumberOfRewardModels() == 1, storm::exceptions::InvalidPropertyException,
+                            "Unable to determine the reward model of the property.");
+            rewardModelIndex = 0;
+        }
+        generators.push_back(std::make_unique<NextStateTrajectoryGenerator<ValueType>>(generator, condition, target, rewardModelIndex));
+    }
+    return generators;
+}
+
+template<typename ModelType>
+uint64_t StatisticalModelChecker<ModelType>::getNumberOfWorkers() const {
+    if (options.numberOfThreads == 0) {
+        return std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
+    return options.numberOfThreads;
+}
+
+template<typename ModelType>
+constexpr bool StatisticalModelChecker<ModelType>::isContinuousTime() {
+    return std::is_same<ModelType, storm::models::sparse::Ctmc<ValueType>>::value;
+}
+
+template class StatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+template class StatisticalModelChecker<storm::models::sparse::Ctmc<double>>;
+
+}  // namespace statistical
+}  // namespace modelchecker
+}  // namespace storm
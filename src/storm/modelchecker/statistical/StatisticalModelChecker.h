@@ -0,0 +1,177 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/modelchecker/statistical/StoppingCriterion.h"
+#include "storm/modelchecker/statistical/TrajectoryGenerator.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+namespace logic {
+class Formula;
+}
+
+namespace modelchecker {
+namespace statistical {
+
+/*!
+ * The options of the statistical model checker.
+ */
+struct StatisticalModelCheckerOptions {
+    // The maximal (absolute) deviation of the estimated value from the actual value. For SPRT, this is the half-width of
+    // the indifference region around the threshold.
+    double precision = 0.01;
+
+    // The maximal probability with which the estimate violates the precision (or the test gives the wrong answer).
+    double errorProbability = 0.05;
+
+    // The number of threads sampling paths. Zero selects the number of hardware threads.
+    uint64_t numberOfThreads = 1;
+
+    // If given, the seed from which the random number streams are derived. Otherwise, a time-based seed is used.
+    boost::optional<uint64_t> seed;
+
+    // Paths exceeding this number of transitions are cut off (which is reported as a warning).
+    uint64_t maximalPathLength = 1000000;
+
+    // The number of paths sampled per batch. Each batch uses its own random number stream.
+    uint64_t batchSize = 1000;
+};
+
+/*!
+ * A model checker that estimates the values of properties of DTMCs and CTMCs by sampling paths (statistical model
+ * checking). The model may either be given as a sparse model or as a PRISM program or JANI model, in which case paths
+ * are generated on the fly without building the state space. The paths are sampled by multiple threads in batches.
+ * As the i-th batch always uses the i-th random number stream and the batches are merged in the order of their
+ * indices (checking the stopping criterion after each of them), results for a fixed seed are reproducible regardless of
+ * the number of threads.
+ *
+ * Probabilities are estimated with a number of paths given by the Chernoff-Hoeffding bound, probabilities compared
+ * against a bound are decided by Wald's sequential probability ratio test and rewards are estimated until the
+ * (asymptotic) confidence interval is sufficiently small.
+ */
+template<typename ModelType>
+class StatisticalModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    /*!
+     * Creates a model checker sampling the paths of the given (sparse) model.
+     */
+    explicit StatisticalModelChecker(ModelType const& model, StatisticalModelCheckerOptions const& options = StatisticalModelCheckerOptions());
+
+    /*!
+     * Creates a model checker sampling the paths of the given PRISM program or JANI model on the fly.
+     */
+    explicit StatisticalModelChecker(storm::storage::SymbolicModelDescription const& modelDescription,
+                                     StatisticalModelCheckerOptions const& options = StatisticalModelCheckerOptions());
+
+    /*!
+     * Returns false, if this task can certainly not be handled by this model checker (independent of the concrete model).
+     */
+    static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
+                                                                   CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                    CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeCumulativeRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                  CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+
+   private:
+    /*!
+     * Describes the value of a single path.
+     */
+    struct PathProperty {
+        enum class Type { Until, BoundedUntil, ReachabilityRewards, CumulativeRewards };
+
+        Type type;
+
+        // The formulas describing the condition and target states (only for probabilities and reachability rewards).
+        std::shared_ptr<storm::logic::Formula const> conditionFormula;
+        std::shared_ptr<storm::logic::Formula const> targetFormula;
+
+        // For bounded properties, whether the bound refers to (continuous) time rather than the number of steps.
+        bool isTimeBounded = false;
+        uint64_t stepBound = 0;
+        double timeBound = 0.0;
+
+        // For rewards, the name of the reward model (or none for the unique reward model).
+        boost::optional<std::string> rewardModelName;
+    };
+
+    typedef std::function<std::unique_ptr<TrajectoryGenerator<ValueType>>()> GeneratorFactory;
+
+    /*!
+     * Translates the given (probabilistic) path formula.
+     */
+    static PathProperty getPathProperty(storm::logic::Formula const& pathFormula);
+
+    /*!
+     * Samples paths from each relevant initial state until the criterion is met.
+     *
+     * @return The statistics of the sampled paths for each initial state.
+     */
+    std::map<uint64_t, SampleStatistics> samplePaths(Environment const& env, PathProperty const& property, StoppingCriterion const& criterion) const;
+
+    /*!
+     * Samples paths generated by the given generators until the criterion is met. Each worker thread uses one generator.
+     */
+    SampleStatistics samplePaths(std::vector<std::unique_ptr<TrajectoryGenerator<ValueType>>>& generators, PathProperty const& property,
+                                 StoppingCriterion const& criterion) const;
+
+    /*!
+     * Samples a single path and computes its value.
+     *
+     * @param truncated Is set to true iff the path exceeded the maximal path length.
+     */
+    double samplePath(TrajectoryGenerator<ValueType>& generator, storm::utility::RandomProbabilityGenerator<double>& randomGenerator,
+                      PathProperty const& property, bool& truncated) const;
+
+    /*!
+     * Creates the generators for paths of the sparse model starting in the given state.
+     */
+    std::vector<std::unique_ptr<TrajectoryGenerator<ValueType>>> createSparseGenerators(
+        uint64_t initialState, storm::storage::BitVector const& conditionStates, storm::storage::BitVector const& targetStates,
+        storm::storage::BitVector const& relevantStates, storm::models::sparse::StandardRewardModel<ValueType> const* rewardModel) const;
+
+    /*!
+     * Creates the generators for paths of the PRISM program or JANI model.
+     */
+    std::vector<std::unique_ptr<TrajectoryGenerator<ValueType>>> createNextStateGenerators(PathProperty const& property) const;
+
+    /*!
+     * Retrieves the number of threads (and hence generators) to use.
+     */
+    uint64_t getNumberOfWorkers() const;
+
+    /*!
+     * Retrieves whether the model is a continuous-time model.
+     */
+    static constexpr bool isContinuousTime();
+
+    // The sparse model (if paths are sampled from a sparse model).
+    ModelType const* model;
+
+    // The PRISM program or JANI model (if paths are generated on the fly).
+    boost::optional<storm::storage::SymbolicModelDescription> modelDescription;
+
+    StatisticalModelCheckerOptions options;
+};
+
+}  // namespace statistical
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,115 @@
+#include "storm/modelchecker/statistical/StoppingCriterion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace statistical {
+
+void SampleStatistics::add(double value) {
+    ++numberOfSamples;
+    sum += value;
+    sumOfSquares += value * value;
+}
+
+void SampleStatistics::add(SampleStatistics const& other) {
+    numberOfSamples += other.numberOfSamples;
+    sum += other.sum;
+    sumOfSquares += other.sumOfSquares;
+    numberOfTruncatedPaths += other.numberOfTruncatedPaths;
+}
+
+double SampleStatistics::getMean() const {
+    return numberOfSamples == 0 ? 0.0 : sum / static_cast<double>(numberOfSamples);
+}
+
+double SampleStatistics::getVariance() const {
+    if (numberOfSamples < 2) {
+        return 0.0;
+    }
+    double n = static_cast<double>(numberOfSamples);
+    return std::max(0.0, (sumOfSquares - sum * sum / n) / (n - 1.0));
+}
+
+boost::optional<uint64_t> StoppingCriterion::getRequiredNumberOfSamples() const {
+    return boost::none;
+}
+
+ChernoffHoeffdingCriterion::ChernoffHoeffdingCriterion(double precision, double errorProbability, double range) {
+    STORM_LOG_THROW(precision > 0.0, storm::exceptions::InvalidArgumentException, "The precision must be positive.");
+    STORM_LOG_THROW(errorProbability > 0.0 && errorProbability < 1.0, storm::exceptions::InvalidArgumentException,
+                    "The error probability must be in (0,1).");
+    // P(|mean - expected| >= precision) <= 2 * exp(-2 * n * precision^2 / range^2) <= errorProbability.
+    double relativePrecision = precision / range;
+    requiredNumberOfSamples =
+        static_cast<uint64_t>(std::ceil(std::log(2.0 / errorProbability) / (2.0 * relativePrecision * relativePrecision)));
+}
+
+bool ChernoffHoeffdingCriterion::isSatisfied(SampleStatistics const& statistics) const {
+    return statistics.numberOfSamples >= requiredNumberOfSamples;
+}
+
+boost::optional<uint64_t> ChernoffHoeffdingCriterion::getRequiredNumberOfSamples() const {
+    return requiredNumberOfSamples;
+}
+
+SequentialProbabilityRatioTest::SequentialProbabilityRatioTest(double threshold, double precision, double errorProbability) {
+    STORM_LOG_THROW(precision > 0.0, storm::exceptions::InvalidArgumentException, "The precision must be positive.");
+    STORM_LOG_THROW(errorProbability > 0.0 && errorProbability < 0.5, storm::exceptions::InvalidArgumentException,
+                    "The error probability must be in (0,0.5).");
+    // Keep the indifference region within the open unit interval such that all logarithms are finite.
+    double const minimalProbability = std::numeric_limits<double>::epsilon();
+    lowerProbability = std::max(minimalProbability, threshold - precision);
+    upperProbability = std::min(1.0 - minimalProbability, threshold + precision);
+    STORM_LOG_THROW(lowerProbability < upperProbability, storm::exceptions::InvalidArgumentException,
+                    "The threshold " << threshold << " leaves an empty indifference region.");
+    acceptAboveBound = std::log((1.0 - errorProbability) / errorProbability);
+    acceptBelowBound = std::log(errorProbability / (1.0 - errorProbability));
+}
+
+double SequentialProbabilityRatioTest::getLogLikelihoodRatio(SampleStatistics const& statistics) const {
+    // The values are zero or one, so their sum is the number of successes.
+    double successes = statistics.sum;
+    double failures = static_cast<double>(statistics.numberOfSamples) - successes;
+    return successes * std::log(upperProbability / lowerProbability) + failures * std::log((1.0 - upperProbability) / (1.0 - lowerProbability));
+}
+
+bool SequentialProbabilityRatioTest::isSatisfied(SampleStatistics const& statistics) const {
+    double ratio = getLogLikelihoodRatio(statistics);
+    return ratio >= acceptAboveBound || ratio <= acceptBelowBound;
+}
+
+bool SequentialProbabilityRatioTest::isProbabilityAboveThreshold(SampleStatistics const& statistics) const {
+    STORM_LOG_ASSERT(isSatisfied(statistics), "The test has not decided yet.");
+    return getLogLikelihoodRatio(statistics) >= acceptAboveBound;
+}
+
+ConfidenceIntervalCriterion::ConfidenceIntervalCriterion(double precision, double errorProbability, uint64_t minimalNumberOfSamples)
+    : precision(precision), minimalNumberOfSamples(minimalNumberOfSamples) {
+    STORM_LOG_THROW(precision > 0.0, storm::exceptions::InvalidArgumentException, "The precision must be positive.");
+    STORM_LOG_THROW(errorProbability > 0.0 && errorProbability < 1.0, storm::exceptions::InvalidArgumentException,
+                    "The error probability must be in (0,1).");
+    quantile = boost::math::quantile(boost::math::normal_distribution<double>(), 1.0 - errorProbability / 2.0);
+}
+
+bool ConfidenceIntervalCriterion::isSatisfied(SampleStatistics const& statistics) const {
+    if (std::isinf(statistics.sum)) {
+        // A single infinite value makes the mean infinite, no matter how many paths are sampled.
+        return true;
+    }
+    if (statistics.numberOfSamples < minimalNumberOfSamples) {
+        return false;
+    }
+    return quantile * std::sqrt(statistics.getVariance() / static_cast<double>(statistics.numberOfSamples)) <= precision;
+}
+
+}  // namespace statistical
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+namespace modelchecker {
+namespace statistical {
+
+/*!
+ * Accumulates the values of sampled paths.
+ */
+struct SampleStatistics {
+    /*!
+     * Adds the value of a single path.
+     */
+    void add(double value);
+
+    /*!
+     * Adds all values accumulated in the given statistics.
+     */
+    void add(SampleStatistics const& other);
+
+    /*!
+     * Retrieves the mean of all values.
+     */
+    double getMean() const;
+
+    /*!
+     * Retrieves the (unbiased) sample variance of all values.
+     */
+    double getVariance() const;
+
+    // The number of sampled paths.
+    uint64_t numberOfSamples = 0;
+
+    // The sum of the values and of their squares.
+    double sum = 0.0;
+    double sumOfSquares = 0.0;
+
+    // The number of paths that were cut off because they exceeded the maximal path length.
+    uint64_t numberOfTruncatedPaths = 0;
+};
+
+/*!
+ * Decides when enough paths have been sampled.
+ */
+class StoppingCriterion {
+   public:
+    virtual ~StoppingCriterion() = default;
+
+    /*!
+     * Retrieves whether enough paths have been sampled to meet the criterion.
+     */
+    virtual bool isSatisfied(SampleStatistics const& statistics) const = 0;
+
+    /*!
+     * If the number of required paths is known in advance, retrieves it.
+     */
+    virtual boost::optional<uint64_t> getRequiredNumberOfSamples() const;
+};
+
+/*!
+ * Samples a fixed number of paths such that, by the Chernoff-Hoeffding bound, the mean of values from [0, range]
+ * deviates from the expected value by at least the given precision with probability at most the given error
+ * probability.
+ */
+class ChernoffHoeffdingCriterion : public StoppingCriterion {
+   public:
+    ChernoffHoeffdingCriterion(double precision, double errorProbability, double range = 1.0);
+
+    virtual bool isSatisfied(SampleStatistics const& statistics) const override;
+    virtual boost::optional<uint64_t> getRequiredNumberOfSamples() const override;
+
+   private:
+    uint64_t requiredNumberOfSamples;
+};
+
+/*!
+ * Wald's sequential probability ratio test deciding whether the success probability of Bernoulli samples is above or
+ * below a threshold. The test distinguishes between p >= threshold + precision and p <= threshold - precision (the
+ * region in between is the indifference region) such that both errors have at most the given probability.
+ */
+class SequentialProbabilityRatioTest : public StoppingCriterion {
+   public:
+    SequentialProbabilityRatioTest(double threshold, double precision, double errorProbability);
+
+    virtual bool isSatisfied(SampleStatistics const& statistics) const override;
+
+    /*!
+     * Retrieves whether the test accepts the hypothesis that the probability is above the threshold. This may only be
+     * called once the test is satisfied.
+     */
+    bool isProbabilityAboveThreshold(SampleStatistics const& statistics) const;
+
+   private:
+    double getLogLikelihoodRatio(SampleStatistics const& statistics) const;
+
+    // The probabilities bounding the indifference region.
+    double lowerProbability;
+    double upperProbability;
+
+    // The bounds of the log-likelihood ratio for accepting one of the hypotheses.
+    double acceptAboveBound;
+    double acceptBelowBound;
+};
+
+/*!
+ * Samples until the half-width of the (asymptotic, normal) confidence interval for the mean drops below the given
+ * precision (Chow-Robbins). Other than the Chernoff-Hoeffding bound, this does not require the values to be bounded,
+ * which makes it suitable for rewards.
+ */
+class ConfidenceIntervalCriterion : public StoppingCriterion {
+   public:
+    ConfidenceIntervalCriterion(double precision, double errorProbability, uint64_t minimalNumberOfSamples = 100);
+
+    virtual bool isSatisfied(SampleStatistics const& statistics) const override;
+
+   private:
+    double precision;
+    double quantile;
+    uint64_t minimalNumberOfSamples;
+};
+
+}  // namespace statistical
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,234 @@
+#include "storm/modelchecker/statistical/TrajectoryGenerator.h"
+
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace statistical {
+
+template<typename ValueType>
+bool TrajectoryGenerator<ValueType>::isTargetUnreachable() const {
+    return false;
+}
+
+template<typename ValueType>
+SparseTrajectoryGenerator<ValueType>::SparseTrajectoryGenerator(ModelType const& model, uint64_t initialState, storm::storage::BitVector const& conditionStates,
+                                                                storm::storage::BitVector const& targetStates,
+                                                                storm::storage::BitVector const& relevantStates,
+                                                                storm::models::sparse::StandardRewardModel<ValueType> const* rewardModel)
+    : model(model),
+      initialState(initialState),
+      conditionStates(conditionStates),
+      targetStates(targetStates),
+      relevantStates(relevantStates),
+      rewardModel(rewardModel),
+      rowSums(model.getTransitionMatrix().getRowSumVector()),
+      currentState(initialState),
+      transitionReward(storm::utility::zero<ValueType>()) {
+    STORM_LOG_THROW(model.isOfType(storm::models::ModelType::Dtmc) || model.isOfType(storm::models::ModelType::Ctmc), storm::exceptions::NotSupportedException,
+                    "Paths can only be generated for DTMCs and CTMCs.");
+}
+
+template<typename ValueType>
+void SparseTrajectoryGenerator<ValueType>::reset() {
+    currentState = initialState;
+    transitionReward = storm::utility::zero<ValueType>();
+}
+
+template<typename ValueType>
+bool SparseTrajectoryGenerator<ValueType>::step(storm::utility::RandomProbabilityGenerator<double>& randomGenerator) {
+    auto const& transitionMatrix = model.getTransitionMatrix();
+    auto row = transitionMatrix.getRow(currentState);
+    bool absorbing = row.getNumberOfEntries() == 1 && row.begin()->getColumn() == currentState;
+
+    auto selectedEntry = row.begin();
+    if (!absorbing) {
+        // Sample the successor by scanning the row. The last entry catches rounding errors.
+        ValueType quantile = randomGenerator.random() * rowSums[currentState];
+        auto lastEntry = row.end() - 1;
+        for (; selectedEntry != lastEntry; ++selectedEntry) {
+            if (quantile < selectedEntry->getValue()) {
+                break;
+            }
+            quantile -= selectedEntry->getValue();
+        }
+    }
+
+    transitionReward = storm::utility::zero<ValueType>();
+    if (rewardModel) {
+        if (rewardModel->hasStateActionRewards()) {
+            transitionReward += rewardModel->getStateActionReward(currentState);
+        }
+        if (rewardModel->hasTransitionRewards()) {
+            for (auto const& entry : rewardModel->getTransitionRewardMatrix().getRow(currentState)) {
+                if (entry.getColumn() == selectedEntry->getColumn()) {
+                    transitionReward += entry.getValue();
+                    break;
+                }
+            }
+        }
+    }
+
+    if (absorbing) {
+        return false;
+    }
+    currentState = selectedEntry->getColumn();
+    return true;
+}
+
+template<typename ValueType>
+bool SparseTrajectoryGenerator<ValueType>::isConditionSatisfied() const {
+    return conditionStates.get(currentState);
+}
+
+template<typename ValueType>
+bool SparseTrajectoryGenerator<ValueType>::isTargetSatisfied() const {
+    return targetStates.get(currentState);
+}
+
+template<typename ValueType>
+bool SparseTrajectoryGenerator<ValueType>::isTargetUnreachable() const {
+    return !relevantStates.get(currentState);
+}
+
+template<typename ValueType>
+ValueType SparseTrajectoryGenerator<ValueType>::getExitRate() const {
+    return rowSums[currentState];
+}
+
+template<typename ValueType>
+ValueType SparseTrajectoryGenerator<ValueType>::getStateReward() const {
+    if (rewardModel && rewardModel->hasStateRewards()) {
+        return rewardModel->getStateReward(currentState);
+    }
+    return storm::utility::zero<ValueType>();
+}
+
+template<typename ValueType>
+ValueType SparseTrajectoryGenerator<ValueType>::getTransitionReward() const {
+    return transitionReward;
+}
+
+template<typename ValueType>
+NextStateTrajectoryGenerator<ValueType>::NextStateTrajectoryGenerator(
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> const& generator, storm::expressions::Expression const& condition,
+    storm::expressions::Expression const& target, boost::optional<uint64_t> const& rewardModelIndex)
+    : generator(generator),
+      condition(condition),
+      target(target),
+      rewardModelIndex(rewardModelIndex),
+      conditionSatisfied(false),
+      targetSatisfied(false),
+      transitionReward(storm::utility::zero<ValueType>()) {
+    STORM_LOG_THROW(generator->isDeterministicModel(), storm::exceptions::NotSupportedException, "Paths can only be generated for deterministic models.");
+}
+
+template<typename ValueType>
+void NextStateTrajectoryGenerator<ValueType>::reset() {
+    discoveredStates.clear();
+    std::vector<uint32_t> initialStates = generator->getInitialStates([this](storm::generator::CompressedState const& state) {
+        discoveredStates.push_back(state);
+        return static_cast<uint32_t>(discoveredStates.size() - 1);
+    });
+    STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException, "Paths can only be generated for models with one initial state.");
+    currentState = discoveredStates[initialStates.front()];
+    transitionReward = storm::utility::zero<ValueType>();
+    exploreCurrentState();
+}
+
+template<typename ValueType>
+void NextStateTrajectoryGenerator<ValueType>::exploreCurrentState() {
+    discoveredStates.clear();
+    generator->load(currentState);
+    conditionSatisfied = generator->satisfies(condition);
+    targetSatisfied = generator->satisfies(target);
+    currentBehavior = generator->expand([this](storm::generator::CompressedState const& state) {
+        discoveredStates.push_back(state);
+        return static_cast<uint32_t>(discoveredStates.size() - 1);
+    });
+    STORM_LOG_ASSERT(currentBehavior.getNumberOfChoices() <= 1, "Expected at most one choice in a deterministic model.");
+}
+
+template<typename ValueType>
+bool NextStateTrajectoryGenerator<ValueType>::step(storm::utility::RandomProbabilityGenerator<double>& randomGenerator) {
+    transitionReward = storm::utility::zero<ValueType>();
+    if (currentBehavior.empty()) {
+        // Deadlock states are absorbing.
+        return false;
+    }
+
+    auto const& choice = currentBehavior.getChoices().front();
+    if (rewardModelIndex && !choice.getRewards().empty()) {
+        transitionReward = choice.getRewards()[rewardModelIndex.get()];
+    }
+
+    bool absorbing = true;
+    for (auto const& entry : choice) {
+        if (discoveredStates[entry.first] != currentState) {
+            absorbing = false;
+            break;
+        }
+    }
+    if (absorbing) {
+        return false;
+    }
+
+    // Sample the successor by scanning the distribution. The last entry catches rounding errors.
+    ValueType quantile = randomGenerator.random() * choice.getTotalMass();
+    uint32_t successor = 0;
+    for (auto const& entry : choice) {
+        successor = entry.first;
+        if (quantile < entry.second) {
+            break;
+        }
+        quantile -= entry.second;
+    }
+    currentState = discoveredStates[successor];
+    exploreCurrentState();
+    return true;
+}
+
+template<typename ValueType>
+bool NextStateTrajectoryGenerator<ValueType>::isConditionSatisfied() const {
+    return conditionSatisfied;
+}
+
+template<typename ValueType>
+bool NextStateTrajectoryGenerator<ValueType>::isTargetSatisfied() const {
+    return targetSatisfied;
+}
+
+template<typename ValueType>
+ValueType NextStateTrajectoryGenerator<ValueType>::getExitRate() const {
+    if (currentBehavior.empty()) {
+        return storm::utility::zero<ValueType>();
+    }
+    return currentBehavior.getChoices().front().getTotalMass();
+}
+
+template<typename ValueType>
+ValueType NextStateTrajectoryGenerator<ValueType>::getStateReward() const {
+    if (rewardModelIndex && !currentBehavior.getStateRewards().empty()) {
+        return currentBehavior.getStateRewards()[rewardModelIndex.get()];
+    }
+    return storm::utility::zero<ValueType>();
+}
+
+template<typename ValueType>
+ValueType NextStateTrajectoryGenerator<ValueType>::getTransitionReward() const {
+    return transitionReward;
+}
+
+template class TrajectoryGenerator<double>;
+template class SparseTrajectoryGenerator<double>;
+template class NextStateTrajectoryGenerator<double>;
+
+}  // namespace statistical
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/StateBehavior.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+namespace generator {
+template<typename ValueType, typename StateType>
+class NextStateGenerator;
+}
+namespace models {
+namespace sparse {
+template<typename ValueType, typename RewardModelType>
+class Model;
+template<typename ValueType>
+class StandardRewardModel;
+}  // namespace sparse
+}  // namespace models
+
+namespace modelchecker {
+namespace statistical {
+
+/*!
+ * Generates the paths of a deterministic (discrete- or continuous-time) model one transition at a time. Besides the
+ * current state, it tracks whether the condition and target of the property hold in it and which rewards are collected.
+ * Objects of this class are not thread-safe, each thread needs to use its own generator.
+ */
+template<typename ValueType>
+class TrajectoryGenerator {
+   public:
+    virtual ~TrajectoryGenerator() = default;
+
+    /*!
+     * Moves to the initial state of the model.
+     */
+    virtual void reset() = 0;
+
+    /*!
+     * Moves to a successor of the current state, sampled according to the outgoing probabilities (or rates).
+     *
+     * @return False iff the current state is absorbing, i.e., the path remains in it forever.
+     */
+    virtual bool step(storm::utility::RandomProbabilityGenerator<double>& randomGenerator) = 0;
+
+    /*!
+     * Retrieves whether the condition (left-hand side of the until) holds in the current state.
+     */
+    virtual bool isConditionSatisfied() const = 0;
+
+    /*!
+     * Retrieves whether the target holds in the current state.
+     */
+    virtual bool isTargetSatisfied() const = 0;
+
+    /*!
+     * Retrieves whether the target is known to be unreachable from the current state (via condition states).
+     */
+    virtual bool isTargetUnreachable() const;
+
+    /*!
+     * Retrieves the exit rate of the current state (only meaningful for continuous-time models).
+     */
+    virtual ValueType getExitRate() const = 0;
+
+    /*!
+     * Retrieves the state reward of the current state. For continuous-time models, this is a reward rate.
+     */
+    virtual ValueType getStateReward() const = 0;
+
+    /*!
+     * Retrieves the reward collected by the last transition, i.e., its action and transition reward. If the last call
+     * to step detected an absorbing state, this is the reward of its self-loop.
+     */
+    virtual ValueType getTransitionReward() const = 0;
+};
+
+/*!
+ * Generates the paths of an explicitly given sparse model.
+ */
+template<typename ValueType>
+class SparseTrajectoryGenerator : public TrajectoryGenerator<ValueType> {
+   public:
+    typedef storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> ModelType;
+
+    /*!
+     * Creates a generator for the given model.
+     *
+     * @param model The model (a DTMC or CTMC).
+     * @param initialState The state in which all paths start.
+     * @param conditionStates The states satisfying the condition.
+     * @param targetStates The states satisfying the target.
+     * @param relevantStates The states from which the target is reachable (other states end a path early).
+     * @param rewardModel If given, the reward model whose rewards are collected.
+     */
+    SparseTrajectoryGenerator(ModelType const& model, uint64_t initialState, storm::storage::BitVector const& conditionStates,
+                              storm::storage::BitVector const& targetStates, storm::storage::BitVector const& relevantStates,
+                              storm::models::sparse::StandardRewardModel<ValueType> const* rewardModel);
+
+    virtual void reset() override;
+    virtual bool step(storm::utility::RandomProbabilityGenerator<double>& randomGenerator) override;
+    virtual bool isConditionSatisfied() const override;
+    virtual bool isTargetSatisfied() const override;
+    virtual bool isTargetUnreachable() const override;
+    virtual ValueType getExitRate() const override;
+    virtual ValueType getStateReward() const override;
+    virtual ValueType getTransitionReward() const override;
+
+   private:
+    ModelType const& model;
+    uint64_t initialState;
+    storm::storage::BitVector const& conditionStates;
+    storm::storage::BitVector const& targetStates;
+    storm::storage::BitVector const& relevantStates;
+    storm::models::sparse::StandardRewardModel<ValueType> const* rewardModel;
+
+    // For each state, the sum of its outgoing probabilities (or rates).
+    std::vector<ValueType> rowSums;
+
+    uint64_t currentState;
+    ValueType transitionReward;
+};
+
+/*!
+ * Generates the paths of a PRISM program or JANI model on the fly using a next-state generator. Only the current state
+ * is stored, so the reachable state space is never built.
+ */
+template<typename ValueType>
+class NextStateTrajectoryGenerator : public TrajectoryGenerator<ValueType> {
+   public:
+    /*!
+     * Creates a generator.
+     *
+     * @param generator The next-state generator of the model. It must only be used by this object.
+     * @param condition The expression describing the condition.
+     * @param target The expression describing the target.
+     * @param rewardModelIndex If given, the index (within the generator) of the reward model whose rewards are collected.
+     */
+    NextStateTrajectoryGenerator(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> const& generator,
+                                 storm::expressions::Expression const& condition, storm::expressions::Expression const& target,
+                                 boost::optional<uint64_t> const& rewardModelIndex);
+
+    virtual void reset() override;
+    virtual bool step(storm::utility::RandomProbabilityGenerator<double>& randomGenerator) override;
+    virtual bool isConditionSatisfied() const override;
+    virtual bool isTargetSatisfied() const override;
+    virtual ValueType getExitRate() const override;
+    virtual ValueType getStateReward() const override;
+    virtual ValueType getTransitionReward() const override;
+
+   private:
+    /*!
+     * Evaluates the condition and target in the current state and expands it.
+     */
+    void exploreCurrentState();
+
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+    storm::expressions::Expression condition;
+    storm::expressions::Expression target;
+    boost::optional<uint64_t> rewardModelIndex;
+
+    // The states handed to the generator's callback. Their index serves as their id.
+    std::vector<storm::generator::CompressedState> discoveredStates;
+
+    storm::generator::CompressedState currentState;
+    storm::generator::StateBehavior<ValueType, uint32_t> currentBehavior;
+    bool conditionSatisfied;
+    bool targetSatisfied;
+    ValueType transitionReward;
+};
+
+}  // namespace statistical
+}  // namespace modelchecker
+}  // namespace storm
@@ -38,6 +38,7 @@
 #include "storm/settings/modules/OviSolverSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
 #include "storm/settings/modules/Smt2SmtSolverSettings.h"
+#include "storm/settings/modules/StatisticalSettings.h"
 #include "storm/settings/modules/SylvanSettings.h"
 #include "storm/settings/modules/TimeBoundedSolverSettings.h"
 #include "storm/settings/modules/TopologicalEquationSolverSettings.h"
@@ -701,6 +702,7 @@ void initializeAll(std::string const& name, std::string const& executableName) {
     storm::settings::addModule<storm::settings::modules::TopologicalEquationSolverSettings>();
     storm::settings::addModule<storm::settings::modules::Smt2SmtSolverSettings>();
     storm::settings::addModule<storm::settings::modules::ExplorationSettings>();
+    storm::settings::addModule<storm::settings::modules::StatisticalSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
     storm::settings::addModule<storm::settings::modules::AbstractionSettings>();
     storm::settings::addModule<storm::settings::modules::MultiObjectiveSettings>();
@@ -21,6 +21,8 @@ const std::string BisimulationSettings::signatureModeOptionName = "sigmode";
 const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
+const std::string BisimulationSettings::sparseRefinementModeOptionName = "sparserefine";
+const std::string BisimulationSettings::numberOfThreadsOptionName = "threads";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
@@ -91,6 +93,25 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    std::vector<std::string> sparseRefinementModes = {"splitter", "signature"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementModeOptionName, true,
+                                                   "Sets which refinement to use for sparse models. 'signature' refines all blocks at once and can use several "
+                                                   "threads (only applies to strong bisimulation).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementModes))
+                                         .setDefaultValueString("splitter")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true,
+                                                   "Sets the number of threads used for the signature-based refinement of sparse models.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of threads is auto-detected.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -173,6 +194,18 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+BisimulationSettings::SparseRefinementMode BisimulationSettings::getSparseRefinementMode() const {
+    std::string sparseRefinementModeAsString = this->getOption(sparseRefinementModeOptionName).getArgumentByName("mode").getValueAsString();
+    if (sparseRefinementModeAsString == "signature") {
+        return SparseRefinementMode::Signature;
+    }
+    return SparseRefinementMode::Splitter;
+}
+
+uint_fast64_t BisimulationSettings::getNumberOfThreads() const {
+    return this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
@@ -24,6 +24,8 @@ class BisimulationSettings : public ModuleSettings {
 
     enum class RefinementMode { Full, ChangedStates };
 
+    enum class SparseRefinementMode { Splitter, Signature };
+
     /*!
      * Creates a new set of bisimulation settings.
      */
@@ -96,6 +98,17 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves the refinement mode to use for sparse models.
+     */
+    SparseRefinementMode getSparseRefinementMode() const;
+
+    /*!
+     * Retrieves the number of threads used for the signature-based refinement of sparse models. Zero means that the number of
+     * threads is to be auto-detected.
+     */
+    uint_fast64_t getNumberOfThreads() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -111,6 +124,8 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string reuseOptionName;
     static const std::string initialPartitionOptionName;
     static const std::string refinementModeOptionName;
+    static const std::string sparseRefinementModeOptionName;
+    static const std::string numberOfThreadsOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
 };
@@ -22,6 +22,10 @@ const std::string explorationOrderOptionName = "explorder";
 const std::string explorationOrderOptionShortName = "eo";
 const std::string explorationChecksOptionName = "explchecks";
 const std::string explorationChecksOptionShortName = "ec";
+const std::string explorationThreadsOptionName = "explthreads";
+const std::string jitOptionName = "jit";
+const std::string jitCompilerOptionName = "jitcompiler";
+const std::string bytecodeOptionName = "bytecode";
 const std::string prismCompatibilityOptionName = "prismcompat";
 const std::string prismCompatibilityOptionShortName = "pc";
 const std::string dontFixDeadlockOptionName = "nofixdl";
@@ -75,6 +79,30 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("bfs")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Sets the number of threads used for explicit state-space exploration (requires bfs exploration order).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of threads is auto-detected.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, jitOptionName, false,
+                                                   "If set, the guards and updates of PRISM programs are compiled to native code for the explicit "
+                                                   "state-space exploration.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, jitCompilerOptionName, false, "Sets the C++ compiler used for the native code (see --jit).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("command", "The command that invokes the compiler.")
+                                         .setDefaultValueString("c++")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, bytecodeOptionName, false,
+                                                   "If set, the guards and updates of PRISM programs are compiled to bytecode for the explicit "
+                                                   "state-space exploration (unless they are compiled to native code, see --jit).")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false,
                                                    "If set, additional checks (if available) are performed during model exploration to debug the model.")
                         .setShortName(explorationChecksOptionShortName)
@@ -174,6 +202,22 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
 
+uint64_t BuildSettings::getNumberOfExplorationThreads() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BuildSettings::isJitSet() const {
+    return this->getOption(jitOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getJitCompiler() const {
+    return this->getOption(jitCompilerOptionName).getArgumentByName("command").getValueAsString();
+}
+
+bool BuildSettings::isBytecodeSet() const {
+    return this->getOption(bytecodeOptionName).getHasOptionBeenSet();
+}
+
 bool BuildSettings::isExplorationChecksSet() const {
     return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
 }
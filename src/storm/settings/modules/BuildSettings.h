@@ -35,6 +35,35 @@ class BuildSettings : public ModuleSettings {
      */
     storm::builder::ExplorationOrder getExplorationOrder() const;
 
+    /*!
+     * Retrieves the number of threads to use for the explicit state-space exploration. Note that a value of zero
+     * means that the number of threads is auto-detected to fit the current machine.
+     *
+     * @return The number of exploration threads.
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
+    /*!
+     * Retrieves whether the guards and updates are to be compiled to native code for the explicit exploration.
+     *
+     * @return True iff the jit option was set.
+     */
+    bool isJitSet() const;
+
+    /*!
+     * Retrieves the command that invokes the C++ compiler for the native code.
+     *
+     * @return The compiler command.
+     */
+    std::string getJitCompiler() const;
+
+    /*!
+     * Retrieves whether the guards and updates are to be compiled to bytecode for the explicit exploration.
+     *
+     * @return True iff the bytecode option was set.
+     */
+    bool isBytecodeSet() const;
+
     /*!
      * Retrieves whether the PRISM compatibility mode was enabled.
      *
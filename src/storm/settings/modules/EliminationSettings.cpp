@@ -18,9 +18,10 @@ const std::string EliminationSettings::eliminationOrderOptionName = "order";
 const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
 const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
 const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+const std::string EliminationSettings::numberOfThreadsOptionName = "threads";
 
 EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex", "minfill"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.")
             .setIsAdvanced()
@@ -54,6 +55,14 @@ EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the dedicated model elimination checker (only DTMCs).")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true,
+                                                   "Sets the number of threads used to eliminate independent states concurrently (only for non-exact models).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -85,6 +94,8 @@ EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder()
         return EliminationOrder::DynamicPenalty;
     } else if (eliminationOrderAsString == "regex") {
         return EliminationOrder::RegularExpression;
+    } else if (eliminationOrderAsString == "minfill") {
+        return EliminationOrder::MinimumFillIn;
     } else {
         STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
     }
@@ -101,6 +112,10 @@ uint_fast64_t EliminationSettings::getMaximalSccSize() const {
 bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
     return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
 }
+
+uint_fast64_t EliminationSettings::getNumberOfThreads() const {
+    return this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -79,6 +79,13 @@ class ExplorationSettings : public ModuleSettings {
      */
     double getPrecision() const;
 
+    /*!
+     * Retrieves the number of threads that concurrently sample paths.
+     *
+     * @return The number of threads. Zero means that one thread per hardware thread is to be used.
+     */
+    uint64_t getNumberOfThreads() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -92,6 +99,7 @@ class ExplorationSettings : public ModuleSettings {
     static const std::string nextStateHeuristicOptionName;
     static const std::string precisionOptionName;
     static const std::string precisionOptionShortName;
+    static const std::string numberOfThreadsOptionName;
 };
 }  // namespace modules
 }  // namespace settings
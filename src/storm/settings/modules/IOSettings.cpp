@@ -31,6 +31,8 @@ const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
 const std::string IOSettings::explicitDrnOptionShortName = "drn";
+const std::string IOSettings::explicitDrbOptionName = "explicit-drb";
+const std::string IOSettings::explicitDrbOptionShortName = "drb";
 const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
 const std::string IOSettings::explicitImcaOptionShortName = "imca";
 const std::string IOSettings::prismInputOptionName = "prism";
@@ -56,6 +58,7 @@ const std::string IOSettings::qvbsRootOptionName = "qvbsroot";
 const std::string IOSettings::propertiesAsMultiOptionName = "propsasmulti";
 
 std::string preventDRNPlaceholderOptionName = "no-drn-placeholders";
+std::string drnParsingThreadsOptionName = "drnthreads";
 
 IOSettings::IOSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -74,7 +77,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
-    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "drb", "json"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
@@ -143,6 +146,19 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, drnParsingThreadsOptionName, false, "Sets the number of threads used to parse DRN files.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of threads is auto-detected.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrbOptionName, false, "Parses the model given in the binary DRB format.")
+                        .setShortName(explicitDrbOptionShortName)
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drb filename", "The name of the DRB file containing the model.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.")
                         .setShortName(explicitImcaOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.")
@@ -366,6 +382,18 @@ std::string IOSettings::getExplicitDRNFilename() const {
     return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
 }
 
+uint64_t IOSettings::getNumberOfDrnParsingThreads() const {
+    return this->getOption(drnParsingThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool IOSettings::isExplicitDRBSet() const {
+    return this->getOption(explicitDrbOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExplicitDRBFilename() const {
+    return this->getOption(explicitDrbOptionName).getArgumentByName("drb filename").getValueAsString();
+}
+
 bool IOSettings::isExplicitIMCASet() const {
     return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
 }
@@ -522,6 +550,7 @@ bool IOSettings::check() const {
     // Ensure that not two explicit input models were given.
     uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
     numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+    numExplicitInputs += isExplicitDRBSet() ? 1 : 0;
     numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
     STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
@@ -167,6 +167,27 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExplicitDRNFilename() const;
 
+    /*!
+     * Retrieves the number of threads used to parse DRN files (0 means that the number is detected automatically).
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfDrnParsingThreads() const;
+
+    /*!
+     * Retrieves whether the explicit option with the binary DRB format was set.
+     *
+     * @return True if the explicit option with DRB was set.
+     */
+    bool isExplicitDRBSet() const;
+
+    /*!
+     * Retrieves the name of the file that contains the model in the binary DRB format.
+     *
+     * @return The name of the DRB file that contains the model.
+     */
+    std::string getExplicitDRBFilename() const;
+
     /*!
      * Retrieves whether we prevent the usage of placeholders in the explicit DRN format
      * @return
@@ -390,6 +411,8 @@ class IOSettings : public ModuleSettings {
     static const std::string explicitOptionShortName;
     static const std::string explicitDrnOptionName;
     static const std::string explicitDrnOptionShortName;
+    static const std::string explicitDrbOptionName;
+    static const std::string explicitDrbOptionShortName;
     static const std::string explicitImcaOptionName;
     static const std::string explicitImcaOptionShortName;
     static const std::string prismInputOptionName;
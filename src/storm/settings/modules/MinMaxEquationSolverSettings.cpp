@@ -24,7 +24,7 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi",     "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",          "ratsearch",
         "ii",     "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi",
-        "acyclic"};
+        "acyclic", "mp",                 "mixed-precision"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
             .setIsAdvanced()
@@ -92,6 +92,8 @@ storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvi
         return storm::solver::MinMaxMethod::ViToPi;
     } else if (minMaxEquationSolvingTechnique == "acyclic") {
         return storm::solver::MinMaxMethod::Acyclic;
+    } else if (minMaxEquationSolvingTechnique == "mixed-precision" || minMaxEquationSolvingTechnique == "mp") {
+        return storm::solver::MinMaxMethod::MixedPrecision;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
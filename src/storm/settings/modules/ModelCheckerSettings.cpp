@@ -14,6 +14,8 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::noAnalysisCacheOptionName = "no-analysis-cache";
+const std::string ModelCheckerSettings::epochThreadsOptionName = "epochthreads";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +29,19 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, noAnalysisCacheOptionName, false,
+                                                   "If set, qualitative state sets, end component decompositions and results are not reused among the "
+                                                   "properties checked on the same (sparse) MDP.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochThreadsOptionName, false,
+                                                   "Sets the number of threads that analyze independent epochs of reward-bounded properties concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of hardware threads is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +56,14 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isAnalysisCacheEnabled() const {
+    return !this->getOption(noAnalysisCacheOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getEpochThreadCount() const {
+    return this->getOption(epochThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
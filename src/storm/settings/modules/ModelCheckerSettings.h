@@ -35,6 +35,20 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether intermediate results are to be reused among the properties checked on the same model.
+     *
+     * @return True iff the analysis cache is to be used.
+     */
+    bool isAnalysisCacheEnabled() const;
+
+    /*!
+     * Retrieves the number of threads used for analyzing the epochs of a reward-bounded query.
+     *
+     * @return The number of threads. Zero means that the number of hardware threads is used.
+     */
+    uint64_t getEpochThreadCount() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +56,8 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string noAnalysisCacheOptionName;
+    static const std::string epochThreadsOptionName;
 };
 
 }  // namespace modules
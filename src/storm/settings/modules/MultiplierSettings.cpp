@@ -13,6 +13,8 @@ namespace modules {
 
 const std::string MultiplierSettings::moduleName = "multiplier";
 const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+const std::string MultiplierSettings::compactStorageOptionName = "compact";
+const std::string MultiplierSettings::vectorizeOptionName = "vectorize";
 
 MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
@@ -23,6 +25,18 @@ MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("gmmxx")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compactStorageOptionName, true,
+                                                   "If set, the native multiplier operates on a copy of the matrix that stores columns and values in "
+                                                   "separate arrays using 32 bit column indices (if possible). This saves memory bandwidth, but the "
+                                                   "copy is kept in addition to the original matrix and thus increases the memory consumption.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, vectorizeOptionName, true,
+                                                   "If set, the native multiplier uses AVX2 or AVX-512 kernels for floating point multiplications if the CPU "
+                                                   "supports them. Implies --" +
+                                                       compactStorageOptionName + ".")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -40,6 +54,14 @@ bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
     return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
 }
+
+bool MultiplierSettings::isCompactStorageSet() const {
+    return this->getOption(compactStorageOptionName).getHasOptionBeenSet();
+}
+
+bool MultiplierSettings::isVectorizeSet() const {
+    return this->getOption(vectorizeOptionName).getHasOptionBeenSet();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
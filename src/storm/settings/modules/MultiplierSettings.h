@@ -21,11 +21,30 @@ class MultiplierSettings : public ModuleSettings {
 
     bool isMultiplierTypeSetFromDefaultValue() const;
 
+    /*!
+     * Retrieves whether the native multiplier is supposed to use a compact copy of the matrix, which stores column
+     * indices and values in separate arrays and uses 32 bit column indices whenever possible. The copy is kept in
+     * addition to the original matrix, so this trades memory for faster multiplications.
+     *
+     * @return True iff the compact matrix storage is to be used.
+     */
+    bool isCompactStorageSet() const;
+
+    /*!
+     * Retrieves whether the native multiplier is supposed to use vectorized (AVX2 or AVX-512) kernels if the CPU
+     * supports them. This implies the compact matrix storage.
+     *
+     * @return True iff vectorized kernels are to be used.
+     */
+    bool isVectorizeSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string multiplierTypeOptionName;
+    static const std::string compactStorageOptionName;
+    static const std::string vectorizeOptionName;
 };
 
 }  // namespace modules
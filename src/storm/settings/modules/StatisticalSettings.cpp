@@ -0,0 +1,95 @@
+#include "storm/settings/modules/StatisticalSettings.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string StatisticalSettings::moduleName = "statistical";
+const std::string StatisticalSettings::precisionOptionName = "precision";
+const std::string StatisticalSettings::errorProbabilityOptionName = "errorprob";
+const std::string StatisticalSettings::numberOfThreadsOptionName = "threads";
+const std::string StatisticalSettings::seedOptionName = "seed";
+const std::string StatisticalSettings::maximalPathLengthOptionName = "maxpathlength";
+
+StatisticalSettings::StatisticalSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "The maximal deviation of the estimated values.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The maximal deviation.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, errorProbabilityOptionName, true,
+                                                   "The maximal probability with which an estimated value deviates by more than the precision.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error probability.")
+                                         .setDefaultValueDouble(0.05)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 0.5))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true, "Sets the number of threads sampling paths.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, one thread per hardware thread is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true,
+                                                   "Sets the seed for the random number generation. If not set, a time-based seed is used.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, maximalPathLengthOptionName, true,
+                                                   "Sets the maximal number of transitions of a sampled path. Longer paths are cut off.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal path length.")
+                                         .setDefaultValueUnsignedInteger(1000000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+}
+
+double StatisticalSettings::getPrecision() const {
+    return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double StatisticalSettings::getErrorProbability() const {
+    return this->getOption(errorProbabilityOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t StatisticalSettings::getNumberOfThreads() const {
+    return this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool StatisticalSettings::isSeedSet() const {
+    return this->getOption(seedOptionName).getHasOptionBeenSet();
+}
+
+uint64_t StatisticalSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalSettings::getMaximalPathLength() const {
+    return this->getOption(maximalPathLengthOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool StatisticalSettings::check() const {
+    bool optionsSet = this->getOption(precisionOptionName).getHasOptionBeenSet() || this->getOption(errorProbabilityOptionName).getHasOptionBeenSet() ||
+                      this->getOption(numberOfThreadsOptionName).getHasOptionBeenSet() || this->getOption(seedOptionName).getHasOptionBeenSet() ||
+                      this->getOption(maximalPathLengthOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Statistical || !optionsSet,
+                        "Statistical engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the statistical model checking engine.
+ */
+class StatisticalSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of statistical model checking settings.
+     */
+    StatisticalSettings();
+
+    /*!
+     * Retrieves the maximal deviation of the estimates from the actual values.
+     *
+     * @return The precision of the estimates.
+     */
+    double getPrecision() const;
+
+    /*!
+     * Retrieves the maximal probability with which an estimate may violate the precision.
+     *
+     * @return The error probability.
+     */
+    double getErrorProbability() const;
+
+    /*!
+     * Retrieves the number of threads used to sample paths (zero means one per hardware thread).
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves whether a seed for the random number generation was set.
+     *
+     * @return True iff a seed was set.
+     */
+    bool isSeedSet() const;
+
+    /*!
+     * Retrieves the seed for the random number generation.
+     *
+     * @return The seed.
+     */
+    uint64_t getSeed() const;
+
+    /*!
+     * Retrieves the maximal number of transitions of a sampled path.
+     *
+     * @return The maximal path length.
+     */
+    uint64_t getMaximalPathLength() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string precisionOptionName;
+    static const std::string errorProbabilityOptionName;
+    static const std::string numberOfThreadsOptionName;
+    static const std::string seedOptionName;
+    static const std::string maximalPathLengthOptionName;
+};
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -16,6 +16,8 @@ const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
 const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
 const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
 const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
+const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
+const std::string TimeBoundedSolverSettings::krylovDimensionOptionName = "krylovdim";
 
 TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> maMethods = {"imca", "unifplus"};
@@ -48,6 +50,25 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                              .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                              .build())
             .build());
+
+    std::vector<std::string> ctmcMethods = {"uniformization", "krylov"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, false,
+                                                   "The method to compute transient probabilities on CTMCs. Krylov is preferable for stiff CTMCs.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods))
+                                         .setDefaultValueString("uniformization")
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, krylovDimensionOptionName, false,
+                                                   "The dimension of the Krylov subspaces used for computing transient probabilities.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("dim", "The dimension.")
+                                         .setDefaultValueUnsignedInteger(30)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterEqualValidator(2))
+                                         .build())
+                        .build());
 }
 
 bool TimeBoundedSolverSettings::isPrecisionSet() const {
@@ -79,6 +100,18 @@ double TimeBoundedSolverSettings::getUnifPlusKappa() const {
     return this->getOption(unifPlusKappaOptionName).getArgumentByName("kappa").getValueAsDouble();
 }
 
+storm::solver::CtmcTransientMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+    std::string techniqueAsString = this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString();
+    if (techniqueAsString == "krylov") {
+        return storm::solver::CtmcTransientMethod::Krylov;
+    }
+    return storm::solver::CtmcTransientMethod::Uniformization;
+}
+
+uint64_t TimeBoundedSolverSettings::getKrylovDimension() const {
+    return this->getOption(krylovDimensionOptionName).getArgumentByName("dim").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -26,6 +26,16 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     storm::solver::MaBoundedReachabilityMethod getMaMethod() const;
 
+    /*!
+     * Retrieves the selected technique for computing transient probabilities on CTMCs.
+     */
+    storm::solver::CtmcTransientMethod getCtmcMethod() const;
+
+    /*!
+     * Retrieves the dimension of the Krylov subspaces used for computing transient probabilities.
+     */
+    uint64_t getKrylovDimension() const;
+
     /*!
      * Retrieves whether the precision has been set.
      *
@@ -58,6 +68,8 @@ class TimeBoundedSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string unifPlusKappaOptionName;
+    static const std::string ctmcMethodOptionName;
+    static const std::string krylovDimensionOptionName;
 };
 
 }  // namespace modules
@@ -23,6 +23,8 @@ namespace modules {
 const std::string TopologicalEquationSolverSettings::moduleName = "topological";
 const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
 const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
+const std::string TopologicalEquationSolverSettings::threadsOptionName = "threads";
+const std::string TopologicalEquationSolverSettings::coloredGaussSeidelOptionName = "coloredgs";
 
 TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
@@ -36,7 +38,8 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                         .build());
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi", "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",      "ratsearch",
-        "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi"};
+        "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi",
+        "mp", "mixed-precision"};
     this->addOption(storm::settings::OptionBuilder(moduleName, underlyingMinMaxMethodOptionName, true,
                                                    "Sets which minmax method is considered for solving the underlying minmax equation systems.")
                         .setIsAdvanced()
@@ -45,6 +48,19 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                                          .setDefaultValueString("value-iteration")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads used to solve SCCs that do not depend on each other concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of threads is auto-detected.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, coloredGaussSeidelOptionName, true,
+                                                   "If set, large SCCs are solved by multi-colored Gauss-Seidel value iteration, which updates the states of "
+                                                   "each color concurrently.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -97,11 +113,21 @@ storm::solver::MinMaxMethod TopologicalEquationSolverSettings::getUnderlyingMinM
         return storm::solver::MinMaxMethod::OptimisticValueIteration;
     } else if (minMaxEquationSolvingTechnique == "vi-to-pi") {
         return storm::solver::MinMaxMethod::ViToPi;
+    } else if (minMaxEquationSolvingTechnique == "mixed-precision" || minMaxEquationSolvingTechnique == "mp") {
+        return storm::solver::MinMaxMethod::MixedPrecision;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
 }
 
+uint64_t TopologicalEquationSolverSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool TopologicalEquationSolverSettings::isColoredGaussSeidelSet() const {
+    return this->getOption(coloredGaussSeidelOptionName).getHasOptionBeenSet();
+}
+
 bool TopologicalEquationSolverSettings::check() const {
     if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
         STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
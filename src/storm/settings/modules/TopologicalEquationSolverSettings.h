@@ -60,6 +60,20 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
 
+    /*!
+     * Retrieves the number of threads that are used to solve independent SCCs concurrently.
+     *
+     * @return The number of threads (zero means that the number of threads is to be auto-detected).
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves whether large SCCs are to be solved with multi-colored Gauss-Seidel value iteration.
+     *
+     * @return True iff the option was set.
+     */
+    bool isColoredGaussSeidelSet() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -69,6 +83,8 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string underlyingEquationSolverOptionName;
     static const std::string underlyingMinMaxMethodOptionName;
+    static const std::string threadsOptionName;
+    static const std::string coloredGaussSeidelOptionName;
 };
 
 }  // namespace modules
@@ -16,6 +16,7 @@ const std::string TransformationSettings::chainEliminationOptionName = "eliminat
 const std::string TransformationSettings::labelBehaviorOptionName = "ec-label-behavior";
 const std::string TransformationSettings::toNondetOptionName = "to-nondet";
 const std::string TransformationSettings::toDiscreteTimeOptionName = "to-discrete";
+const std::string TransformationSettings::statePermutationOptionName = "permute-states";
 
 TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, chainEliminationOptionName, false,
@@ -46,6 +47,19 @@ TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
                                                    "If set, CTMCs/MAs are converted to DTMCs/MDPs (which might or might not preserve the provided properties).")
                         .setIsAdvanced()
                         .build());
+    std::vector<std::string> statePermutationOrders = {"rcm", "scc", "partition"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, statePermutationOptionName, false,
+                                       "If set, the states of sparse models are renumbered before model checking to improve the memory locality.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "order",
+                             "The order of the states. 'rcm' is the reverse Cuthill-McKee order, 'scc' numbers the states SCC by SCC in topological order, "
+                             "'partition' numbers the states block by block, where each block is a cache-sized part of the state space.")
+                             .setDefaultValueString("rcm")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(statePermutationOrders))
+                             .build())
+            .build());
 }
 
 bool TransformationSettings::isChainEliminationSet() const {
@@ -73,6 +87,22 @@ bool TransformationSettings::isToDiscreteTimeModelSet() const {
     return this->getOption(toDiscreteTimeOptionName).getHasOptionBeenSet();
 }
 
+bool TransformationSettings::isStatePermutationSet() const {
+    return this->getOption(statePermutationOptionName).getHasOptionBeenSet();
+}
+
+storm::transformer::StatePermutationOrder TransformationSettings::getStatePermutationOrder() const {
+    std::string orderAsString = this->getOption(statePermutationOptionName).getArgumentByName("order").getValueAsString();
+    if (orderAsString == "rcm") {
+        return storm::transformer::StatePermutationOrder::ReverseCuthillMcKee;
+    } else if (orderAsString == "scc") {
+        return storm::transformer::StatePermutationOrder::SccTopological;
+    } else if (orderAsString == "partition") {
+        return storm::transformer::StatePermutationOrder::Partition;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal value '" << orderAsString << "' set as state permutation order.");
+}
+
 bool TransformationSettings::check() const {
     // Ensure that labeling preservation is only set if chain elimination is set
     STORM_LOG_THROW(isChainEliminationSet() || !this->getOption(labelBehaviorOptionName).getHasOptionBeenSet(), storm::exceptions::InvalidSettingsException,
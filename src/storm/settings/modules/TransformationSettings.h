@@ -43,6 +43,18 @@ class TransformationSettings : public ModuleSettings {
      */
     bool isToDiscreteTimeModelSet() const;
 
+    /*!
+     * Retrieves whether the states of the model should be renumbered before model checking.
+     */
+    bool isStatePermutationSet() const;
+
+    /*!
+     * Retrieves the order in which the states of the model are renumbered.
+     *
+     * @return the state permutation order
+     */
+    storm::transformer::StatePermutationOrder getStatePermutationOrder() const;
+
     bool check() const override;
 
     void finalize() override;
@@ -56,6 +68,7 @@ class TransformationSettings : public ModuleSettings {
     static const std::string labelBehaviorOptionName;
     static const std::string toNondetOptionName;
     static const std::string toDiscreteTimeOptionName;
+    static const std::string statePermutationOptionName;
 };
 
 }  // namespace modules
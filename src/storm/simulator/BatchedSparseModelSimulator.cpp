@@ -0,0 +1,231 @@
+#include "storm/simulator/BatchedSparseModelSimulator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace simulator {
+
+namespace {
+// The number of trajectories sharing a random number stream. Chunks are also the unit of work of the threads.
+uint64_t const chunkSize = 1024;
+// The minimal number of chunks per thread. Threads are started for every step, so smaller batches are advanced sequentially.
+uint64_t const minimalChunksPerThread = 8;
+}  // namespace
+
+template<typename ValueType, typename RewardModelType>
+BatchedSparseModelSimulator<ValueType, RewardModelType>::BatchedSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model,
+                                                                                     uint64_t numberOfTrajectories, uint64_t numberOfThreads)
+    : model(model),
+      numberOfThreads(numberOfThreads == 0 ? std::max<uint64_t>(1, std::thread::hardware_concurrency()) : numberOfThreads),
+      initialState(*model.getInitialStates().begin()),
+      currentStates(numberOfTrajectories, initialState),
+      lastRewards(model.getNumberOfRewardModels(), std::vector<ValueType>(numberOfTrajectories, storm::utility::zero<ValueType>())),
+      generators((numberOfTrajectories + chunkSize - 1) / chunkSize) {
+    STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1,
+                        "The model has multiple initial states. This simulator assumes it starts from the initial state with the lowest index.");
+    for (auto const& rewardModel : model.getRewardModels()) {
+        stateRewards.push_back(rewardModel.second.hasStateRewards() ? &rewardModel.second.getStateRewardVector() : nullptr);
+        stateActionRewards.push_back(rewardModel.second.hasStateActionRewards() ? &rewardModel.second.getStateActionRewardVector() : nullptr);
+    }
+    buildAliasTables();
+    resetToInitial();
+}
+
+template<typename ValueType, typename RewardModelType>
+void BatchedSparseModelSimulator<ValueType, RewardModelType>::buildAliasTables() {
+    auto const& matrix = model.getTransitionMatrix();
+    rowStarts.reserve(matrix.getRowCount() + 1);
+    successors.reserve(matrix.getEntryCount());
+    aliases.reserve(matrix.getEntryCount());
+    thresholds.reserve(matrix.getEntryCount());
+
+    // Vose's alias method: every slot of a row's table holds one entry and (possibly) an alias, such that choosing a slot
+    // uniformly and then the entry or its alias according to the threshold yields the distribution of the row.
+    std::vector<double> scaledProbabilities;
+    std::vector<uint64_t> small;
+    std::vector<uint64_t> large;
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        uint64_t const rowStart = successors.size();
+        rowStarts.push_back(rowStart);
+
+        double rowSum = 0.0;
+        for (auto const& entry : matrix.getRow(row)) {
+            rowSum += storm::utility::convertNumber<double>(entry.getValue());
+        }
+        uint64_t const numberOfEntries = matrix.getRow(row).getNumberOfEntries();
+        STORM_LOG_THROW(numberOfEntries > 0 && rowSum > 0.0, storm::exceptions::InvalidArgumentException,
+                        "Row " << row << " of the transition matrix does not describe a probability distribution.");
+
+        scaledProbabilities.clear();
+        small.clear();
+        large.clear();
+        for (auto const& entry : matrix.getRow(row)) {
+            uint64_t slot = successors.size() - rowStart;
+            successors.push_back(entry.getColumn());
+            aliases.push_back(entry.getColumn());
+            thresholds.push_back(1.0);
+            scaledProbabilities.push_back(storm::utility::convertNumber<double>(entry.getValue()) * numberOfEntries / rowSum);
+            (scaledProbabilities.back() < 1.0 ? small : large).push_back(slot);
+        }
+        while (!small.empty() && !large.empty()) {
+            uint64_t smallSlot = small.back();
+            small.pop_back();
+            uint64_t largeSlot = large.back();
+            large.pop_back();
+
+            thresholds[rowStart + smallSlot] = scaledProbabilities[smallSlot];
+            aliases[rowStart + smallSlot] = successors[rowStart + largeSlot];
+            scaledProbabilities[largeSlot] -= 1.0 - scaledProbabilities[smallSlot];
+            (scaledProbabilities[largeSlot] < 1.0 ? small : large).push_back(largeSlot);
+        }
+        // The remaining slots (only left over due to rounding errors) always choose their own entry.
+    }
+    rowStarts.push_back(successors.size());
+}
+
+template<typename ValueType, typename RewardModelType>
+void BatchedSparseModelSimulator<ValueType, RewardModelType>::setSeed(uint64_t seed) {
+    for (uint64_t chunk = 0; chunk < generators.size(); ++chunk) {
+        generators[chunk] = storm::utility::RandomProbabilityGenerator<double>(storm::utility::getStreamSeed(seed, chunk));
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+void BatchedSparseModelSimulator<ValueType, RewardModelType>::step(std::vector<uint64_t> const& actions) {
+    STORM_LOG_THROW(actions.size() == currentStates.size(), storm::exceptions::InvalidArgumentException,
+                    "Expected " << currentStates.size() << " actions, but got " << actions.size() << ".");
+    auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+    for (uint64_t trajectory = 0; trajectory < currentStates.size(); ++trajectory) {
+        uint64_t state = currentStates[trajectory];
+        STORM_LOG_THROW(actions[trajectory] < rowGroupIndices[state + 1] - rowGroupIndices[state], storm::exceptions::InvalidArgumentException,
+                        "Action index " << actions[trajectory] << " of trajectory " << trajectory << " is higher than the number of actions.");
+    }
+    performStep(&actions);
+}
+
+template<typename ValueType, typename RewardModelType>
+void BatchedSparseModelSimulator<ValueType, RewardModelType>::randomStep() {
+    performStep(nullptr);
+}
+
+template<typename ValueType, typename RewardModelType>
+void BatchedSparseModelSimulator<ValueType, RewardModelType>::performStep(std::vector<uint64_t> const* actions) {
+    auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+    uint64_t const numberOfRewardModels = lastRewards.size();
+
+    auto advanceChunk = [&](uint64_t chunk) {
+        storm::utility::RandomProbabilityGenerator<double>& generator = generators[chunk];
+        uint64_t const chunkEnd = std::min<uint64_t>((chunk + 1) * chunkSize, currentStates.size());
+        for (uint64_t trajectory = chunk * chunkSize; trajectory < chunkEnd; ++trajectory) {
+            uint64_t const state = currentStates[trajectory];
+            uint64_t row = rowGroupIndices[state];
+            if (actions) {
+                row += (*actions)[trajectory];
+            } else {
+                uint64_t const numberOfActions = rowGroupIndices[state + 1] - row;
+                if (numberOfActions > 1) {
+                    row += std::min<uint64_t>(static_cast<uint64_t>(generator.random() * numberOfActions), numberOfActions - 1);
+                }
+            }
+
+            uint64_t const rowStart = rowStarts[row];
+            uint64_t const numberOfEntries = rowStarts[row + 1] - rowStart;
+            STORM_LOG_ASSERT(numberOfEntries > 0, "Row " << row << " of the transition matrix is empty.");
+            uint64_t successor = successors[rowStart];
+            if (numberOfEntries > 1) {
+                double const scaled = generator.random() * numberOfEntries;
+                uint64_t const slot = std::min<uint64_t>(static_cast<uint64_t>(scaled), numberOfEntries - 1);
+                successor = scaled - slot < thresholds[rowStart + slot] ? successors[rowStart + slot] : aliases[rowStart + slot];
+            }
+            currentStates[trajectory] = successor;
+
+            for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+                ValueType reward = storm::utility::zero<ValueType>();
+                if (stateActionRewards[rewardModel]) {
+                    reward += (*stateActionRewards[rewardModel])[row];
+                }
+                if (stateRewards[rewardModel]) {
+                    reward += (*stateRewards[rewardModel])[successor];
+                }
+                lastRewards[rewardModel][trajectory] = reward;
+            }
+        }
+    };
+
+    uint64_t const numberOfChunks = generators.size();
+    uint64_t const numberOfWorkers = std::min(numberOfThreads, numberOfChunks / minimalChunksPerThread);
+    if (numberOfWorkers <= 1) {
+        for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+            advanceChunk(chunk);
+        }
+        return;
+    }
+
+    // Chunks are independent (each has its own random number stream and trajectories), so the threads just claim them.
+    std::atomic<uint64_t> nextChunk(0);
+    auto advanceChunks = [&]() {
+        for (uint64_t chunk = nextChunk.fetch_add(1); chunk < numberOfChunks; chunk = nextChunk.fetch_add(1)) {
+            advanceChunk(chunk);
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfWorkers - 1);
+    for (uint64_t worker = 1; worker < numberOfWorkers; ++worker) {
+        threads.emplace_back(advanceChunks);
+    }
+    advanceChunks();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+void BatchedSparseModelSimulator<ValueType, RewardModelType>::resetToInitial() {
+    for (uint64_t trajectory = 0; trajectory < currentStates.size(); ++trajectory) {
+        resetToInitial(trajectory);
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+void BatchedSparseModelSimulator<ValueType, RewardModelType>::resetToInitial(uint64_t trajectory) {
+    STORM_LOG_ASSERT(trajectory < currentStates.size(), "Invalid trajectory index.");
+    currentStates[trajectory] = initialState;
+    setStateRewards(trajectory);
+}
+
+template<typename ValueType, typename RewardModelType>
+void BatchedSparseModelSimulator<ValueType, RewardModelType>::setStateRewards(uint64_t trajectory) {
+    for (uint64_t rewardModel = 0; rewardModel < lastRewards.size(); ++rewardModel) {
+        lastRewards[rewardModel][trajectory] =
+            stateRewards[rewardModel] ? (*stateRewards[rewardModel])[currentStates[trajectory]] : storm::utility::zero<ValueType>();
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t BatchedSparseModelSimulator<ValueType, RewardModelType>::getNumberOfTrajectories() const {
+    return currentStates.size();
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<uint64_t> const& BatchedSparseModelSimulator<ValueType, RewardModelType>::getCurrentStates() const {
+    return currentStates;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> const& BatchedSparseModelSimulator<ValueType, RewardModelType>::getLastRewards(uint64_t rewardModelIndex) const {
+    STORM_LOG_ASSERT(rewardModelIndex < lastRewards.size(), "Invalid reward model index.");
+    return lastRewards[rewardModelIndex];
+}
+
+template class BatchedSparseModelSimulator<double>;
+template class BatchedSparseModelSimulator<storm::RationalNumber>;
+
+}  // namespace simulator
+}  // namespace storm
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+namespace simulator {
+
+/**
+ * This class advances many trajectories of a discrete-time model (stored explicitly as a SparseModel) at once.
+ * In contrast to the DiscreteTimeSparseModelSimulator, each call performs one step for all trajectories, which makes
+ * the per-call overhead negligible when driving the simulation from a (scripted) training loop.
+ *
+ * Successors are sampled in constant time from alias tables that are precomputed for every row of the transition matrix.
+ * The current states and the rewards of the last step are stored as one contiguous vector per quantity (i.e., indexed
+ * by the trajectory), such that they can be handed over without copying.
+ *
+ * The trajectories are split into fixed-size chunks, each of which uses its own random number stream. Hence, for a
+ * fixed seed, the trajectories do not depend on the number of threads. As the threads are started for every step,
+ * they are only used if each of them can advance several chunks; small batches are advanced sequentially.
+ *
+ * @tparam ValueType
+ * @tparam RewardModelType
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+class BatchedSparseModelSimulator {
+   public:
+    /**
+     * Initialize the simulator. All trajectories start in the initial state with the lowest index.
+     *
+     * @param model The model to simulate.
+     * @param numberOfTrajectories The number of trajectories that are advanced simultaneously.
+     * @param numberOfThreads The number of threads used to advance the trajectories (zero selects one per hardware thread).
+     */
+    BatchedSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model, uint64_t numberOfTrajectories,
+                                uint64_t numberOfThreads = 1);
+
+    /**
+     * Set the simulation seed. This resets the random number streams of all trajectories.
+     */
+    void setSeed(uint64_t seed);
+
+    /**
+     * Perform one step in every trajectory.
+     *
+     * @param actions For each trajectory, the (local) index of the action to take in its current state.
+     */
+    void step(std::vector<uint64_t> const& actions);
+
+    /**
+     * Perform one step in every trajectory, where the action is chosen uniformly at random.
+     */
+    void randomStep();
+
+    /**
+     * Reset all trajectories to the initial state.
+     */
+    void resetToInitial();
+
+    /**
+     * Reset a single trajectory to the initial state.
+     */
+    void resetToInitial(uint64_t trajectory);
+
+    /**
+     * @return The number of trajectories.
+     */
+    uint64_t getNumberOfTrajectories() const;
+
+    /**
+     * @return For each trajectory, its current state.
+     */
+    std::vector<uint64_t> const& getCurrentStates() const;
+
+    /**
+     * Get the rewards collected in the last step (or the state rewards of the initial state after a reset).
+     *
+     * @param rewardModelIndex The index of the reward model (in the order of the reward models of the model).
+     * @return For each trajectory, the reward of the last step.
+     */
+    std::vector<ValueType> const& getLastRewards(uint64_t rewardModelIndex) const;
+
+   private:
+    /**
+     * Builds the alias tables of all rows of the transition matrix.
+     */
+    void buildAliasTables();
+
+    /**
+     * Advances all trajectories by one step.
+     *
+     * @param actions If not null, the actions to take. Otherwise, actions are chosen uniformly at random.
+     */
+    void performStep(std::vector<uint64_t> const* actions);
+
+    /**
+     * Sets the rewards of the given trajectory to the state rewards of its current state.
+     */
+    void setStateRewards(uint64_t trajectory);
+
+    storm::models::sparse::Model<ValueType, RewardModelType> const& model;
+    uint64_t numberOfThreads;
+    uint64_t initialState;
+
+    // The start of each row's alias table (and the end of the last one).
+    std::vector<uint64_t> rowStarts;
+    // For each entry of the transition matrix, the column of the entry itself and the column of its alias as well as the
+    // probability with which the entry (rather than its alias) is chosen.
+    std::vector<uint64_t> successors;
+    std::vector<uint64_t> aliases;
+    std::vector<double> thresholds;
+
+    // The state (action) rewards of all reward models (null if the reward model does not have them).
+    std::vector<std::vector<ValueType> const*> stateRewards;
+    std::vector<std::vector<ValueType> const*> stateActionRewards;
+
+    std::vector<uint64_t> currentStates;
+    std::vector<std::vector<ValueType>> lastRewards;
+
+    // One random number generator for each chunk of trajectories.
+    std::vector<storm::utility::RandomProbabilityGenerator<double>> generators;
+};
+}  // namespace simulator
+}  // namespace storm
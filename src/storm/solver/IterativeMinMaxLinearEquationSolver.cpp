@@ -5,9 +5,11 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
+#include "storm/solver/helper/SinglePrecisionValueIterationHelper.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/utility/ConstantsComparator.h"
@@ -46,7 +48,8 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environme
     // Adjust the method if none was specified and we want exact or sound computations.
     auto method = env.solver().minMax().getMethod();
 
-    if (isExactMode && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::ViToPi) {
+    if (isExactMode && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::ViToPi &&
+        method != MinMaxMethod::MixedPrecision) {
         if (env.solver().minMax().isMethodSetFromDefault()) {
             STORM_LOG_INFO(
                 "Selecting 'Policy iteration' as the solution technique to guarantee exact results. If you want to override this, please explicitly specify a "
@@ -56,7 +59,8 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environme
             STORM_LOG_WARN("The selected solution method " << toString(method) << " does not guarantee exact results.");
         }
     } else if (env.solver().isForceSoundness() && method != MinMaxMethod::SoundValueIteration && method != MinMaxMethod::IntervalIteration &&
-               method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::OptimisticValueIteration) {
+               method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::OptimisticValueIteration &&
+               method != MinMaxMethod::MixedPrecision) {
         if (env.solver().minMax().isMethodSetFromDefault()) {
             method = MinMaxMethod::OptimisticValueIteration;
             STORM_LOG_INFO(
@@ -69,7 +73,7 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environme
     }
     STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
                         method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration ||
-                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi,
+                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi || method == MinMaxMethod::MixedPrecision,
                     storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
     return method;
 }
@@ -100,6 +104,9 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Envi
         case MinMaxMethod::ViToPi:
             result = solveEquationsViToPi(env, dir, x, b);
             break;
+        case MinMaxMethod::MixedPrecision:
+            result = solveEquationsMixedPrecision(env, dir, x, b);
+            break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -267,6 +274,7 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
     needsLinEqSolver |= method == MinMaxMethod::PolicyIteration;
     needsLinEqSolver |= method == MinMaxMethod::ValueIteration && (this->hasInitialScheduler() || hasInitialScheduler);
     needsLinEqSolver |= method == MinMaxMethod::ViToPi;
+    needsLinEqSolver |= method == MinMaxMethod::MixedPrecision;
     MinMaxLinearEquationSolverRequirements requirements = needsLinEqSolver
                                                               ? MinMaxLinearEquationSolverRequirements(this->linearEquationSolverFactory->getRequirements(env))
                                                               : MinMaxLinearEquationSolverRequirements();
@@ -316,7 +324,7 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
             requirements.requireUniqueSolution();
         }
         requirements.requireBounds(false);
-    } else if (method == MinMaxMethod::ViToPi) {
+    } else if (method == MinMaxMethod::ViToPi || method == MinMaxMethod::MixedPrecision) {
         // Since we want to use value iteration to extract an initial scheduler, the solution has to be unique.
         if (!this->hasUniqueSolution()) {
             requirements.requireUniqueSolution();
@@ -820,6 +828,149 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsViToPi(Enviro
     return performPolicyIteration(env, dir, x, b, std::move(initialSched));
 }
 
+template<typename ValueType>
+std::vector<storm::storage::sparse::state_type> IterativeMinMaxLinearEquationSolver<ValueType>::computePolicyWithReducedPrecision(
+    Environment const& env, OptimizationDirection dir, std::vector<ValueType> const& x, std::vector<ValueType> const& b,
+    std::vector<double>& impreciseX) const {
+    uint64_t const maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+    bool const relative = env.solver().minMax().getRelativeTerminationCriterion();
+    double const precision = storm::utility::convertNumber<double>(env.solver().minMax().getPrecision());
+
+    // First iterate in single precision until the values are (roughly) as close to the solution as this precision allows.
+    uint64_t singlePrecisionIterations = 0;
+    if (!storm::solver::helper::SinglePrecisionValueIterationHelper<ValueType>::canHandle(*this->A)) {
+        STORM_LOG_WARN("The matrix is too large for value iteration in single precision. Starting directly with double precision.");
+        impreciseX = storm::utility::vector::convertNumericVector<double>(x);
+    } else {
+        if (!this->singlePrecisionValueIterationHelper) {
+            this->singlePrecisionValueIterationHelper = std::make_unique<storm::solver::helper::SinglePrecisionValueIterationHelper<ValueType>>(*this->A);
+        }
+        std::vector<float> singlePrecisionX = storm::solver::helper::SinglePrecisionValueIterationHelper<ValueType>::toSinglePrecision(x);
+        std::vector<float> singlePrecisionB = storm::solver::helper::SinglePrecisionValueIterationHelper<ValueType>::toSinglePrecision(b);
+
+        // The single precision stage is only meant to cheaply get close to the solution, so its number of iterations is
+        // bounded. If it does not converge within them, the double precision stage simply has more work to do.
+        uint64_t const maximalNumberOfSinglePrecisionIterations = std::min<uint64_t>(maximalNumberOfIterations, 10000);
+        if (!this->singlePrecisionValueIterationHelper->performValueIteration(dir, singlePrecisionX, singlePrecisionB,
+                                                                              static_cast<float>(std::max(precision, 1e-5)), relative,
+                                                                              maximalNumberOfSinglePrecisionIterations, singlePrecisionIterations)) {
+            STORM_LOG_INFO("Value iteration in single precision did not converge within " << singlePrecisionIterations
+                                                                                          << " iterations. Continuing in double precision.");
+        }
+        impreciseX.assign(singlePrecisionX.begin(), singlePrecisionX.end());
+    }
+    STORM_LOG_INFO("Value iteration in single precision performed " << singlePrecisionIterations << " iterations.");
+
+    // Then continue in double precision until the requested precision is reached.
+    storm::storage::SparseMatrix<double> doubleA;
+    std::vector<double> doubleBStorage;
+    std::unique_ptr<IterativeMinMaxLinearEquationSolver<double>> doubleSolverStorage;
+    IterativeMinMaxLinearEquationSolver<double> const* doubleSolver;
+    std::vector<double> const* doubleB;
+    if constexpr (std::is_same<ValueType, double>::value) {
+        doubleSolver = this;
+        doubleB = &b;
+        if (!this->multiplierA) {
+            this->multiplierA = storm::solver::MultiplierFactory<double>().create(env, *this->A);
+        }
+    } else {
+        doubleA = this->A->template toValueType<double>();
+        doubleBStorage = storm::utility::vector::convertNumericVector<double>(b);
+        doubleB = &doubleBStorage;
+        doubleSolverStorage = std::make_unique<IterativeMinMaxLinearEquationSolver<double>>(
+            doubleA, std::make_unique<storm::solver::GeneralLinearEquationSolverFactory<double>>());
+        doubleSolverStorage->multiplierA = storm::solver::MultiplierFactory<double>().create(env, doubleA);
+        doubleSolver = doubleSolverStorage.get();
+    }
+    std::vector<double> tmpX(impreciseX.size());
+    std::vector<double>* currentX = &impreciseX;
+    std::vector<double>* newX = &tmpX;
+    auto result = doubleSolver->performValueIteration(env, dir, currentX, newX, *doubleB, precision, relative, SolverGuarantee::None,
+                                                      singlePrecisionIterations, maximalNumberOfIterations, env.solver().minMax().getMultiplicationStyle());
+    if (currentX != &impreciseX) {
+        std::swap(impreciseX, tmpX);
+    }
+    STORM_LOG_INFO("Value iteration in double precision performed " << result.iterations << " iterations.");
+
+    std::vector<storm::storage::sparse::state_type> policy(impreciseX.size());
+    for (uint64_t group = 0; group < policy.size(); ++group) {
+        doubleSolver->computeOptimalValueForRowGroup(group, dir, impreciseX, *doubleB, &policy[group]);
+    }
+    return policy;
+}
+
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsMixedPrecision(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                                  std::vector<ValueType> const& b) const {
+    STORM_LOG_THROW(!this->choiceFixedForRowGroup, storm::exceptions::NotImplementedException,
+                    "Fixing scheduler choices not implemented for the mixed precision method, please pick a different solver");
+
+    // Get close to the solution with cheap (low precision) arithmetic.
+    std::vector<double> impreciseX;
+    std::vector<storm::storage::sparse::state_type> policy = computePolicyWithReducedPrecision(env, dir, x, b, impreciseX);
+
+    // Exact arithmetic is only used from here on. For inexact value types, the problem is solved by a rational solver
+    // whose result is converted back afterwards.
+    typedef typename std::conditional<NumberTraits<ValueType>::IsExact, ValueType, storm::RationalNumber>::type RationalType;
+    storm::storage::SparseMatrix<RationalType> rationalA;
+    std::vector<RationalType> rationalB;
+    std::vector<RationalType> rationalX;
+    std::unique_ptr<IterativeMinMaxLinearEquationSolver<RationalType>> rationalSolverStorage;
+    IterativeMinMaxLinearEquationSolver<RationalType> const* rationalSolver;
+    std::vector<RationalType> const* exactB;
+    std::vector<RationalType>* exactX;
+    if constexpr (std::is_same<ValueType, RationalType>::value) {
+        rationalSolver = this;
+        exactB = &b;
+        exactX = &x;
+    } else {
+        rationalA = this->A->template toValueType<RationalType>();
+        rationalB = storm::utility::vector::convertNumericVector<RationalType>(b);
+        rationalX.resize(x.size());
+        rationalSolverStorage = std::make_unique<IterativeMinMaxLinearEquationSolver<RationalType>>(
+            rationalA, std::make_unique<storm::solver::GeneralLinearEquationSolverFactory<RationalType>>());
+        rationalSolverStorage->setHasUniqueSolution(this->hasUniqueSolution());
+        rationalSolverStorage->setHasNoEndComponents(this->hasNoEndComponents());
+        rationalSolverStorage->setTrackScheduler(this->isTrackSchedulerSet());
+        rationalSolver = rationalSolverStorage.get();
+        exactB = &rationalB;
+        exactX = &rationalX;
+    }
+
+    bool converged;
+    uint64_t sharpenPrecision =
+        static_cast<uint64_t>(std::ceil(std::log10(1.0 / storm::utility::convertNumber<double>(env.solver().minMax().getPrecision()))));
+    if (sharpen(dir, sharpenPrecision, *rationalSolver->A, impreciseX, *exactB, *exactX)) {
+        // As in rational search, the rounded values already form the exact solution.
+        STORM_LOG_INFO("Sharpening the values of the reduced precision value iteration yields the exact solution.");
+        converged = true;
+        if (this->isTrackSchedulerSet()) {
+            std::vector<uint_fast64_t> choices(exactX->size());
+            for (uint64_t group = 0; group < choices.size(); ++group) {
+                rationalSolver->computeOptimalValueForRowGroup(group, dir, *exactX, *exactB, &choices[group]);
+            }
+            this->schedulerChoices = std::move(choices);
+        }
+    } else {
+        // Evaluate the policy exactly and improve it until it is optimal.
+        STORM_LOG_INFO("Found initial policy using reduced precision value iteration. Starting exact policy iteration now.");
+        Environment exactEnv = env;
+        exactEnv.solver().setForceExact(true);
+        converged = rationalSolver->performPolicyIteration(exactEnv, dir, *exactX, *exactB, std::move(policy));
+        if (rationalSolverStorage && this->isTrackSchedulerSet()) {
+            this->schedulerChoices = rationalSolver->getSchedulerChoices();
+        }
+    }
+
+    if constexpr (!std::is_same<ValueType, RationalType>::value) {
+        x = storm::utility::vector::convertNumericVector<ValueType>(rationalX);
+    }
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    return converged;
+}
+
 template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::isSolution(storm::OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix,
                                                                 std::vector<ValueType> const& values, std::vector<ValueType> const& b) {
@@ -1160,6 +1311,7 @@ void IterativeMinMaxLinearEquationSolver<ValueType>::clearCache() const {
     auxiliaryRowGroupVector2.reset();
     soundValueIterationHelper.reset();
     optimisticValueIterationHelper.reset();
+    singlePrecisionValueIterationHelper.reset();
     StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
 }
 
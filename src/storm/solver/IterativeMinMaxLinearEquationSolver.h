@@ -7,6 +7,7 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/SinglePrecisionValueIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
@@ -53,6 +54,10 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     bool solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     bool solveEquationsSoundValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     bool solveEquationsViToPi(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    bool solveEquationsMixedPrecision(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    std::vector<storm::storage::sparse::state_type> computePolicyWithReducedPrecision(Environment const& env, OptimizationDirection dir,
+                                                                                      std::vector<ValueType> const& x, std::vector<ValueType> const& b,
+                                                                                      std::vector<double>& impreciseX) const;
 
     bool solveEquationsRationalSearch(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
@@ -108,6 +113,7 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector2;  // A.rowGroupCount() entries
     mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
     mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+    mutable std::unique_ptr<storm::solver::helper::SinglePrecisionValueIterationHelper<ValueType>> singlePrecisionValueIterationHelper;
 };
 
 }  // namespace solver
@@ -221,7 +221,7 @@ std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> GeneralMinMaxLinearEquati
     auto method = env.solver().minMax().getMethod();
     if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
         method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-        method == MinMaxMethod::ViToPi) {
+        method == MinMaxMethod::ViToPi || method == MinMaxMethod::MixedPrecision) {
         result = std::make_unique<IterativeMinMaxLinearEquationSolver<ValueType>>(std::make_unique<GeneralLinearEquationSolverFactory<ValueType>>());
     } else if (method == MinMaxMethod::Topological) {
         result = std::make_unique<TopologicalMinMaxLinearEquationSolver<ValueType>>();
@@ -245,7 +245,7 @@ std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> GeneralMinMax
     auto method = env.solver().minMax().getMethod();
     if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
         method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-        method == MinMaxMethod::ViToPi) {
+        method == MinMaxMethod::ViToPi || method == MinMaxMethod::MixedPrecision) {
         result = std::make_unique<IterativeMinMaxLinearEquationSolver<storm::RationalNumber>>(
             std::make_unique<GeneralLinearEquationSolverFactory<storm::RationalNumber>>());
     } else if (method == MinMaxMethod::LinearProgramming) {
@@ -26,6 +26,8 @@ std::string toString(MinMaxMethod m) {
             return "vi-to-pi";
         case MinMaxMethod::Acyclic:
             return "vi-to-pi";
+        case MinMaxMethod::MixedPrecision:
+            return "mixed-precision";
     }
     return "invalid";
 }
@@ -74,6 +76,16 @@ std::string toString(MaBoundedReachabilityMethod m) {
     return "invalid";
 }
 
+std::string toString(CtmcTransientMethod m) {
+    switch (m) {
+        case CtmcTransientMethod::Uniformization:
+            return "uniformization";
+        case CtmcTransientMethod::Krylov:
+            return "krylov";
+    }
+    return "invalid";
+}
+
 std::string toString(LpSolverType t) {
     switch (t) {
         case LpSolverType::Gurobi:
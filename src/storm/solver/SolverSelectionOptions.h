@@ -6,10 +6,11 @@
 namespace storm {
 namespace solver {
 ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, LinearProgramming, Topological, RationalSearch, IntervalIteration,
-                              SoundValueIteration, OptimisticValueIteration, TopologicalCuda, ViToPi, Acyclic)
+                              SoundValueIteration, OptimisticValueIteration, TopologicalCuda, ViToPi, Acyclic, MixedPrecision)
     ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx) ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
         ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
             ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
+                ExtendEnumsWithSelectionField(CtmcTransientMethod, Uniformization, Krylov)
 
                 ExtendEnumsWithSelectionField(LpSolverType, Gurobi, Glpk, Z3, Soplex)
                     ExtendEnumsWithSelectionField(EquationSolverType, Native, Gmmxx, Eigen, Elimination, Topological, Acyclic)
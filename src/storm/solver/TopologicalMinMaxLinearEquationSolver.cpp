@@ -1,5 +1,13 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
@@ -16,6 +24,45 @@
 namespace storm {
 namespace solver {
 
+namespace detail {
+/*!
+ * A reusable barrier that blocks the given number of threads until all of them have called wait().
+ */
+class ThreadBarrier {
+   public:
+    explicit ThreadBarrier(uint64_t numberOfThreads) : numberOfThreads(numberOfThreads), waitingThreads(0), generation(0) {
+        // Intentionally left empty.
+    }
+
+    void wait() {
+        if (numberOfThreads == 1) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        uint64_t currentGeneration = generation;
+        if (++waitingThreads == numberOfThreads) {
+            waitingThreads = 0;
+            ++generation;
+            condition.notify_all();
+        } else {
+            condition.wait(lock, [&]() { return generation != currentGeneration; });
+        }
+    }
+
+   private:
+    uint64_t const numberOfThreads;
+    uint64_t waitingThreads;
+    uint64_t generation;
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+}  // namespace detail
+
+// SCCs with fewer states are solved by the underlying solver even if colored Gauss-Seidel is enabled.
+static const uint64_t minimalColoredGaussSeidelSccSize = 1000;
+// The minimal number of states per thread for colored Gauss-Seidel.
+static const uint64_t minimalColoredGaussSeidelStatesPerThread = 500;
+
 template<typename ValueType>
 TopologicalMinMaxLinearEquationSolver<ValueType>::TopologicalMinMaxLinearEquationSolver() {
     // Intentionally left empty.
@@ -60,7 +107,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
     if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, env.solver().topological().getNumberOfThreads());
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -90,40 +137,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
                 this->schedulerChoices = std::vector<uint64_t>(x.size());
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
-                    } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
-                    }
-                }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
-            }
+        uint64_t numberOfThreads = std::min<uint64_t>(env.solver().topological().getNumberOfThreads(), this->sortedSccDecomposition->size());
+        if (numberOfThreads > 1) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, dir, x, b, numberOfThreads);
+        } else {
+            returnValue = solveSccsSequentially(sccSolverEnvironment, dir, x, b);
         }
 
         // If requested, we store the scheduler for retrieval.
@@ -144,15 +162,236 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
 }
 
 template<typename ValueType>
-void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
     // Obtain the scc decomposition
-    this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+    auto options = storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize);
+    this->sortedSccDecomposition =
+        std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, options.threads(numberOfThreads));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
 }
 
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsSequentially(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                             std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    if (!this->sccSolver) {
+        this->sccSolver = createSccSolver(sccSolverEnvironment);
+    }
+    bool returnValue = true;
+    storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+    storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+    uint64_t sccIndex = 0;
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+    for (auto const& scc : *this->sortedSccDecomposition) {
+        returnValue = solveAnyScc(sccSolverEnvironment, dir, scc, *this->sccSolver, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, 1) && returnValue;
+        ++sccIndex;
+        progress.updateProgress(sccIndex);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                             std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                                             uint64_t numberOfThreads) const {
+    auto const& sccs = *this->sortedSccDecomposition;
+    uint64_t const numberOfSccs = sccs.size();
+    uint64_t const noScc = std::numeric_limits<uint64_t>::max();
+    storm::utility::Stopwatch schedulingSw(true);
+
+    std::vector<uint64_t> stateToScc(x.size());
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        for (auto const& state : sccs.getBlock(sccIndex)) {
+            stateToScc[state] = sccIndex;
+        }
+    }
+
+    // Build the condensation DAG. For each SCC, we count the SCCs it depends on and store the SCCs that depend on it.
+    std::vector<std::atomic<uint64_t>> remainingDependencies(numberOfSccs);
+    std::vector<uint64_t> dependentsIndications(numberOfSccs + 1, 0);
+    std::vector<std::pair<uint64_t, uint64_t>> dependencies;
+    std::vector<uint64_t> lastDependent(numberOfSccs, noScc);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        uint64_t numberOfDependencies = 0;
+        for (auto const& state : sccs.getBlock(sccIndex)) {
+            for (auto const& entry : this->A->getRowGroup(state)) {
+                uint64_t successorScc = stateToScc[entry.getColumn()];
+                if (successorScc != sccIndex && lastDependent[successorScc] != sccIndex) {
+                    STORM_LOG_ASSERT(successorScc < sccIndex, "SCCs are not sorted topologically.");
+                    lastDependent[successorScc] = sccIndex;
+                    dependencies.emplace_back(successorScc, sccIndex);
+                    ++dependentsIndications[successorScc + 1];
+                    ++numberOfDependencies;
+                }
+            }
+        }
+        remainingDependencies[sccIndex].store(numberOfDependencies, std::memory_order_relaxed);
+    }
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        dependentsIndications[sccIndex + 1] += dependentsIndications[sccIndex];
+    }
+    std::vector<uint64_t> dependents(dependencies.size());
+    {
+        std::vector<uint64_t> nextPosition(dependentsIndications.begin(), dependentsIndications.end() - 1);
+        for (auto const& dependency : dependencies) {
+            dependents[nextPosition[dependency.first]++] = dependency.second;
+        }
+    }
+    dependencies.clear();
+    dependencies.shrink_to_fit();
+
+    // Initially, the SCCs without dependencies are ready. We pop them from the back, so we insert them in reversed order.
+    std::vector<uint64_t> readySccs;
+    for (uint64_t sccIndex = numberOfSccs; sccIndex > 0; --sccIndex) {
+        if (remainingDependencies[sccIndex - 1].load(std::memory_order_relaxed) == 0) {
+            readySccs.push_back(sccIndex - 1);
+        }
+    }
+    schedulingSw.stop();
+    STORM_LOG_INFO("Solving " << numberOfSccs << " SCCs using " << numberOfThreads << " threads. Initially, " << readySccs.size()
+                              << " SCCs are independent. Creating the SCC dependency graph took " << schedulingSw << ".");
+
+    // Every thread works with its own copy of the environment (as sub-environments are created lazily) and its own solver.
+    std::vector<storm::Environment> workerEnvironments(numberOfThreads, sccSolverEnvironment);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> workerSolvers;
+    for (auto const& workerEnvironment : workerEnvironments) {
+        workerSolvers.push_back(createSccSolver(workerEnvironment));
+    }
+
+    std::mutex readySccsMutex;
+    std::condition_variable readySccsCondition;
+    std::atomic<uint64_t> solvedSccs(0);
+    std::atomic<uint64_t> busyWorkers(0);
+    std::atomic<bool> abort(false);
+    std::vector<char> workerResults(numberOfThreads, true);
+    std::vector<std::exception_ptr> exceptions(numberOfThreads);
+
+    auto solveReadySccs = [&](uint64_t worker) {
+        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+        std::vector<uint64_t> newlyReadySccs;
+        uint64_t currentScc = noScc;
+        try {
+            while (true) {
+                if (currentScc == noScc) {
+                    std::unique_lock<std::mutex> lock(readySccsMutex);
+                    readySccsCondition.wait(lock, [&]() { return !readySccs.empty() || abort.load() || solvedSccs.load() == numberOfSccs; });
+                    if (readySccs.empty() || abort.load()) {
+                        break;
+                    }
+                    currentScc = readySccs.back();
+                    readySccs.pop_back();
+                }
+
+                // Large SCCs that are solved with colored Gauss-Seidel share the threads with the remaining busy workers.
+                uint64_t numberOfBusyWorkers = busyWorkers.fetch_add(1) + 1;
+                workerResults[worker] = solveAnyScc(workerEnvironments[worker], dir, sccs.getBlock(currentScc), *workerSolvers[worker],
+                                                    sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b,
+                                                    std::max<uint64_t>(1, numberOfThreads / numberOfBusyWorkers)) &&
+                                        workerResults[worker];
+                busyWorkers.fetch_sub(1);
+
+                // Release the dependent SCCs. The first SCC that becomes ready is solved by this worker right away.
+                uint64_t nextScc = noScc;
+                for (uint64_t index = dependentsIndications[currentScc]; index < dependentsIndications[currentScc + 1]; ++index) {
+                    uint64_t dependent = dependents[index];
+                    if (remainingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        if (nextScc == noScc) {
+                            nextScc = dependent;
+                        } else {
+                            newlyReadySccs.push_back(dependent);
+                        }
+                    }
+                }
+                bool allSolved = solvedSccs.fetch_add(1) + 1 == numberOfSccs;
+                if (storm::utility::resources::isTerminate()) {
+                    abort.store(true);
+                }
+                if (!newlyReadySccs.empty() || allSolved || abort.load()) {
+                    {
+                        std::lock_guard<std::mutex> lock(readySccsMutex);
+                        readySccs.insert(readySccs.end(), newlyReadySccs.rbegin(), newlyReadySccs.rend());
+                    }
+                    readySccsCondition.notify_all();
+                    newlyReadySccs.clear();
+                }
+                if (abort.load()) {
+                    break;
+                }
+                currentScc = nextScc;
+            }
+        } catch (...) {
+            exceptions[worker] = std::current_exception();
+            {
+                std::lock_guard<std::mutex> lock(readySccsMutex);
+                abort.store(true);
+            }
+            readySccsCondition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1);
+    for (uint64_t worker = 1; worker < numberOfThreads; ++worker) {
+        threads.emplace_back(solveReadySccs, worker);
+    }
+    solveReadySccs(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+    STORM_LOG_WARN_COND(solvedSccs.load() == numberOfSccs,
+                        "Topological solver aborted after analyzing " << solvedSccs.load() << "/" << numberOfSccs << " SCCs.");
+    return std::all_of(workerResults.begin(), workerResults.end(), [](char result) { return result; });
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveAnyScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                   storm::storage::StronglyConnectedComponent const& scc,
+                                                                   storm::solver::MinMaxLinearEquationSolver<ValueType>& sccSolver,
+                                                                   storm::storage::BitVector& sccRowGroupsAsBitVector,
+                                                                   storm::storage::BitVector& sccRowsAsBitVector, std::vector<ValueType>& globalX,
+                                                                   std::vector<ValueType> const& globalB, uint64_t numberOfThreads) const {
+    if (scc.size() == 1) {
+        return solveTrivialScc(*scc.begin(), dir, globalX, globalB);
+    }
+
+    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+    if (isColoredGaussSeidelApplicable(sccSolverEnvironment, scc.size())) {
+        std::vector<uint64_t> sccStates(scc.begin(), scc.end());
+        return solveSccWithColoredGaussSeidel(sccSolverEnvironment, dir, sccStates, globalX, globalB, numberOfThreads);
+    }
+
+    sccRowGroupsAsBitVector.clear();
+    sccRowsAsBitVector.clear();
+    for (auto const& group : scc) {  // Group refers to state
+        sccRowGroupsAsBitVector.set(group, true);
+
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRowsAsBitVector.set(row, true);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRowsAsBitVector.set(row, true);
+            STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+        }
+    }
+    return solveScc(sccSolverEnvironment, dir, sccSolver, sccRowGroupsAsBitVector, sccRowsAsBitVector, globalX, globalB);
+}
+
 template<typename ValueType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveTrivialScc(uint64_t const& sccState, OptimizationDirection dir, std::vector<ValueType>& globalX,
                                                                        std::vector<ValueType> const& globalB) const {
@@ -244,9 +483,16 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveFullyConnectedEquati
                                                                                          std::vector<ValueType> const& b) const {
     STORM_LOG_ASSERT(!this->choiceFixedForRowGroup || this->choiceFixedForRowGroup.get().empty(),
                      "Expecting no fixed choices for states when solving the fully connected equation system");
+    if (isColoredGaussSeidelApplicable(sccSolverEnvironment, x.size())) {
+        std::vector<uint64_t> states(x.size());
+        std::iota(states.begin(), states.end(), 0);
+        if (this->isTrackSchedulerSet()) {
+            this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+        }
+        return solveSccWithColoredGaussSeidel(sccSolverEnvironment, dir, states, x, b, sccSolverEnvironment.solver().topological().getNumberOfThreads());
+    }
     if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+        this->sccSolver = createSccSolver(sccSolverEnvironment);
     }
     this->sccSolver->setMatrix(*this->A);
     this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
@@ -281,18 +527,219 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveFullyConnectedEquati
     return res;
 }
 
+template<typename ValueType>
+std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> TopologicalMinMaxLinearEquationSolver<ValueType>::createSccSolver(
+    storm::Environment const& sccSolverEnvironment) const {
+    auto result = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+    result->setCachingEnabled(true);
+    return result;
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::isColoredGaussSeidelApplicable(storm::Environment const& sccSolverEnvironment, uint64_t sccSize) const {
+    // Colored Gauss-Seidel performs standard value iteration, which is only correct if the solution is unique and we start from the given vector.
+    return sccSolverEnvironment.solver().topological().isColoredGaussSeidelSet() && sccSize >= minimalColoredGaussSeidelSccSize &&
+           !storm::NumberTraits<ValueType>::IsExact && !sccSolverEnvironment.solver().isForceSoundness() &&
+           sccSolverEnvironment.solver().minMax().getMethod() == MinMaxMethod::ValueIteration && this->hasUniqueSolution() && !this->hasInitialScheduler();
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccWithColoredGaussSeidel(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                                      std::vector<uint64_t> const& sccStates, std::vector<ValueType>& globalX,
+                                                                                      std::vector<ValueType> const& globalB, uint64_t numberOfThreads) const {
+    STORM_LOG_ASSERT(std::is_sorted(sccStates.begin(), sccStates.end()), "Expected the states of the SCC to be sorted.");
+    uint64_t const numberOfStates = sccStates.size();
+    auto const& rowGroupIndices = this->A->getRowGroupIndices();
+
+    // The rows that are considered for a state are all rows of its row group unless the choice of the state is fixed.
+    auto getRows = [&](uint64_t state) {
+        if (this->choiceFixedForRowGroup && this->choiceFixedForRowGroup.get()[state]) {
+            uint64_t row = rowGroupIndices[state] + this->getInitialScheduler()[state];
+            return std::make_pair(row, row + 1);
+        }
+        return std::make_pair(rowGroupIndices[state], rowGroupIndices[state + 1]);
+    };
+    auto getLocalIndex = [&](uint64_t state) -> uint64_t {
+        auto it = std::lower_bound(sccStates.begin(), sccStates.end(), state);
+        return (it != sccStates.end() && *it == state) ? static_cast<uint64_t>(it - sccStates.begin()) : numberOfStates;
+    };
+
+    // Greedily color the states such that no state depends on a (different) state of the same color.
+    storm::utility::Stopwatch coloringSw(true);
+    std::vector<std::vector<uint64_t>> neighbors(numberOfStates);
+    for (uint64_t localState = 0; localState < numberOfStates; ++localState) {
+        auto rows = getRows(sccStates[localState]);
+        STORM_LOG_THROW(rows.first < rows.second, storm::exceptions::UnexpectedException, "Empty row group in MinMax equation system.");
+        for (uint64_t row = rows.first; row < rows.second; ++row) {
+            for (auto const& entry : this->A->getRow(row)) {
+                uint64_t localSuccessor = getLocalIndex(entry.getColumn());
+                if (localSuccessor != numberOfStates && localSuccessor != localState) {
+                    neighbors[localState].push_back(localSuccessor);
+                    neighbors[localSuccessor].push_back(localState);
+                }
+            }
+        }
+    }
+    std::vector<uint64_t> stateColors(numberOfStates);
+    std::vector<uint64_t> colorUsedBy;
+    uint64_t numberOfColors = 0;
+    for (uint64_t localState = 0; localState < numberOfStates; ++localState) {
+        for (auto const& neighbor : neighbors[localState]) {
+            if (neighbor < localState) {
+                colorUsedBy[stateColors[neighbor]] = localState;
+            }
+        }
+        uint64_t color = 0;
+        while (color < numberOfColors && colorUsedBy[color] == localState) {
+            ++color;
+        }
+        if (color == numberOfColors) {
+            ++numberOfColors;
+            colorUsedBy.push_back(numberOfStates);
+        }
+        stateColors[localState] = color;
+    }
+    neighbors.clear();
+    neighbors.shrink_to_fit();
+
+    // Group the states by their color.
+    std::vector<uint64_t> colorIndications(numberOfColors + 1, 0);
+    for (auto const& color : stateColors) {
+        ++colorIndications[color + 1];
+    }
+    for (uint64_t color = 0; color < numberOfColors; ++color) {
+        colorIndications[color + 1] += colorIndications[color];
+    }
+    std::vector<uint64_t> coloredStates(numberOfStates);
+    {
+        std::vector<uint64_t> nextPosition(colorIndications.begin(), colorIndications.end() - 1);
+        for (uint64_t localState = 0; localState < numberOfStates; ++localState) {
+            coloredStates[nextPosition[stateColors[localState]]++] = sccStates[localState];
+        }
+    }
+    coloringSw.stop();
+    STORM_LOG_INFO("Colored SCC with " << numberOfStates << " states using " << numberOfColors << " colors in " << coloringSw << ".");
+
+    ValueType const precision = storm::utility::convertNumber<ValueType>(sccSolverEnvironment.solver().minMax().getPrecision());
+    bool const relative = sccSolverEnvironment.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t const maximalNumberOfIterations = sccSolverEnvironment.solver().minMax().getMaximalNumberOfIterations();
+    bool const minimizing = minimize(dir);
+
+    // Updates the states in the given range (of coloredStates) and returns true iff none of the values changed by more than the precision.
+    auto updateStates = [&](uint64_t first, uint64_t end) {
+        bool converged = true;
+        for (uint64_t index = first; index < end; ++index) {
+            uint64_t state = coloredStates[index];
+            auto rows = getRows(state);
+            ValueType bestValue;
+            for (uint64_t row = rows.first; row < rows.second; ++row) {
+                ValueType rowValue = globalB[row];
+                for (auto const& entry : this->A->getRow(row)) {
+                    rowValue += entry.getValue() * globalX[entry.getColumn()];
+                }
+                if (row == rows.first || (minimizing ? rowValue < bestValue : rowValue > bestValue)) {
+                    bestValue = std::move(rowValue);
+                }
+            }
+            if (converged && !storm::utility::vector::equalModuloPrecision(globalX[state], bestValue, precision, relative)) {
+                converged = false;
+            }
+            globalX[state] = std::move(bestValue);
+        }
+        return converged;
+    };
+
+    // Since the states of a color do not depend on each other, the threads update disjoint chunks of each color. After each color and each
+    // iteration, the threads synchronize. The convergence flags are double buffered so that they are not overwritten while they are being read.
+    numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, numberOfStates / minimalColoredGaussSeidelStatesPerThread));
+    detail::ThreadBarrier barrier(numberOfThreads);
+    std::vector<char> convergedFlags(2 * numberOfThreads);
+    std::vector<char> terminateFlags(2);
+    uint64_t numberOfIterations = 0;
+    bool converged = false;
+    auto iterate = [&](uint64_t thread) {
+        for (uint64_t iteration = 0; iteration < maximalNumberOfIterations; ++iteration) {
+            uint64_t const slot = iteration % 2;
+            bool threadConverged = true;
+            for (uint64_t color = 0; color < numberOfColors; ++color) {
+                uint64_t const colorSize = colorIndications[color + 1] - colorIndications[color];
+                uint64_t const first = colorIndications[color] + colorSize * thread / numberOfThreads;
+                uint64_t const end = colorIndications[color] + colorSize * (thread + 1) / numberOfThreads;
+                threadConverged = updateStates(first, end) && threadConverged;
+                barrier.wait();
+            }
+            convergedFlags[slot * numberOfThreads + thread] = threadConverged;
+            if (thread == 0) {
+                terminateFlags[slot] = storm::utility::resources::isTerminate();
+            }
+            barrier.wait();
+
+            // All threads take the same decision based on the flags of this iteration.
+            bool iterationConverged = std::all_of(convergedFlags.begin() + slot * numberOfThreads, convergedFlags.begin() + (slot + 1) * numberOfThreads,
+                                                  [](char flag) { return flag; });
+            if (iterationConverged || terminateFlags[slot]) {
+                if (thread == 0) {
+                    numberOfIterations = iteration + 1;
+                    converged = iterationConverged;
+                }
+                return;
+            }
+        }
+        if (thread == 0) {
+            numberOfIterations = maximalNumberOfIterations;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1);
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(iterate, thread);
+    }
+    iterate(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (converged) {
+        STORM_LOG_INFO("Colored Gauss-Seidel value iteration converged after " << numberOfIterations << " iterations using " << numberOfThreads
+                                                                              << " threads.");
+    } else {
+        STORM_LOG_WARN("Colored Gauss-Seidel value iteration did not converge within " << numberOfIterations << " iterations.");
+    }
+
+    // If requested, extract the choices of the SCC states that are optimal with respect to the computed values. As in multiplyAndReduce,
+    // ties are resolved in favor of the first row.
+    if (this->isTrackSchedulerSet()) {
+        for (auto const& state : sccStates) {
+            auto rows = getRows(state);
+            uint64_t bestRow = rows.first;
+            ValueType bestValue;
+            for (uint64_t row = rows.first; row < rows.second; ++row) {
+                ValueType rowValue = globalB[row];
+                for (auto const& entry : this->A->getRow(row)) {
+                    rowValue += entry.getValue() * globalX[entry.getColumn()];
+                }
+                if (row == rows.first || (minimizing ? rowValue < bestValue : rowValue > bestValue)) {
+                    bestValue = std::move(rowValue);
+                    bestRow = row;
+                }
+            }
+            this->schedulerChoices.get()[state] = bestRow - rowGroupIndices[state];
+        }
+    }
+
+    return converged;
+}
+
 template<typename ValueType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                storm::solver::MinMaxLinearEquationSolver<ValueType>& sccSolver,
                                                                 storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows,
                                                                 std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
-    }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    sccSolver.setHasUniqueSolution(this->hasUniqueSolution());
+    sccSolver.setHasNoEndComponents(this->hasNoEndComponents());
+    sccSolver.setTrackScheduler(this->isTrackSchedulerSet());
 
     storm::storage::SparseMatrix<ValueType> sccA;
     if (this->choiceFixedForRowGroup) {
@@ -306,7 +753,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver.setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -315,11 +762,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver.setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver.setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -339,18 +786,18 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver.setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        sccSolver.setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver.setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        sccSolver.setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
     }
 
     // Requirements
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+    auto req = sccSolver.getRequirements(sccSolverEnvironment, dir);
     if (req.upperBounds() && this->hasUpperBound()) {
         req.clearUpperBounds();
     }
@@ -365,14 +812,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    sccSolver.setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = sccSolver.solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver.getSchedulerChoices());
     }
 
     // Set solution
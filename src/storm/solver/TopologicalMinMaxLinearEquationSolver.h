@@ -33,8 +33,8 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
    private:
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
-    // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    // Creates an SCC decomposition (using the given number of threads) and sorts the SCCs according to a topological sort.
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -43,8 +43,35 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
                                            std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
-                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::solver::MinMaxLinearEquationSolver<ValueType>& sccSolver,
+                  storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX,
+                  std::vector<ValueType> const& globalB) const;
+
+    // Solves the given SCC (of any size) using the given solver and auxiliary bit vectors (for non-trivial SCCs).
+    bool solveAnyScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::StronglyConnectedComponent const& scc,
+                     storm::solver::MinMaxLinearEquationSolver<ValueType>& sccSolver, storm::storage::BitVector& sccRowGroupsAsBitVector,
+                     storm::storage::BitVector& sccRowsAsBitVector, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                     uint64_t numberOfThreads) const;
+
+    // Solves the SCCs one after another in topological order.
+    bool solveSccsSequentially(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b) const;
+
+    // Solves the SCCs concurrently using the given number of threads. An SCC is solved as soon as all SCCs it depends on are solved.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b, uint64_t numberOfThreads) const;
+
+    // Creates a solver for the (non-trivial) SCCs.
+    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> createSccSolver(storm::Environment const& sccSolverEnvironment) const;
+
+    // Returns true if the given SCC is to be solved with multi-colored Gauss-Seidel value iteration.
+    bool isColoredGaussSeidelApplicable(storm::Environment const& sccSolverEnvironment, uint64_t sccSize) const;
+
+    // Solves the given SCC with multi-colored Gauss-Seidel value iteration using the given number of threads. The states of the SCC are colored such
+    // that states of the same color do not depend on each other, so the states of each color can be updated in-place concurrently. If the scheduler
+    // is tracked, the optimal choices of the SCC states are stored as well.
+    bool solveSccWithColoredGaussSeidel(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<uint64_t> const& sccStates,
+                                        std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, uint64_t numberOfThreads) const;
 
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
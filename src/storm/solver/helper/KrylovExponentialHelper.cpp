@@ -0,0 +1,318 @@
+#include "storm/solver/helper/KrylovExponentialHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/PrecisionExceededException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace detail {
+
+// Dense square matrices of the (small) Krylov dimension are stored row by row.
+template<typename ValueType>
+std::vector<ValueType> multiplyDense(std::vector<ValueType> const& lhs, std::vector<ValueType> const& rhs, uint64_t size) {
+    std::vector<ValueType> result(size * size, 0);
+    for (uint64_t row = 0; row < size; ++row) {
+        for (uint64_t k = 0; k < size; ++k) {
+            ValueType const& factor = lhs[row * size + k];
+            if (factor != 0) {
+                for (uint64_t column = 0; column < size; ++column) {
+                    result[row * size + column] += factor * rhs[k * size + column];
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/*!
+ * Solves lhs * X = rhs (in place of rhs) using Gaussian elimination with partial pivoting.
+ */
+template<typename ValueType>
+void solveDense(std::vector<ValueType> lhs, std::vector<ValueType>& rhs, uint64_t size) {
+    for (uint64_t column = 0; column < size; ++column) {
+        uint64_t pivotRow = column;
+        for (uint64_t row = column + 1; row < size; ++row) {
+            if (std::abs(lhs[row * size + column]) > std::abs(lhs[pivotRow * size + column])) {
+                pivotRow = row;
+            }
+        }
+        if (pivotRow != column) {
+            for (uint64_t k = 0; k < size; ++k) {
+                std::swap(lhs[pivotRow * size + k], lhs[column * size + k]);
+                std::swap(rhs[pivotRow * size + k], rhs[column * size + k]);
+            }
+        }
+        ValueType const& pivot = lhs[column * size + column];
+        for (uint64_t row = column + 1; row < size; ++row) {
+            ValueType factor = lhs[row * size + column] / pivot;
+            if (factor != 0) {
+                for (uint64_t k = column; k < size; ++k) {
+                    lhs[row * size + k] -= factor * lhs[column * size + k];
+                }
+                for (uint64_t k = 0; k < size; ++k) {
+                    rhs[row * size + k] -= factor * rhs[column * size + k];
+                }
+            }
+        }
+    }
+    for (uint64_t column = size; column > 0; --column) {
+        uint64_t row = column - 1;
+        for (uint64_t k = 0; k < size; ++k) {
+            ValueType value = rhs[row * size + k];
+            for (uint64_t j = row + 1; j < size; ++j) {
+                value -= lhs[row * size + j] * rhs[j * size + k];
+            }
+            rhs[row * size + k] = value / lhs[row * size + row];
+        }
+    }
+}
+
+/*!
+ * Computes the exponential of the given dense matrix using the irreducible (6,6) Pade approximation combined with scaling and squaring.
+ */
+template<typename ValueType>
+std::vector<ValueType> exponentialDense(std::vector<ValueType> matrix, uint64_t size) {
+    uint64_t const degree = 6;
+    std::vector<ValueType> coefficients(degree + 1);
+    coefficients[0] = 1;
+    for (uint64_t k = 1; k <= degree; ++k) {
+        coefficients[k] = coefficients[k - 1] * static_cast<ValueType>(degree + 1 - k) / static_cast<ValueType>(k * (2 * degree + 1 - k));
+    }
+
+    // Scale the matrix such that its norm is at most 1/2.
+    ValueType infinityNorm = 0;
+    for (uint64_t row = 0; row < size; ++row) {
+        ValueType rowSum = 0;
+        for (uint64_t column = 0; column < size; ++column) {
+            rowSum += std::abs(matrix[row * size + column]);
+        }
+        infinityNorm = std::max(infinityNorm, rowSum);
+    }
+    int64_t squarings = 0;
+    if (infinityNorm > 0.5) {
+        squarings = std::max<int64_t>(0, static_cast<int64_t>(std::log2(infinityNorm)) + 2);
+        ValueType scaling = std::ldexp(static_cast<ValueType>(1), -static_cast<int>(squarings));
+        for (auto& entry : matrix) {
+            entry *= scaling;
+        }
+    }
+
+    // Horner evaluation of numerator and denominator.
+    auto addToDiagonal = [size](std::vector<ValueType>& m, ValueType const& value) {
+        for (uint64_t i = 0; i < size; ++i) {
+            m[i * size + i] += value;
+        }
+    };
+    std::vector<ValueType> squaredMatrix = multiplyDense(matrix, matrix, size);
+    std::vector<ValueType> numerator(size * size, 0), denominator(size * size, 0);
+    addToDiagonal(denominator, coefficients[degree]);
+    addToDiagonal(numerator, coefficients[degree - 1]);
+    bool odd = true;
+    for (uint64_t k = degree - 1; k > 0; --k) {
+        std::vector<ValueType>& target = odd ? denominator : numerator;
+        target = multiplyDense(target, squaredMatrix, size);
+        addToDiagonal(target, coefficients[k - 1]);
+        odd = !odd;
+    }
+    if (odd) {
+        denominator = multiplyDense(denominator, matrix, size);
+    } else {
+        numerator = multiplyDense(numerator, matrix, size);
+    }
+    for (uint64_t i = 0; i < size * size; ++i) {
+        denominator[i] -= numerator[i];
+    }
+    solveDense(denominator, numerator, size);
+    std::vector<ValueType> result(size * size);
+    for (uint64_t i = 0; i < size * size; ++i) {
+        result[i] = odd ? -2 * numerator[i] : 2 * numerator[i];
+    }
+    addToDiagonal(result, odd ? -1 : 1);
+
+    for (int64_t squaring = 0; squaring < squarings; ++squaring) {
+        result = multiplyDense(result, result, size);
+    }
+    return result;
+}
+
+template<typename ValueType>
+ValueType euclideanNorm(std::vector<ValueType> const& vector) {
+    ValueType result = 0;
+    for (auto const& entry : vector) {
+        result += entry * entry;
+    }
+    return std::sqrt(result);
+}
+
+/*!
+ * Rounds the given step size to two significant digits (as done in expokit).
+ */
+template<typename ValueType>
+ValueType roundStepSize(ValueType const& stepSize) {
+    ValueType magnitude = std::pow(static_cast<ValueType>(10), std::floor(std::log10(stepSize)) - 1);
+    return std::ceil(stepSize / magnitude) * magnitude;
+}
+
+}  // namespace detail
+
+template<typename ValueType>
+KrylovExponentialHelper<ValueType>::KrylovExponentialHelper(MultiplicationFunction const& multiply, ValueType const& norm, uint64_t krylovDimension)
+    : multiply(multiply), norm(norm), krylovDimension(krylovDimension), numberOfSteps(0), errorEstimate(0) {
+    STORM_LOG_THROW(krylovDimension >= 2, storm::exceptions::InvalidArgumentException, "The Krylov dimension has to be at least two.");
+}
+
+template<typename ValueType>
+std::vector<ValueType> KrylovExponentialHelper<ValueType>::computeExponentialTimesVector(ValueType const& time, std::vector<ValueType> const& vector,
+                                                                                         ValueType const& tolerance) const {
+    STORM_LOG_THROW(time >= 0, storm::exceptions::InvalidArgumentException, "Negative time " << time << " is not supported.");
+    STORM_LOG_THROW(tolerance > 0, storm::exceptions::InvalidArgumentException, "The tolerance has to be positive.");
+    numberOfSteps = 0;
+    errorEstimate = 0;
+
+    uint64_t const n = vector.size();
+    ValueType beta = detail::euclideanNorm(vector);
+    if (time == 0 || beta == 0 || norm == 0) {
+        return vector;
+    }
+
+    // Parameters of the step size control.
+    ValueType const breakdownTolerance = 1e-7;
+    ValueType const gamma = 0.9;
+    ValueType const delta = 1.2;
+    uint64_t const maximalNumberOfRejections = 10;
+    ValueType const roundOff = norm * std::numeric_limits<ValueType>::epsilon();
+
+    uint64_t const m = std::max<uint64_t>(std::min<uint64_t>(krylovDimension, n), 1);
+    ValueType exponent = static_cast<ValueType>(1) / static_cast<ValueType>(m);
+    ValueType const pi = std::acos(static_cast<ValueType>(-1));
+    ValueType const fact = std::pow((static_cast<ValueType>(m) + 1) / std::exp(static_cast<ValueType>(1)), m + 1) * std::sqrt(2 * pi * (m + 1));
+    ValueType nextStepSize = detail::roundStepSize((1 / norm) * std::pow((fact * tolerance) / (4 * beta * norm), exponent));
+
+    std::vector<ValueType> w = vector;
+    std::vector<std::vector<ValueType>> basis(m + 1, std::vector<ValueType>(n));
+    std::vector<ValueType> p(n);
+    ValueType currentTime = 0;
+    while (currentTime < time) {
+        ++numberOfSteps;
+        ValueType stepSize = std::min(time - currentTime, nextStepSize);
+
+        // Arnoldi process to obtain an orthonormal basis of the Krylov subspace and the (augmented) Hessenberg matrix.
+        uint64_t const hessenbergSize = m + 2;
+        std::vector<ValueType> hessenberg(hessenbergSize * hessenbergSize, 0);
+        uint64_t subspaceDimension = m;
+        bool happyBreakdown = false;
+        for (uint64_t i = 0; i < n; ++i) {
+            basis[0][i] = w[i] / beta;
+        }
+        for (uint64_t j = 0; j < m; ++j) {
+            multiply(basis[j], p);
+            for (uint64_t i = 0; i <= j; ++i) {
+                ValueType product = 0;
+                for (uint64_t k = 0; k < n; ++k) {
+                    product += basis[i][k] * p[k];
+                }
+                hessenberg[i * hessenbergSize + j] = product;
+                for (uint64_t k = 0; k < n; ++k) {
+                    p[k] -= product * basis[i][k];
+                }
+            }
+            ValueType pNorm = detail::euclideanNorm(p);
+            if (pNorm < breakdownTolerance) {
+                // The Krylov subspace is invariant under A, so the remaining time can be covered in a single step.
+                happyBreakdown = true;
+                subspaceDimension = j + 1;
+                stepSize = time - currentTime;
+                break;
+            }
+            hessenberg[(j + 1) * hessenbergSize + j] = pNorm;
+            for (uint64_t k = 0; k < n; ++k) {
+                basis[j + 1][k] = p[k] / pNorm;
+            }
+        }
+        ValueType nextBasisNorm = 0;
+        if (!happyBreakdown) {
+            hessenberg[(m + 1) * hessenbergSize + m] = 1;
+            multiply(basis[m], p);
+            nextBasisNorm = detail::euclideanNorm(p);
+        }
+
+        // Compute the exponential of the projected matrix and estimate the local error. Reduce the step size until the error is small enough.
+        uint64_t const exponentialSize = happyBreakdown ? subspaceDimension : m + 2;
+        std::vector<ValueType> exponential;
+        ValueType localError = 0;
+        for (uint64_t rejections = 0;; ++rejections) {
+            std::vector<ValueType> scaledHessenberg(exponentialSize * exponentialSize);
+            for (uint64_t row = 0; row < exponentialSize; ++row) {
+                for (uint64_t column = 0; column < exponentialSize; ++column) {
+                    scaledHessenberg[row * exponentialSize + column] = stepSize * hessenberg[row * hessenbergSize + column];
+                }
+            }
+            exponential = detail::exponentialDense(scaledHessenberg, exponentialSize);
+            if (happyBreakdown) {
+                localError = breakdownTolerance;
+                break;
+            }
+            ValueType phi1 = std::abs(beta * exponential[m * exponentialSize]);
+            ValueType phi2 = std::abs(beta * exponential[(m + 1) * exponentialSize] * nextBasisNorm);
+            if (phi1 > 10 * phi2) {
+                localError = phi2;
+                exponent = static_cast<ValueType>(1) / static_cast<ValueType>(m);
+            } else if (phi1 > phi2) {
+                localError = (phi1 * phi2) / (phi1 - phi2);
+                exponent = static_cast<ValueType>(1) / static_cast<ValueType>(m);
+            } else {
+                localError = phi1;
+                exponent = static_cast<ValueType>(1) / static_cast<ValueType>(std::max<uint64_t>(m - 1, 1));
+            }
+            if (localError <= delta * stepSize * tolerance) {
+                break;
+            }
+            STORM_LOG_THROW(rejections < maximalNumberOfRejections, storm::exceptions::PrecisionExceededException,
+                            "Unable to reach the requested tolerance " << tolerance << " in the Krylov subspace method.");
+            stepSize = detail::roundStepSize(gamma * stepSize * std::pow(stepSize * tolerance / localError, exponent));
+        }
+
+        // Assemble the new iterate from the basis vectors.
+        uint64_t const usedDimension = happyBreakdown ? subspaceDimension : m + 1;
+        std::fill(w.begin(), w.end(), static_cast<ValueType>(0));
+        for (uint64_t j = 0; j < usedDimension; ++j) {
+            ValueType factor = beta * exponential[j * exponentialSize];
+            for (uint64_t k = 0; k < n; ++k) {
+                w[k] += factor * basis[j][k];
+            }
+        }
+        beta = detail::euclideanNorm(w);
+        currentTime += stepSize;
+        localError = std::max(localError, roundOff);
+        nextStepSize = detail::roundStepSize(gamma * stepSize * std::pow(stepSize * tolerance / localError, exponent));
+        errorEstimate += localError;
+        if (beta == 0) {
+            break;
+        }
+    }
+    STORM_LOG_DEBUG("Computed Krylov approximation in " << numberOfSteps << " steps with estimated error " << errorEstimate << ".");
+    return w;
+}
+
+template<typename ValueType>
+uint64_t KrylovExponentialHelper<ValueType>::getNumberOfSteps() const {
+    return numberOfSteps;
+}
+
+template<typename ValueType>
+ValueType const& KrylovExponentialHelper<ValueType>::getErrorEstimate() const {
+    return errorEstimate;
+}
+
+template class KrylovExponentialHelper<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
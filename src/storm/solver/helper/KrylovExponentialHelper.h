@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * Computes the product exp(t*A)*v of a matrix exponential and a vector using Krylov subspace projections (following Sidje's expokit).
+ * The matrix A is only accessed through matrix-vector products. In each step, the exponential is applied to the projection of A onto a
+ * Krylov subspace of small dimension. The step sizes are adapted such that the local error estimates stay below the requested tolerance.
+ * In contrast to uniformization, the number of matrix-vector products does not grow linearly with the norm of t*A, which makes this
+ * approach favorable for stiff systems.
+ */
+template<typename ValueType>
+class KrylovExponentialHelper {
+   public:
+    typedef std::function<void(std::vector<ValueType> const&, std::vector<ValueType>&)> MultiplicationFunction;
+
+    /*!
+     * Creates a new helper for the given matrix.
+     *
+     * @param multiply A function that sets its second argument to A times its first argument.
+     * @param norm An upper bound on the infinity norm of A.
+     * @param krylovDimension The (maximal) dimension of the Krylov subspaces.
+     */
+    KrylovExponentialHelper(MultiplicationFunction const& multiply, ValueType const& norm, uint64_t krylovDimension = 30);
+
+    /*!
+     * Computes exp(time * A) * vector.
+     *
+     * @param time The (non-negative) time.
+     * @param vector The vector.
+     * @param tolerance The tolerance per time unit, i.e., the error of the result is approximately bounded by time * tolerance.
+     * @return The resulting vector.
+     */
+    std::vector<ValueType> computeExponentialTimesVector(ValueType const& time, std::vector<ValueType> const& vector, ValueType const& tolerance) const;
+
+    /*!
+     * Retrieves the number of steps performed in the last call to computeExponentialTimesVector.
+     */
+    uint64_t getNumberOfSteps() const;
+
+    /*!
+     * Retrieves the sum of the local error estimates of the last call to computeExponentialTimesVector.
+     */
+    ValueType const& getErrorEstimate() const;
+
+   private:
+    MultiplicationFunction multiply;
+    ValueType norm;
+    uint64_t krylovDimension;
+
+    mutable uint64_t numberOfSteps;
+    mutable ValueType errorEstimate;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,105 @@
+#include "storm/solver/helper/SinglePrecisionValueIterationHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+template<typename ValueType>
+bool SinglePrecisionValueIterationHelper<ValueType>::canHandle(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    return matrix.getEntryCount() < std::numeric_limits<IndexType>::max() && matrix.getRowCount() < std::numeric_limits<IndexType>::max();
+}
+
+template<typename ValueType>
+SinglePrecisionValueIterationHelper<ValueType>::SinglePrecisionValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    STORM_LOG_THROW(canHandle(matrix), storm::exceptions::NotSupportedException, "The matrix is too large for the selected index type.");
+    matrixValues.reserve(matrix.getEntryCount());
+    matrixColumns.reserve(matrix.getEntryCount());
+    rowIndications.reserve(matrix.getRowCount() + 1);
+    rowIndications.push_back(0);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            matrixValues.push_back(static_cast<float>(storm::utility::convertNumber<double>(entry.getValue())));
+            matrixColumns.push_back(static_cast<IndexType>(entry.getColumn()));
+        }
+        rowIndications.push_back(static_cast<IndexType>(matrixValues.size()));
+    }
+    rowGroupIndices.reserve(matrix.getRowGroupCount() + 1);
+    for (auto const& rowGroupIndex : matrix.getRowGroupIndices()) {
+        rowGroupIndices.push_back(static_cast<IndexType>(rowGroupIndex));
+    }
+}
+
+template<typename ValueType>
+std::vector<float> SinglePrecisionValueIterationHelper<ValueType>::toSinglePrecision(std::vector<ValueType> const& vector) {
+    std::vector<float> result;
+    result.reserve(vector.size());
+    for (auto const& value : vector) {
+        result.push_back(static_cast<float>(storm::utility::convertNumber<double>(value)));
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool SinglePrecisionValueIterationHelper<ValueType>::performValueIteration(OptimizationDirection dir, std::vector<float>& x, std::vector<float> const& b,
+                                                                           float precision, bool relative, uint64_t maximalNumberOfIterations,
+                                                                           uint64_t& iterations) const {
+    if (minimize(dir)) {
+        return performValueIteration<OptimizationDirection::Minimize>(x, b, precision, relative, maximalNumberOfIterations, iterations);
+    } else {
+        return performValueIteration<OptimizationDirection::Maximize>(x, b, precision, relative, maximalNumberOfIterations, iterations);
+    }
+}
+
+template<typename ValueType>
+template<OptimizationDirection dir>
+bool SinglePrecisionValueIterationHelper<ValueType>::performValueIteration(std::vector<float>& x, std::vector<float> const& b, float precision, bool relative,
+                                                                           uint64_t maximalNumberOfIterations, uint64_t& iterations) const {
+    // Rounding perturbs the values by a few units in the last place in every iteration, so the difference between two
+    // iterations may not fall below the requested precision for large values. Such differences are considered converged.
+    float const roundingTolerance = 32 * std::numeric_limits<float>::epsilon();
+    uint64_t const numberOfRowGroups = rowGroupIndices.size() - 1;
+    for (iterations = 0; iterations < maximalNumberOfIterations; ++iterations) {
+        bool converged = true;
+        for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+            float groupValue = 0.0f;
+            for (IndexType row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                float rowValue = b[row];
+                for (IndexType entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                    rowValue += matrixValues[entry] * x[matrixColumns[entry]];
+                }
+                if (row == rowGroupIndices[group] || (dir == OptimizationDirection::Minimize ? rowValue < groupValue : rowValue > groupValue)) {
+                    groupValue = rowValue;
+                }
+            }
+            if (converged) {
+                float difference = std::abs(groupValue - x[group]);
+                float const tolerance = relative ? precision * std::abs(groupValue) : precision;
+                converged = difference <= std::max(tolerance, roundingTolerance * std::abs(groupValue));
+            }
+            // Values are updated in place, i.e., later row groups already use the new values.
+            x[group] = groupValue;
+        }
+        if (converged) {
+            ++iterations;
+            return true;
+        }
+    }
+    return false;
+}
+
+template class SinglePrecisionValueIterationHelper<double>;
+template class SinglePrecisionValueIterationHelper<storm::RationalNumber>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
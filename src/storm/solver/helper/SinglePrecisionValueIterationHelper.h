@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}  // namespace storage
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Performs value iteration on a single precision copy of a (row grouped) matrix. Matrix values are stored as float
+ * and column indices as 32 bit integers, which halves the memory traffic of an iteration compared to the double
+ * precision representation. The result is only meant as a starting point for a more precise computation.
+ */
+template<typename ValueType>
+class SinglePrecisionValueIterationHelper {
+   public:
+    typedef uint32_t IndexType;
+
+    /*!
+     * Checks whether the indices of the given matrix fit into the index type of the helper.
+     */
+    static bool canHandle(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Creates a single precision copy of the given matrix. The matrix must satisfy canHandle.
+     */
+    SinglePrecisionValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Converts the given vector to single precision.
+     */
+    static std::vector<float> toSinglePrecision(std::vector<ValueType> const& vector);
+
+    /*!
+     * Performs (Gauss-Seidel style) value iteration until the maximal difference between two iterations is below the given precision.
+     * As single precision values are perturbed by rounding in every iteration, differences that are within a few
+     * rounding errors of the values are also considered converged.
+     *
+     * @param dir The optimization direction.
+     * @param x The initial values which are replaced by the result.
+     * @param b The (single precision) vector that is added to the result of the multiplication.
+     * @param precision The precision used for the convergence check.
+     * @param relative Whether the convergence check is relative.
+     * @param maximalNumberOfIterations The maximal number of iterations to perform.
+     * @param iterations Is set to the number of performed iterations.
+     * @return True iff the iteration converged.
+     */
+    bool performValueIteration(OptimizationDirection dir, std::vector<float>& x, std::vector<float> const& b, float precision, bool relative,
+                               uint64_t maximalNumberOfIterations, uint64_t& iterations) const;
+
+   private:
+    template<OptimizationDirection dir>
+    bool performValueIteration(std::vector<float>& x, std::vector<float> const& b, float precision, bool relative, uint64_t maximalNumberOfIterations,
+                               uint64_t& iterations) const;
+
+    std::vector<float> matrixValues;
+    std::vector<IndexType> matrixColumns;
+    std::vector<IndexType> rowIndications;
+    std::vector<IndexType> rowGroupIndices;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -101,7 +101,8 @@ std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Envi
         case MultiplierType::Gmmxx:
             return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
         case MultiplierType::Native:
-            return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+            return std::make_unique<NativeMultiplier<ValueType>>(matrix, env.solver().multiplier().isCompactStorageSet(),
+                                                                 env.solver().multiplier().isVectorizeSet());
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
 }
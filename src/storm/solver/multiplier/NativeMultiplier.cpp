@@ -6,6 +6,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/storage/CompactSparseMatrix.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/adapters/IntelTbbAdapter.h"
@@ -18,10 +19,33 @@ namespace storm {
 namespace solver {
 
 template<typename ValueType>
-NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix, bool useCompactStorage, bool useVectorizedKernels)
+    : Multiplier<ValueType>(matrix), useCompactStorage(useCompactStorage || useVectorizedKernels), useVectorizedKernels(useVectorizedKernels) {
     // Intentionally left empty.
 }
 
+template<typename ValueType>
+NativeMultiplier<ValueType>::~NativeMultiplier() {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::clearCache() const {
+    compactMatrix.reset();
+    Multiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+storm::storage::CompactSparseMatrix<ValueType> const* NativeMultiplier<ValueType>::getCompactMatrix() const {
+    if (useCompactStorage && !compactMatrix) {
+        compactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(this->matrix, true, useVectorizedKernels);
+        STORM_LOG_DEBUG("Created compact matrix copy with " << (compactMatrix->hasNarrowColumnIndices() ? 32 : 64) << " bit column indices using "
+                                                            << compactMatrix->getSizeInMemory() << " bytes (vectorization: "
+                                                            << storm::storage::detail::toString(compactMatrix->getVectorization()) << ").");
+    }
+    return compactMatrix.get();
+}
+
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
@@ -56,7 +80,13 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b,
                                                       bool backwards) const {
-    if (backwards) {
+    if (auto compact = getCompactMatrix()) {
+        if (backwards) {
+            compact->multiplyWithVectorBackward(x, x, b);
+        } else {
+            compact->multiplyWithVectorForward(x, x, b);
+        }
+    } else if (backwards) {
         this->matrix.multiplyWithVectorBackward(x, x, b);
     } else {
         this->matrix.multiplyWithVectorForward(x, x, b);
@@ -90,7 +120,13 @@ template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
                                                                std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
                                                                std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-    if (backwards) {
+    if (auto compact = getCompactMatrix()) {
+        if (backwards) {
+            compact->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+        } else {
+            compact->multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+        }
+    } else if (backwards) {
         this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
     } else {
         this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
@@ -99,6 +135,10 @@ void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+    if (auto compact = getCompactMatrix()) {
+        compact->multiplyRowWithVector(rowIndex, x, value);
+        return;
+    }
     for (auto const& entry : this->matrix.getRow(rowIndex)) {
         value += entry.getValue() * x[entry.getColumn()];
     }
@@ -107,6 +147,11 @@ void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vec
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                                                ValueType& val2) const {
+    if (auto compact = getCompactMatrix()) {
+        compact->multiplyRowWithVector(rowIndex, x1, val1);
+        compact->multiplyRowWithVector(rowIndex, x2, val2);
+        return;
+    }
     for (auto const& entry : this->matrix.getRow(rowIndex)) {
         val1 += entry.getValue() * x1[entry.getColumn()];
         val2 += entry.getValue() * x2[entry.getColumn()];
@@ -115,20 +160,32 @@ void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::ve
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-    this->matrix.multiplyWithVector(x, result, b);
+    if (auto compact = getCompactMatrix()) {
+        compact->multiplyWithVectorForward(x, result, b);
+    } else {
+        this->matrix.multiplyWithVector(x, result, b);
+    }
 }
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                 std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                                 std::vector<uint64_t>* choices) const {
-    this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+    if (auto compact = getCompactMatrix()) {
+        compact->multiplyAndReduceForward(dir, rowGroupIndices, x, b, result, choices);
+    } else {
+        this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+    }
 }
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
 #ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyWithVectorParallel(x, result, b);
+    if (auto compact = getCompactMatrix()) {
+        compact->multiplyWithVectorParallel(x, result, b);
+    } else {
+        this->matrix.multiplyWithVectorParallel(x, result, b);
+    }
 #else
     STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
     multAdd(x, b, result);
@@ -140,7 +197,11 @@ void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::Optimizat
                                                         std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                                         std::vector<uint64_t>* choices) const {
 #ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+    if (auto compact = getCompactMatrix()) {
+        compact->multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+    } else {
+        this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+    }
 #else
     STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
     multAddReduce(dir, rowGroupIndices, x, b, result, choices);
@@ -76,9 +76,12 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
 
     // For each entry in the row d, we need to build a list of other rows that will contain an element in the
     // column d.
-    std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-    for (auto& backwardEntry : newBackwardEntries) {
-        backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+    if (newBackwardEntries.size() < entriesInRow.size()) {
+        newBackwardEntries.resize(entriesInRow.size());
+    }
+    for (uint_fast64_t index = 0; index < entriesInRow.size(); ++index) {
+        newBackwardEntries[index].clear();
+        newBackwardEntries[index].reserve(elementsWithEntryInColumnEqualRow.size());
     }
 
     // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -123,7 +126,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
+        FlexibleRowType& newSuccessors = rowBuffer;
+        newSuccessors.clear();
         newSuccessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
 
@@ -179,8 +183,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
             }
         }
 
-        // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        // Now swap the new transitions in place.
+        predecessorForwardTransitions.swap(newSuccessors);
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
@@ -217,7 +221,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
         FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
 
-        FlexibleRowType newPredecessors;
+        FlexibleRowType& newPredecessors = rowBuffer;
+        newPredecessors.clear();
         newPredecessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
 
@@ -257,8 +262,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                              return a.getColumn() != row;
                          });
         }
-        // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        // Now swap the new predecessors in place.
+        successorBackwardTransitions.swap(newPredecessors);
         ++successorOffsetInNewBackwardTransitions;
     }
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
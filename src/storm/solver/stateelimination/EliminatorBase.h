@@ -34,6 +34,12 @@ class EliminatorBase {
    protected:
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+
+   private:
+    // Buffers that are recycled across eliminations. Merged rows are built in the row buffer, which is then swapped with the
+    // row it replaces, so that the storage of the replaced row is reused for the next merge instead of being freed.
+    FlexibleRowType rowBuffer;
+    std::vector<FlexibleRowType> newBackwardEntries;
 };
 
 }  // namespace stateelimination
@@ -9,8 +9,15 @@
 #include <vector>
 
 namespace storm {
+namespace generator {
+class JitCompiledPrismProgram;
+}
+
 namespace storage {
 
+template<typename ValueType, typename Hash>
+class ConcurrentBitVectorHashMap;
+
 /*!
  * A bit vector that is internally represented as a vector of 64-bit values.
  */
@@ -554,6 +561,11 @@ class BitVector {
     template<typename StateType>
     friend struct Murmur3BitVectorHash;
 
+    template<typename ValueType, typename Hash>
+    friend class ConcurrentBitVectorHashMap;
+
+    friend class storm::generator::JitCompiledPrismProgram;
+
    private:
     /*!
      * Creates an empty bit vector with the given number of buckets.
@@ -109,6 +109,15 @@ class BitVectorHashMap {
      */
     ValueType getValue(uint64_t bucket) const;
 
+    /*!
+     * Searches for the given key in the map without modifying the map.
+     *
+     * @param key The key to search.
+     * @return A pair whose first component indicates whether the key is contained in the map and whose second
+     * component is the mapped-to value (if the key was found).
+     */
+    std::pair<bool, ValueType> findValue(storm::storage::BitVector const& key) const;
+
     /*!
      * Checks if the given key is already contained in the map.
      *
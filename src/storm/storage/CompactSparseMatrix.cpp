@@ -0,0 +1,202 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include <limits>
+#include <type_traits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/CompactSparseMatrixKernels.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+CompactSparseMatrix<ValueType>::CompactSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices, bool allowVectorization)
+    : columnCount(matrix.getColumnCount()),
+      narrowColumnIndices(allowNarrowColumnIndices && matrix.getColumnCount() <= std::numeric_limits<uint32_t>::max()),
+      vectorization(detail::SimdInstructionSet::None) {
+    // The vectorized kernels gather the vector elements using 32 bit indices. As the gathers interpret them as signed
+    // offsets, they can only address columns below 2^31.
+    if (allowVectorization && std::is_same<ValueType, double>::value && narrowColumnIndices && detail::canUseVectorizedKernels(columnCount)) {
+        vectorization = detail::getSupportedSimdInstructionSet();
+    }
+    STORM_LOG_INFO_COND(!allowVectorization || vectorization != detail::SimdInstructionSet::None,
+                        "Vectorized matrix kernels are not available for this matrix or CPU, using scalar kernels.");
+
+    rowIndications.reserve(matrix.getRowCount() + 1);
+    values.reserve(matrix.getEntryCount());
+    if (narrowColumnIndices) {
+        narrowColumns.reserve(matrix.getEntryCount());
+    } else {
+        wideColumns.reserve(matrix.getEntryCount());
+    }
+
+    rowIndications.push_back(0);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            values.push_back(entry.getValue());
+            if (narrowColumnIndices) {
+                narrowColumns.push_back(static_cast<uint32_t>(entry.getColumn()));
+            } else {
+                wideColumns.push_back(entry.getColumn());
+            }
+        }
+        rowIndications.push_back(values.size());
+    }
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getEntryCount() const {
+    return values.size();
+}
+
+template<typename ValueType>
+bool CompactSparseMatrix<ValueType>::hasNarrowColumnIndices() const {
+    return narrowColumnIndices;
+}
+
+template<typename ValueType>
+detail::SimdInstructionSet CompactSparseMatrix<ValueType>::getVectorization() const {
+    return vectorization;
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getSizeInMemory() const {
+    return sizeof(*this) + sizeof(uint64_t) * rowIndications.capacity() + sizeof(ValueType) * values.capacity() +
+           sizeof(uint32_t) * narrowColumns.capacity() + sizeof(uint64_t) * wideColumns.capacity();
+}
+
+template<typename ValueType>
+template<typename Function>
+void CompactSparseMatrix<ValueType>::withRowProduct(Function const& function) const {
+    if (narrowColumnIndices) {
+        function(detail::ScalarRowProduct<ValueType, uint32_t>{rowIndications.data(), values.data(), narrowColumns.data()});
+    } else {
+        function(detail::ScalarRowProduct<ValueType, uint64_t>{rowIndications.data(), values.data(), wideColumns.data()});
+    }
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyRowRange(uint64_t firstRow, uint64_t endRow, std::vector<ValueType> const& vector,
+                                                      std::vector<ValueType>& result, std::vector<ValueType> const* summand, bool backward) const {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (vectorization != detail::SimdInstructionSet::None) {
+            detail::multiplyRowsVectorized(vectorization, {rowIndications.data(), values.data(), narrowColumns.data()}, firstRow, endRow, vector, result,
+                                           summand, backward);
+            return;
+        }
+    }
+    withRowProduct([&](auto const& rowProduct) { detail::multiplyRows(rowProduct, firstRow, endRow, vector, result, summand, backward); });
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduceGroupRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                                 uint64_t firstGroup, uint64_t endGroup, std::vector<ValueType> const& vector,
+                                                                 std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                 std::vector<uint64_t>* choices, bool backward) const {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (vectorization != detail::SimdInstructionSet::None) {
+            detail::multiplyAndReduceGroupsVectorized(vectorization, dir, {rowIndications.data(), values.data(), narrowColumns.data()}, rowGroupIndices,
+                                                      firstGroup, endGroup, vector, summand, result, choices, backward);
+            return;
+        }
+    }
+    withRowProduct([&](auto const& rowProduct) {
+        if (dir == OptimizationDirection::Minimize) {
+            detail::multiplyAndReduceGroups<ValueType, storm::utility::ElementLess<ValueType>>(rowProduct, rowGroupIndices, firstGroup, endGroup, vector,
+                                                                                              summand, result, choices, backward);
+        } else {
+            detail::multiplyAndReduceGroups<ValueType, storm::utility::ElementGreater<ValueType>>(rowProduct, rowGroupIndices, firstGroup, endGroup, vector,
+                                                                                                 summand, result, choices, backward);
+        }
+    });
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceGroupRange(OptimizationDirection const&, std::vector<uint64_t> const&, uint64_t, uint64_t,
+                                                                               std::vector<storm::RationalFunction> const&,
+                                                                               std::vector<storm::RationalFunction> const*,
+                                                                               std::vector<storm::RationalFunction>&, std::vector<uint64_t>*, bool) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+}
+#endif
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                               std::vector<ValueType> const* summand) const {
+    multiplyRowRange(0, getRowCount(), vector, result, summand, false);
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                std::vector<ValueType> const* summand) const {
+    multiplyRowRange(0, getRowCount(), vector, result, summand, true);
+}
+
+#ifdef STORM_HAVE_INTELTBB
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "Parallel matrix-vector-multiplication invoked with aliased vectors.");
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, getRowCount(), 100), [&](tbb::blocked_range<uint64_t> const& range) {
+        multiplyRowRange(range.begin(), range.end(), vector, result, summand, false);
+    });
+}
+#endif
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                              std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                              std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    multiplyAndReduceGroupRange(dir, rowGroupIndices, 0, rowGroupIndices.size() - 1, vector, summand, result, choices, false);
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                               std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                               std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    multiplyAndReduceGroupRange(dir, rowGroupIndices, 0, rowGroupIndices.size() - 1, vector, summand, result, choices, true);
+}
+
+#ifdef STORM_HAVE_INTELTBB
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                               std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                               std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(&vector != &result, "Parallel matrix-vector-multiplication invoked with aliased vectors.");
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, rowGroupIndices.size() - 1, 100), [&](tbb::blocked_range<uint64_t> const& range) {
+        multiplyAndReduceGroupRange(dir, rowGroupIndices, range.begin(), range.end(), vector, summand, result, choices, false);
+    });
+}
+#endif
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyRowWithVector(uint64_t row, std::vector<ValueType> const& vector, ValueType& value) const {
+    withRowProduct([&](auto const& rowProduct) { rowProduct.template multiply<false>(row, vector, value); });
+}
+
+template class CompactSparseMatrix<double>;
+#ifdef STORM_HAVE_CARL
+template class CompactSparseMatrix<storm::RationalNumber>;
+template class CompactSparseMatrix<storm::RationalFunction>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm-config.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/VectorizedMatrixKernels.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+class SparseMatrix;
+
+/*!
+ * A read-only copy of a sparse matrix that is optimized for matrix-vector multiplications. In contrast to the
+ * SparseMatrix, which stores column indices and values interleaved, the columns and values are stored in separate
+ * arrays (structure of arrays). If the number of columns permits it, column indices are stored using 32 bits. For
+ * double matrices, this reduces the size of a matrix entry from 16 to 12 bytes and hence the memory traffic of the
+ * (typically memory-bound) multiplication kernels. Note that the copy does not replace the original matrix, i.e.,
+ * holding both increases the overall memory consumption by the size of the copy (see getSizeInMemory).
+ *
+ * The multiplication methods mirror the ones of the SparseMatrix and produce the same results. For double matrices with
+ * fewer than 2^31 columns, vectorized (AVX2 or AVX-512) kernels can be used if the CPU supports them. These kernels sum
+ * up the entries of a row in a different order, so their results may differ slightly due to rounding.
+ */
+template<typename ValueType>
+class CompactSparseMatrix {
+   public:
+    /*!
+     * Creates a compact copy of the given matrix.
+     *
+     * @param matrix The matrix to copy.
+     * @param allowNarrowColumnIndices If set, column indices are stored using 32 bits whenever possible.
+     * @param allowVectorization If set, vectorized kernels are used for the multiplications whenever possible.
+     */
+    CompactSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices = true, bool allowVectorization = false);
+
+    /*!
+     * Retrieves the number of rows of the matrix.
+     */
+    uint64_t getRowCount() const;
+
+    /*!
+     * Retrieves the number of columns of the matrix.
+     */
+    uint64_t getColumnCount() const;
+
+    /*!
+     * Retrieves the number of (explicitly stored) entries of the matrix.
+     */
+    uint64_t getEntryCount() const;
+
+    /*!
+     * Retrieves whether the column indices are stored using 32 bits.
+     */
+    bool hasNarrowColumnIndices() const;
+
+    /*!
+     * Retrieves the instruction set of the vectorized kernels that are used for multiplications (None if the
+     * multiplications are not vectorized).
+     */
+    detail::SimdInstructionSet getVectorization() const;
+
+    /*!
+     * Returns the size of the matrix in memory measured in bytes.
+     */
+    uint64_t getSizeInMemory() const;
+
+    /*!
+     * Multiplies the matrix with the given vector and writes the result to the given result vector. The rows are
+     * processed in ascending order, so if the vector and the result are the same, this performs a Gauss-Seidel
+     * style multiplication.
+     *
+     * @param vector The vector with which to multiply the matrix.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param summand If given, this summand will be added to the result of the multiplication.
+     */
+    void multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                   std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Like multiplyWithVectorForward, but processes the rows in descending order.
+     */
+    void multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                    std::vector<ValueType> const* summand = nullptr) const;
+
+#ifdef STORM_HAVE_INTELTBB
+    /*!
+     * Like multiplyWithVectorForward, but processes the rows in parallel. The vector and the result must not be the
+     * same.
+     */
+    void multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                    std::vector<ValueType> const* summand = nullptr) const;
+#endif
+
+    /*!
+     * Multiplies the matrix with the given vector, reduces the result for each row group with respect to the
+     * given direction and writes it to the result vector. The row groups are processed in ascending order, so if
+     * the vector and the result are the same, this performs a Gauss-Seidel style multiplication.
+     *
+     * @param dir The direction for the reduction.
+     * @param rowGroupIndices The row groups to use for the reduction.
+     * @param vector The vector with which to multiply the matrix.
+     * @param summand If given, this summand will be added to the result of the multiplication.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param choices If given, the choices made in the reduction process are written to this vector. Choices are
+     * only updated if the new choice is strictly better than the old one.
+     */
+    void multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                  std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    /*!
+     * Like multiplyAndReduceForward, but processes the row groups (and the rows within each group) in descending
+     * order.
+     */
+    void multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                   std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+#ifdef STORM_HAVE_INTELTBB
+    /*!
+     * Like multiplyAndReduceForward, but processes the row groups in parallel. The vector and the result must not
+     * be the same.
+     */
+    void multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                   std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+#endif
+
+    /*!
+     * Multiplies a single row of the matrix with the given vector and adds the result to the given value.
+     *
+     * @param row The index of the row.
+     * @param vector The vector with which to multiply the row.
+     * @param value The value to which the result is added.
+     */
+    void multiplyRowWithVector(uint64_t row, std::vector<ValueType> const& vector, ValueType& value) const;
+
+   private:
+    /*!
+     * Invokes the given function with a functor computing the (scalar) product of a row and a vector. The type of the
+     * functor depends on the width of the column indices.
+     */
+    template<typename Function>
+    void withRowProduct(Function const& function) const;
+
+    /*!
+     * Multiplies the rows in the range [firstRow, endRow) with the given vector (in the given order).
+     */
+    void multiplyRowRange(uint64_t firstRow, uint64_t endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                          std::vector<ValueType> const* summand, bool backward) const;
+
+    /*!
+     * Multiplies the rows of the row groups in the range [firstGroup, endGroup) with the given vector and reduces them
+     * (in the given order).
+     */
+    void multiplyAndReduceGroupRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t firstGroup, uint64_t endGroup,
+                                     std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                     std::vector<uint64_t>* choices, bool backward) const;
+
+    // The number of columns of the matrix.
+    uint64_t columnCount;
+
+    // A vector indicating the first entry of each row (and the total number of entries at the end).
+    std::vector<uint64_t> rowIndications;
+
+    // The values of all entries.
+    std::vector<ValueType> values;
+
+    // The column indices of all entries if they are stored with 32 bits.
+    std::vector<uint32_t> narrowColumns;
+
+    // The column indices of all entries if they are stored with 64 bits.
+    std::vector<uint64_t> wideColumns;
+
+    // Whether the column indices are stored with 32 bits.
+    bool narrowColumnIndices;
+
+    // The instruction set used by the vectorized kernels (None if no vectorized kernels are used).
+    detail::SimdInstructionSet vectorization;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/utility/constants.h"
+
+// The loops below are instantiated with vectorized row products in functions that are compiled for specific
+// instruction sets. Forcing them to be inlined ensures that the loops are compiled for the same instruction set.
+#if defined(__GNUC__)
+#define STORM_MATRIX_KERNEL_INLINE inline __attribute__((always_inline))
+#else
+#define STORM_MATRIX_KERNEL_INLINE inline
+#endif
+
+namespace storm {
+namespace storage {
+namespace detail {
+
+/*!
+ * Computes the product of a row of a matrix in compact storage with a vector.
+ */
+template<typename ValueType, typename ColumnType>
+struct ScalarRowProduct {
+    uint64_t const* rowIndications;
+    ValueType const* values;
+    ColumnType const* columns;
+
+    /*!
+     * Adds the product of the given row and the given vector to the given value. The entries of the row are
+     * processed in the same order as by the corresponding methods of SparseMatrix.
+     */
+    template<bool Backward>
+    STORM_MATRIX_KERNEL_INLINE void multiply(uint64_t row, std::vector<ValueType> const& vector, ValueType& value) const {
+        if (Backward) {
+            for (uint64_t entry = rowIndications[row + 1], entryEnd = rowIndications[row]; entry != entryEnd;) {
+                --entry;
+                value += values[entry] * vector[columns[entry]];
+            }
+        } else {
+            for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry != entryEnd; ++entry) {
+                value += values[entry] * vector[columns[entry]];
+            }
+        }
+    }
+};
+
+/*!
+ * Multiplies the rows in the range [firstRow, endRow) with the given vector using the given row product.
+ */
+template<bool Backward, typename ValueType, typename RowProduct>
+STORM_MATRIX_KERNEL_INLINE void multiplyRows(RowProduct const& rowProduct, uint64_t firstRow, uint64_t endRow, std::vector<ValueType> const& vector,
+                                             std::vector<ValueType>& result, std::vector<ValueType> const* summand) {
+    for (uint64_t i = firstRow; i < endRow; ++i) {
+        uint64_t row = Backward ? endRow - 1 - (i - firstRow) : i;
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        rowProduct.template multiply<Backward>(row, vector, newValue);
+        result[row] = newValue;
+    }
+}
+
+/*!
+ * Multiplies the rows in the range [firstRow, endRow) with the given vector using the given row product (in the
+ * given order).
+ */
+template<typename ValueType, typename RowProduct>
+STORM_MATRIX_KERNEL_INLINE void multiplyRows(RowProduct const& rowProduct, uint64_t firstRow, uint64_t endRow, std::vector<ValueType> const& vector,
+                                             std::vector<ValueType>& result, std::vector<ValueType> const* summand, bool backward) {
+    if (backward) {
+        multiplyRows<true>(rowProduct, firstRow, endRow, vector, result, summand);
+    } else {
+        multiplyRows<false>(rowProduct, firstRow, endRow, vector, result, summand);
+    }
+}
+
+/*!
+ * Multiplies the rows of the row groups in the range [firstGroup, endGroup) with the given vector using the given row
+ * product and reduces them using the given comparator. Choices are only updated if the new choice is strictly
+ * better than the old one.
+ */
+template<bool Backward, typename ValueType, typename Compare, typename RowProduct>
+STORM_MATRIX_KERNEL_INLINE void multiplyAndReduceGroups(RowProduct const& rowProduct, std::vector<uint64_t> const& rowGroupIndices, uint64_t firstGroup,
+                                                        uint64_t endGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                        std::vector<ValueType>& result, std::vector<uint64_t>* choices) {
+    Compare compare;
+
+    // Variables for correctly tracking choices (only update if new choice is strictly better).
+    ValueType oldSelectedChoiceValue;
+    uint64_t selectedChoice;
+
+    for (uint64_t i = firstGroup; i < endGroup; ++i) {
+        uint64_t group = Backward ? endGroup - 1 - (i - firstGroup) : i;
+        uint64_t groupStart = rowGroupIndices[group];
+        uint64_t groupSize = rowGroupIndices[group + 1] - groupStart;
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupSize == 0) {
+            continue;
+        }
+
+        ValueType currentValue;
+        for (uint64_t rowOffset = 0; rowOffset < groupSize; ++rowOffset) {
+            uint64_t choice = Backward ? groupSize - 1 - rowOffset : rowOffset;
+            uint64_t row = groupStart + choice;
+            ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+            rowProduct.template multiply<Backward>(row, vector, newValue);
+
+            if (choices && choice == (*choices)[group]) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (rowOffset == 0 || compare(newValue, currentValue)) {
+                currentValue = newValue;
+                selectedChoice = choice;
+            }
+        }
+
+        // Finally write value to target vector.
+        result[group] = currentValue;
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+    }
+}
+
+/*!
+ * Multiplies the rows of the row groups in the range [firstGroup, endGroup) with the given vector using the given row
+ * product and reduces them using the given comparator (in the given order).
+ */
+template<typename ValueType, typename Compare, typename RowProduct>
+STORM_MATRIX_KERNEL_INLINE void multiplyAndReduceGroups(RowProduct const& rowProduct, std::vector<uint64_t> const& rowGroupIndices, uint64_t firstGroup,
+                                                        uint64_t endGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                        std::vector<ValueType>& result, std::vector<uint64_t>* choices, bool backward) {
+    if (backward) {
+        multiplyAndReduceGroups<true, ValueType, Compare>(rowProduct, rowGroupIndices, firstGroup, endGroup, vector, summand, result, choices);
+    } else {
+        multiplyAndReduceGroups<false, ValueType, Compare>(rowProduct, rowGroupIndices, firstGroup, endGroup, vector, summand, result, choices);
+    }
+}
+
+}  // namespace detail
+}  // namespace storage
+}  // namespace storm
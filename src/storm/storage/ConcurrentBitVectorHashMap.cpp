@@ -0,0 +1,272 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include "storm/exceptions/InternalException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t log2Capacity)
+    : log2Capacity(log2Capacity), entries(new std::atomic<uint64_t>[1ull << log2Capacity]), successor(nullptr), nextBlockToMove(0), movedBlocks(0) {
+    for (uint64_t entry = 0; entry < getCapacity(); ++entry) {
+        entries[entry].store(emptyEntry, std::memory_order_relaxed);
+    }
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::Table::getCapacity() const {
+    return 1ull << log2Capacity;
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+    : bucketSize(bucketSize),
+      wordsPerKey(bucketSize / 64),
+      loadFactor(loadFactor),
+      keySegments(new std::atomic<uint64_t*>[maximalNumberOfSegments]),
+      numberOfElements(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0 && bucketSize > 0, "Bucket size must be a positive multiple of 64.");
+    STORM_LOG_ASSERT(loadFactor > 0.0 && loadFactor < 1.0, "Load factor must be in (0, 1).");
+
+    uint64_t log2Capacity = 4;
+    while (static_cast<double>(1ull << log2Capacity) * loadFactor < static_cast<double>(initialSize)) {
+        ++log2Capacity;
+    }
+    firstTable = new Table(log2Capacity);
+    currentTable.store(firstTable);
+
+    for (uint64_t segment = 0; segment < maximalNumberOfSegments; ++segment) {
+        keySegments[segment].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+    Table* table = firstTable;
+    while (table != nullptr) {
+        Table* successor = table->successor.load();
+        delete table;
+        table = successor;
+    }
+    for (uint64_t segment = 0; segment < maximalNumberOfSegments; ++segment) {
+        delete[] keySegments[segment].load();
+    }
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t hash = hasher(key);
+
+    while (true) {
+        Table* table = currentTable.load(std::memory_order_acquire);
+
+        // If the load of the table is too high, we start to move the entries to a larger table.
+        if (static_cast<double>(numberOfElements.load(std::memory_order_relaxed)) >= loadFactor * static_cast<double>(table->getCapacity())) {
+            startResize(*table);
+        }
+        if (table->successor.load(std::memory_order_acquire) != nullptr) {
+            helpResize(*table);
+            continue;
+        }
+
+        std::pair<TableResult, ValueType> result = findOrAddInTable(*table, key, hash, true);
+        if (result.first == TableResult::Moved) {
+            helpResize(*table);
+        } else {
+            return std::make_pair(result.second, result.first == TableResult::Inserted);
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+std::pair<bool, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t hash = hasher(key);
+
+    while (true) {
+        Table* table = currentTable.load(std::memory_order_acquire);
+        std::pair<TableResult, ValueType> result = findOrAddInTable(*table, key, hash, false);
+        if (result.first == TableResult::Moved) {
+            helpResize(*table);
+        } else {
+            return std::make_pair(result.first == TableResult::Found, result.second);
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    return find(key).first;
+}
+
+template<class ValueType, class Hash>
+storm::storage::BitVector ConcurrentBitVectorHashMap<ValueType, Hash>::getKey(ValueType index) const {
+    storm::storage::BitVector result(bucketSize);
+    std::copy_n(getKeyStorage(index, false), wordsPerKey, result.buckets);
+    return result;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    return numberOfElements.load();
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    return currentTable.load()->getCapacity();
+}
+
+template<class ValueType, class Hash>
+std::pair<typename ConcurrentBitVectorHashMap<ValueType, Hash>::TableResult, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddInTable(
+    Table& table, storm::storage::BitVector const& key, uint64_t hash, bool insert) const {
+    uint64_t const mask = table.getCapacity() - 1;
+    uint64_t const tag = hash >> indexBits;
+
+    uint64_t position = hash & mask;
+    for (uint64_t probe = 0; probe <= mask; ++probe, position = (position + 1) & mask) {
+        std::atomic<uint64_t>& entry = table.entries[position];
+        uint64_t content = entry.load(std::memory_order_acquire);
+        while (content == emptyEntry || content == busyEntry) {
+            if (content == emptyEntry) {
+                if (!insert) {
+                    return std::make_pair(TableResult::NotFound, ValueType());
+                }
+                // Reserve the entry. If another thread was faster, we inspect what it stored instead.
+                if (entry.compare_exchange_weak(content, busyEntry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    uint64_t index = numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                    if (index >= indexMask - numberOfSpecialEntries || index > std::numeric_limits<ValueType>::max()) {
+                        // Release the reserved entry before throwing, because other threads probing it would otherwise wait forever.
+                        numberOfElements.fetch_sub(1, std::memory_order_relaxed);
+                        entry.store(emptyEntry, std::memory_order_release);
+                        STORM_LOG_THROW(false, storm::exceptions::InternalException, "Too many keys in concurrent hash map.");
+                    }
+                    std::copy_n(key.buckets, wordsPerKey, getKeyStorage(index, true));
+                    entry.store((tag << indexBits) | (index + numberOfSpecialEntries), std::memory_order_release);
+                    return std::make_pair(TableResult::Inserted, static_cast<ValueType>(index));
+                }
+            } else {
+                // Another thread is currently writing the key of this entry.
+                std::this_thread::yield();
+                content = entry.load(std::memory_order_acquire);
+            }
+        }
+
+        if (content == movedEntry) {
+            return std::make_pair(TableResult::Moved, ValueType());
+        }
+        uint64_t index = (content & indexMask) - numberOfSpecialEntries;
+        if ((content >> indexBits) == tag && keyMatches(index, key)) {
+            return std::make_pair(TableResult::Found, static_cast<ValueType>(index));
+        }
+    }
+
+    // The table is full (which can only happen if many threads inserted keys at the same time), so we need to grow it.
+    if (!insert) {
+        return std::make_pair(TableResult::NotFound, ValueType());
+    }
+    startResize(table);
+    return std::make_pair(TableResult::Moved, ValueType());
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::startResize(Table& table) {
+    if (table.successor.load(std::memory_order_acquire) == nullptr) {
+        STORM_LOG_TRACE("Increasing size of concurrent hash map from " << table.getCapacity() << " to " << 2 * table.getCapacity() << ".");
+        Table* newTable = new Table(table.log2Capacity + 1);
+        Table* expected = nullptr;
+        if (!table.successor.compare_exchange_strong(expected, newTable, std::memory_order_acq_rel)) {
+            // Another thread installed a successor in the meantime.
+            delete newTable;
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::helpResize(Table& table) const {
+    Table* successor = table.successor.load(std::memory_order_acquire);
+    STORM_LOG_ASSERT(successor != nullptr, "Cannot move entries without successor table.");
+
+    uint64_t const numberOfBlocks = (table.getCapacity() + resizeBlockSize - 1) / resizeBlockSize;
+    storm::storage::BitVector key(bucketSize);
+    for (uint64_t block = table.nextBlockToMove.fetch_add(1); block < numberOfBlocks; block = table.nextBlockToMove.fetch_add(1)) {
+        uint64_t blockEnd = std::min((block + 1) * resizeBlockSize, table.getCapacity());
+        for (uint64_t position = block * resizeBlockSize; position < blockEnd; ++position) {
+            // Mark the entry as moved, so no thread can insert into it any more.
+            std::atomic<uint64_t>& entry = table.entries[position];
+            uint64_t content = entry.load(std::memory_order_acquire);
+            while (true) {
+                if (content == busyEntry) {
+                    std::this_thread::yield();
+                    content = entry.load(std::memory_order_acquire);
+                } else if (entry.compare_exchange_weak(content, movedEntry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    break;
+                }
+            }
+
+            if (content != emptyEntry) {
+                std::copy_n(getKeyStorage((content & indexMask) - numberOfSpecialEntries, false), wordsPerKey, key.buckets);
+                insertMovedEntry(*successor, content, hasher(key));
+            }
+        }
+        table.movedBlocks.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    // Wait for the other threads to finish their blocks and then make the successor the current table.
+    while (table.movedBlocks.load(std::memory_order_acquire) < numberOfBlocks) {
+        std::this_thread::yield();
+    }
+    Table* expected = &table;
+    currentTable.compare_exchange_strong(expected, successor, std::memory_order_acq_rel);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::insertMovedEntry(Table& table, uint64_t entry, uint64_t hash) {
+    uint64_t const mask = table.getCapacity() - 1;
+    uint64_t position = hash & mask;
+    while (true) {
+        uint64_t expected = emptyEntry;
+        if (table.entries[position].compare_exchange_strong(expected, entry, std::memory_order_acq_rel)) {
+            return;
+        }
+        position = (position + 1) & mask;
+    }
+}
+
+template<class ValueType, class Hash>
+uint64_t* ConcurrentBitVectorHashMap<ValueType, Hash>::getKeyStorage(uint64_t index, bool allocate) const {
+    // Determine the segment holding the key and the position of the key within this segment.
+    uint64_t shiftedIndex = index + (1ull << firstSegmentLog2);
+    uint64_t segmentLog2 = 63 - __builtin_clzll(shiftedIndex);
+    uint64_t segment = segmentLog2 - firstSegmentLog2;
+    uint64_t offset = shiftedIndex - (1ull << segmentLog2);
+    STORM_LOG_ASSERT(segment < maximalNumberOfSegments, "Key index out of range.");
+
+    uint64_t* segmentStorage = keySegments[segment].load(std::memory_order_acquire);
+    if (segmentStorage == nullptr) {
+        STORM_LOG_ASSERT(allocate, "Access to key that was not inserted.");
+        uint64_t* newSegmentStorage = new uint64_t[(1ull << segmentLog2) * wordsPerKey];
+        if (keySegments[segment].compare_exchange_strong(segmentStorage, newSegmentStorage, std::memory_order_acq_rel)) {
+            segmentStorage = newSegmentStorage;
+        } else {
+            // Another thread allocated the segment in the meantime.
+            delete[] newSegmentStorage;
+        }
+    }
+    return segmentStorage + offset * wordsPerKey;
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::keyMatches(uint64_t index, storm::storage::BitVector const& key) const {
+    return std::memcmp(getKeyStorage(index, false), key.buckets, wordsPerKey * sizeof(uint64_t)) == 0;
+}
+
+template class ConcurrentBitVectorHashMap<uint32_t>;
+template class ConcurrentBitVectorHashMap<uint64_t>;
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a hash map whose keys are bit vectors (with a length that is a multiple of 64) that can be
+ * queried and extended by multiple threads concurrently. Every key is mapped to its index, i.e. the number of keys
+ * that were inserted before it. In contrast to the BitVectorHashMap, the values can therefore not be chosen freely.
+ *
+ * The keys are stored contiguously in an arena that grows in segments and is never moved, while the table itself
+ * only stores (tagged) indices into the arena. Insertions are lock-free except for the very short window in which
+ * a thread writes a freshly inserted key. When the table needs to grow, every thread that accesses the map helps to
+ * move a block of entries to the larger table, so there is no single thread that has to rehash all entries while the
+ * others wait. Replaced tables are only released when the map is destroyed, as other threads may still read them.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<uint64_t>>
+class ConcurrentBitVectorHashMap {
+   public:
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the keys that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of keys that can be stored before the table is resized for the first time.
+     * @param loadFactor The load factor that determines at which point the size of the table is increased.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+    ~ConcurrentBitVectorHashMap();
+
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+    /*!
+     * Searches for the given key in the map. If it is not found, it is inserted and receives the next free index.
+     * This method may be called concurrently with all other methods of this class.
+     *
+     * @param key The key to search or insert.
+     * @return A pair whose first component is the index of the key and whose second component indicates whether the
+     * key was newly inserted.
+     */
+    std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key);
+
+    /*!
+     * Searches for the given key in the map without inserting it. This method may be called concurrently with all
+     * other methods of this class.
+     *
+     * @param key The key to search.
+     * @return A pair whose first component indicates whether the key is contained in the map and whose second
+     * component is the index of the key (if the key was found).
+     */
+    std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map.
+     *
+     * @param key The key to search.
+     * @return True iff the key is already contained in the map.
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the key with the given index. The index must have been returned by a previous call to findOrAdd or
+     * find (or be smaller than the size of the map once all insertions have finished).
+     *
+     * @param index The index of the key.
+     * @return The key with the given index.
+     */
+    storm::storage::BitVector getKey(ValueType index) const;
+
+    /*!
+     * Retrieves the number of keys stored in the map.
+     *
+     * @return The number of keys.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of entries of the current table.
+     *
+     * @return The capacity of the table.
+     */
+    uint64_t capacity() const;
+
+   private:
+    // A table of entries. Each entry either holds one of the special values below or the index of a key (offset by
+    // the number of special values) together with some bits of its hash value.
+    struct Table {
+        Table(uint64_t log2Capacity);
+
+        uint64_t getCapacity() const;
+
+        // The capacity of the table is 2^log2Capacity.
+        uint64_t log2Capacity;
+
+        // The entries of the table.
+        std::unique_ptr<std::atomic<uint64_t>[]> entries;
+
+        // The table that replaces this one once all entries were moved (if any).
+        std::atomic<Table*> successor;
+
+        // The next block of entries that needs to be moved to the successor.
+        std::atomic<uint64_t> nextBlockToMove;
+
+        // The number of blocks that have been moved to the successor.
+        std::atomic<uint64_t> movedBlocks;
+    };
+
+    // The possible outcomes of an operation on a single table.
+    enum class TableResult { Found, Inserted, NotFound, Moved };
+
+    /*!
+     * Searches the given key in the given table and (if requested) inserts it if it is not found.
+     *
+     * @return The outcome of the operation and the index of the key (if it was found or inserted).
+     */
+    std::pair<TableResult, ValueType> findOrAddInTable(Table& table, storm::storage::BitVector const& key, uint64_t hash, bool insert) const;
+
+    /*!
+     * Installs a table of twice the capacity as the successor of the given table (if there is none yet).
+     */
+    static void startResize(Table& table);
+
+    /*!
+     * Helps moving the entries of the given table to its successor and returns as soon as all entries were moved.
+     */
+    void helpResize(Table& table) const;
+
+    /*!
+     * Inserts the given entry whose key has the given hash into the given table, which must not contain the key yet.
+     */
+    static void insertMovedEntry(Table& table, uint64_t entry, uint64_t hash);
+
+    /*!
+     * Retrieves a pointer to the storage of the key with the given index, allocating the storage if necessary.
+     */
+    uint64_t* getKeyStorage(uint64_t index, bool allocate) const;
+
+    /*!
+     * Checks whether the key with the given index equals the given key.
+     */
+    bool keyMatches(uint64_t index, storm::storage::BitVector const& key) const;
+
+    // The special values of the table entries.
+    static const uint64_t emptyEntry = 0;
+    static const uint64_t busyEntry = 1;
+    static const uint64_t movedEntry = 2;
+    static const uint64_t numberOfSpecialEntries = 3;
+
+    // The number of bits of an entry that are used for the index of the key. The remaining bits hold a tag.
+    static const uint64_t indexBits = 40;
+    static const uint64_t indexMask = (1ull << indexBits) - 1;
+
+    // The number of entries that are moved by a thread at once when resizing the table.
+    static const uint64_t resizeBlockSize = 1024;
+
+    // The first segment of the key arena holds 2^firstSegmentLog2 keys, every further segment twice as many as
+    // the previous one.
+    static const uint64_t firstSegmentLog2 = 12;
+    static const uint64_t maximalNumberOfSegments = indexBits - firstSegmentLog2 + 1;
+
+    // The size of the keys in bits.
+    uint64_t bucketSize;
+
+    // The size of the keys in 64-bit words.
+    uint64_t wordsPerKey;
+
+    // The load factor determining when the size of the table is increased.
+    double loadFactor;
+
+    // The first table that was used by this map. All later tables can be reached via the successors.
+    Table* firstTable;
+
+    // The table that is currently used.
+    mutable std::atomic<Table*> currentTable;
+
+    // The segments of the key arena.
+    mutable std::unique_ptr<std::atomic<uint64_t*>[]> keySegments;
+
+    // The number of keys in this map. This is also the index of the next key that is inserted.
+    mutable std::atomic<uint64_t> numberOfElements;
+
+    // Functor object that is used to perform the actual hashing.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,6 +1,5 @@
-#include <list>
+#include <limits>
 #include <numeric>
-#include <queue>
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -81,17 +80,19 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
 
-    // Initialize the maximal end component list to be the full state space.
-    std::list<StateBlock> endComponentStateSets;
+    // Initialize the maximal end component candidates to be the full state space.
+    std::vector<StateBlock> candidates;
+    storm::storage::BitVector candidateStates;
     if (states) {
-        endComponentStateSets.emplace_back(states->begin(), states->end(), true);
+        candidates.emplace_back(states->begin(), states->end(), true);
+        candidateStates = *states;
     } else {
         std::vector<storm::storage::sparse::state_type> allStates;
         allStates.resize(transitionMatrix.getRowGroupCount());
         std::iota(allStates.begin(), allStates.end(), 0);
-        endComponentStateSets.emplace_back(allStates.begin(), allStates.end(), true);
+        candidates.emplace_back(allStates.begin(), allStates.end(), true);
+        candidateStates = storm::storage::BitVector(numberOfStates, true);
     }
-    storm::storage::BitVector statesToCheck(numberOfStates);
     storm::storage::BitVector includedChoices;
     if (choices) {
         includedChoices = *choices;
@@ -105,105 +106,131 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     } else {
         includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
     }
-    storm::storage::BitVector currMecAsBitVector(transitionMatrix.getRowGroupCount());
 
-    for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
-        StateBlock const& mec = *mecIterator;
-        currMecAsBitVector.clear();
-        currMecAsBitVector.set(mec.begin(), mec.end(), true);
-        // Keep track of whether the MEC changed during this iteration.
-        bool mecChanged = false;
-
-        // Get an SCC decomposition of the current MEC candidate.
+    // The included choices of the states of a candidate never leave the candidate. Hence, no SCC intersects more than one candidate and we can refine
+    // all candidates with a single SCC decomposition per round. Candidates that do not change in a round are MECs and are not considered again.
+    std::vector<StateBlock> endComponentStateSets;
+    uint64_t const noIndex = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> stateToCandidate(numberOfStates, noIndex);
+    std::vector<uint64_t> stateToScc(numberOfStates, noIndex);
+    std::vector<uint64_t> statesToCheck;
+    storm::storage::BitVector stateIsToBeChecked(numberOfStates);
+    while (!candidates.empty()) {
+        for (uint64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+            for (auto state : candidates[candidateIndex]) {
+                stateToCandidate[state] = candidateIndex;
+            }
+        }
 
+        // Get an SCC decomposition of all current MEC candidates.
         StronglyConnectedComponentDecomposition<ValueType> sccs(
-            transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
-
-        // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
-        // the MEC canditate itself.
-        mecChanged |= sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < mec.size());
+            transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&candidateStates).choices(&includedChoices).dropNaiveSccs());
+
+        // Keep track of the SCCs within each candidate and whether the candidate changed during this round.
+        std::vector<std::vector<uint64_t>> candidateSccs(candidates.size());
+        std::vector<bool> candidateChanged(candidates.size(), false);
+        for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+            for (auto state : sccs[sccIndex]) {
+                stateToScc[state] = sccIndex;
+            }
+            candidateSccs[stateToCandidate[*sccs[sccIndex].begin()]].push_back(sccIndex);
+        }
+        for (uint64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+            // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than the MEC candidate itself.
+            auto const& sccIndices = candidateSccs[candidateIndex];
+            candidateChanged[candidateIndex] =
+                sccIndices.size() != 1 || (!sccIndices.empty() && sccs[sccIndices.front()].size() < candidates[candidateIndex].size());
+        }
 
         // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
-        for (auto& scc : sccs) {
-            statesToCheck.set(scc.begin(), scc.end());
+        for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+            auto& scc = sccs[sccIndex];
+            statesToCheck.assign(scc.begin(), scc.end());
+            stateIsToBeChecked.set(scc.begin(), scc.end());
+            bool sccChanged = false;
 
             while (!statesToCheck.empty()) {
-                storm::storage::BitVector statesToRemove(numberOfStates);
-
-                for (auto state : statesToCheck) {
-                    bool keepStateInMEC = false;
+                uint64_t state = statesToCheck.back();
+                statesToCheck.pop_back();
+                stateIsToBeChecked.set(state, false);
+                if (stateToScc[state] != sccIndex) {
+                    continue;
+                }
 
-                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                        // If the choice is not part of our subsystem, skip it.
-                        if (choices && !choices->get(choice)) {
-                            continue;
-                        }
+                bool keepStateInMEC = false;
+                for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                    // If the choice is not included any more (or was never part of our subsystem), skip it.
+                    if (!includedChoices.get(choice)) {
+                        continue;
+                    }
 
-                        // If the choice is not included any more, skip it.
-                        if (!includedChoices.get(choice)) {
+                    bool choiceContainedInMEC = true;
+                    for (auto const& entry : transitionMatrix.getRow(choice)) {
+                        if (storm::utility::isZero(entry.getValue())) {
                             continue;
                         }
 
-                        bool choiceContainedInMEC = true;
-                        for (auto const& entry : transitionMatrix.getRow(choice)) {
-                            if (storm::utility::isZero(entry.getValue())) {
-                                continue;
-                            }
-
-                            if (!scc.containsState(entry.getColumn())) {
-                                includedChoices.set(choice, false);
-                                choiceContainedInMEC = false;
-                                break;
-                            }
-                        }
-
-                        // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
-                        if (choiceContainedInMEC) {
-                            keepStateInMEC = true;
+                        if (stateToScc[entry.getColumn()] != sccIndex) {
+                            includedChoices.set(choice, false);
+                            choiceContainedInMEC = false;
+                            break;
                         }
                     }
 
-                    if (!keepStateInMEC) {
-                        statesToRemove.set(state, true);
+                    // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
+                    if (choiceContainedInMEC) {
+                        keepStateInMEC = true;
                     }
                 }
 
-                // Now erase the states that have no option to stay inside the MEC with all successors.
-                mecChanged |= !statesToRemove.empty();
-                for (uint_fast64_t state : statesToRemove) {
-                    scc.erase(state);
-                }
-
-                // Now check which states should be reconsidered, because successors of them were removed.
-                statesToCheck.clear();
-                for (auto state : statesToRemove) {
+                if (!keepStateInMEC) {
+                    // Erase the state as it has no option to stay inside the MEC with all successors. Its predecessors need to be reconsidered.
+                    sccChanged = true;
+                    stateToScc[state] = noIndex;
                     for (auto const& entry : backwardTransitions.getRow(state)) {
-                        if (scc.containsState(entry.getColumn())) {
-                            statesToCheck.set(entry.getColumn());
+                        if (stateToScc[entry.getColumn()] == sccIndex && !stateIsToBeChecked.get(entry.getColumn())) {
+                            stateIsToBeChecked.set(entry.getColumn(), true);
+                            statesToCheck.push_back(entry.getColumn());
                         }
                     }
                 }
             }
-        }
 
-        // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
-        // the list instead.
-        if (mecChanged) {
-            for (StronglyConnectedComponent& scc : sccs) {
-                if (!scc.empty()) {
-                    endComponentStateSets.push_back(std::move(scc));
+            if (sccChanged) {
+                candidateChanged[stateToCandidate[*scc.begin()]] = true;
+                StronglyConnectedComponent remainingStates;
+                for (auto state : scc) {
+                    if (stateToScc[state] == sccIndex) {
+                        remainingStates.insert(remainingStates.end(), state);
+                    }
                 }
+                scc = std::move(remainingStates);
             }
+        }
 
-            std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
-            ++mecIterator;
-            endComponentStateSets.erase(eraseIterator);
-        } else {
-            // Otherwise, we proceed with the next MEC candidate.
-            ++mecIterator;
+        for (auto const& scc : sccs) {
+            for (auto state : scc) {
+                stateToScc[state] = noIndex;
+            }
         }
 
-    }  // End of loop over all MEC candidates.
+        // Candidates that did not change are MECs. Changed candidates are replaced by their (non-empty) SCCs, which are considered in the next round.
+        std::vector<StateBlock> newCandidates;
+        candidateStates.clear();
+        for (uint64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+            if (candidateChanged[candidateIndex]) {
+                for (auto sccIndex : candidateSccs[candidateIndex]) {
+                    if (!sccs[sccIndex].empty()) {
+                        candidateStates.set(sccs[sccIndex].begin(), sccs[sccIndex].end());
+                        newCandidates.push_back(std::move(sccs[sccIndex]));
+                    }
+                }
+            } else {
+                endComponentStateSets.push_back(std::move(candidates[candidateIndex]));
+            }
+        }
+        candidates = std::move(newCandidates);
+    }  // End of loop over all rounds.
 
     // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
     // contained in the MEC and store them as actual MECs.
@@ -1,5 +1,14 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include <storm/utility/vector.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <thread>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -166,6 +175,509 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+namespace {
+uint64_t const noIndex = std::numeric_limits<uint64_t>::max();
+
+/*!
+ * Invokes the given function on (roughly) equally sized chunks of the range [begin, end) using the given number of
+ * threads. The function is called with the index of the thread and the bounds of the chunk.
+ */
+template<typename Function>
+void parallelForChunks(uint64_t numberOfThreads, uint64_t begin, uint64_t end, Function const& function) {
+    uint64_t size = end - begin;
+    if (numberOfThreads <= 1 || size < numberOfThreads) {
+        function(0, begin, end);
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1);
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(function, thread, begin + size * thread / numberOfThreads, begin + size * (thread + 1) / numberOfThreads);
+    }
+    function(0, begin, begin + size / numberOfThreads);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+/*!
+ * The data that is shared among the threads of the parallel SCC decomposition. The states are partitioned into
+ * tasks that are identified by a color. Every state is only modified by the thread that processes its task, so
+ * the per-state data only needs to be atomic if it is read by other tasks.
+ */
+struct ParallelSccData {
+    explicit ParallelSccData(uint64_t numberOfStates)
+        : colors(numberOfStates), marks(numberOfStates), stateToScc(numberOfStates, noIndex), preorderNumbers(numberOfStates, noIndex) {
+        // Intentionally left empty.
+    }
+
+    // The (state-level) graph of the subsystem in compressed form, excluding self-loops.
+    std::vector<uint64_t> successorIndications;
+    std::vector<uint64_t> successors;
+    std::vector<uint64_t> predecessorIndications;
+    std::vector<uint64_t> predecessors;
+    std::vector<char> hasSelfLoop;
+
+    // The color of the task a state currently belongs to (or noIndex if the state is not considered anymore).
+    std::vector<std::atomic<uint64_t>> colors;
+    std::atomic<uint64_t> nextColor{0};
+    // Marks for the forward (1) and backward (2) reachability analysis.
+    std::vector<std::atomic<uint8_t>> marks;
+    std::vector<uint64_t> stateToScc;
+    std::atomic<uint64_t> nextScc{0};
+    std::vector<uint64_t> preorderNumbers;
+};
+
+/*!
+ * Marks all states of the given color that are reachable from the given state (in the graph given by the indications
+ * and targets) with the given mark. Large frontiers are processed by multiple threads.
+ */
+void markReachableStates(ParallelSccData& data, uint64_t startState, uint64_t color, std::vector<uint64_t> const& indications,
+                         std::vector<uint64_t> const& targets, uint8_t mark, uint64_t numberOfThreads) {
+    static const uint64_t minimalFrontierSizePerThread = 4096;
+    std::vector<uint64_t> frontier = {startState};
+    data.marks[startState].fetch_or(mark, std::memory_order_relaxed);
+    std::vector<std::vector<uint64_t>> nextFrontiers(numberOfThreads);
+    while (!frontier.empty()) {
+        uint64_t threads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, frontier.size() / minimalFrontierSizePerThread));
+        parallelForChunks(threads, 0, frontier.size(), [&](uint64_t thread, uint64_t first, uint64_t last) {
+            auto& nextFrontier = nextFrontiers[thread];
+            for (uint64_t index = first; index < last; ++index) {
+                uint64_t state = frontier[index];
+                for (uint64_t target = indications[state]; target < indications[state + 1]; ++target) {
+                    uint64_t const successor = targets[target];
+                    if (data.colors[successor].load(std::memory_order_relaxed) == color &&
+                        !(data.marks[successor].fetch_or(mark, std::memory_order_relaxed) & mark)) {
+                        nextFrontier.push_back(successor);
+                    }
+                }
+            }
+        });
+        frontier.clear();
+        for (uint64_t thread = 0; thread < threads; ++thread) {
+            frontier.insert(frontier.end(), nextFrontiers[thread].begin(), nextFrontiers[thread].end());
+            nextFrontiers[thread].clear();
+        }
+    }
+}
+
+/*!
+ * A set of states whose SCCs are yet to be determined. No SCC intersects more than one task.
+ */
+struct SccTask {
+    std::vector<uint64_t> states;
+    uint64_t color;
+    // Whether forward-backward steps are expected to split the task effectively.
+    bool splittable;
+};
+
+/*!
+ * Performs a forward-backward step on the given task: the states that are both reachable from and can reach the middle
+ * state of the task form an SCC. The remaining states are split into (at most) three tasks that can be decomposed
+ * independently, because no SCC intersects more than one of them.
+ */
+std::vector<std::vector<uint64_t>> splitTask(ParallelSccData& data, std::vector<uint64_t> const& states, uint64_t color, uint64_t numberOfThreads) {
+    // Pivoting on the first state would only split off a single SCC per step on chain-like graphs.
+    uint64_t const pivot = states[states.size() / 2];
+    markReachableStates(data, pivot, color, data.successorIndications, data.successors, 1, numberOfThreads);
+    markReachableStates(data, pivot, color, data.predecessorIndications, data.predecessors, 2, numberOfThreads);
+
+    uint64_t const scc = data.nextScc.fetch_add(1);
+    uint64_t const firstColor = data.nextColor.fetch_add(3);
+    std::vector<std::array<std::vector<uint64_t>, 3>> threadTasks(numberOfThreads);
+    parallelForChunks(numberOfThreads, 0, states.size(), [&](uint64_t thread, uint64_t first, uint64_t last) {
+        for (uint64_t index = first; index < last; ++index) {
+            uint64_t state = states[index];
+            uint8_t mark = data.marks[state].exchange(0, std::memory_order_relaxed);
+            if (mark == 3) {
+                data.stateToScc[state] = scc;
+                data.colors[state].store(noIndex, std::memory_order_relaxed);
+            } else {
+                data.colors[state].store(firstColor + mark, std::memory_order_relaxed);
+                threadTasks[thread][mark].push_back(state);
+            }
+        }
+    });
+
+    // Concatenating the chunks in order keeps the states of every task sorted.
+    std::vector<std::vector<uint64_t>> result(3);
+    for (uint64_t mark = 0; mark < 3; ++mark) {
+        for (auto& tasks : threadTasks) {
+            result[mark].insert(result[mark].end(), tasks[mark].begin(), tasks[mark].end());
+        }
+    }
+    return result;
+}
+
+/*!
+ * Decomposes the states of the given task into SCCs using the path-based algorithm by Gabow/Cheriyan/Mehlhorn.
+ */
+void decomposeTaskSequentially(ParallelSccData& data, std::vector<uint64_t> const& states, uint64_t color) {
+    std::vector<uint64_t> s;
+    std::vector<uint64_t> p;
+    std::vector<std::pair<uint64_t, uint64_t>> recursionStack;
+    uint64_t currentIndex = 0;
+    auto isConsidered = [&](uint64_t state) { return data.colors[state].load(std::memory_order_relaxed) == color && data.stateToScc[state] == noIndex; };
+    auto visit = [&](uint64_t state) {
+        data.preorderNumbers[state] = currentIndex++;
+        s.push_back(state);
+        p.push_back(state);
+        recursionStack.emplace_back(state, data.successorIndications[state]);
+    };
+
+    for (auto const& startState : states) {
+        if (data.preorderNumbers[startState] != noIndex) {
+            continue;
+        }
+        visit(startState);
+        while (!recursionStack.empty()) {
+            uint64_t currentState = recursionStack.back().first;
+            uint64_t& nextSuccessor = recursionStack.back().second;
+            if (nextSuccessor < data.successorIndications[currentState + 1]) {
+                uint64_t successor = data.successors[nextSuccessor++];
+                if (!isConsidered(successor)) {
+                    continue;
+                }
+                if (data.preorderNumbers[successor] == noIndex) {
+                    visit(successor);
+                } else {
+                    while (data.preorderNumbers[p.back()] > data.preorderNumbers[successor]) {
+                        p.pop_back();
+                    }
+                }
+            } else {
+                recursionStack.pop_back();
+                if (currentState == p.back()) {
+                    p.pop_back();
+                    uint64_t scc = data.nextScc.fetch_add(1);
+                    uint64_t poppedState;
+                    do {
+                        poppedState = s.back();
+                        s.pop_back();
+                        data.stateToScc[poppedState] = scc;
+                    } while (poppedState != currentState);
+                }
+            }
+        }
+    }
+    for (auto const& state : states) {
+        data.colors[state].store(noIndex, std::memory_order_relaxed);
+    }
+}
+}  // namespace
+
+/*!
+ * Computes the SCCs of the given subsystem using multiple threads. First, states without predecessors or successors
+ * (within the subsystem) are repeatedly removed as singleton SCCs. Then, forward-backward steps split off SCCs and
+ * partition the remaining states into tasks that are processed concurrently. Small tasks are decomposed sequentially.
+ * Finally, the SCCs are sorted topologically (bottom SCCs first), so the result is independent of the scheduling.
+ *
+ * @param stateToSccMapping A mapping from states to the SCC indices they belong to. This is filled for all states of
+ * the subsystem.
+ * @param nonTrivialStates A bit vector where entries for non-trivial states are set to true.
+ * @param sccDepths If not null, the SCC depths are stored in this vector.
+ * @return The number of SCCs.
+ */
+template<typename ValueType>
+uint64_t performSccDecompositionParallel(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem,
+                                         storm::storage::BitVector const* choices, uint64_t numberOfThreads, storm::storage::BitVector& nonTrivialStates,
+                                         std::vector<uint_fast64_t>& stateToSccMapping, std::vector<uint_fast64_t>* sccDepths) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    ParallelSccData data(numberOfStates);
+    auto isInSubsystem = [&](uint64_t state) { return !subsystem || subsystem->get(state); };
+
+    // Build the graph of the subsystem.
+    data.hasSelfLoop.assign(numberOfStates, false);
+    data.successorIndications.assign(numberOfStates + 1, 0);
+    auto forEachSuccessor = [&](uint64_t state, auto const& function) {
+        for (uint64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& entry : transitionMatrix.getRow(row)) {
+                if (isInSubsystem(entry.getColumn()) && entry.getValue() != storm::utility::zero<ValueType>()) {
+                    function(entry.getColumn());
+                }
+            }
+        }
+    };
+    std::vector<std::atomic<uint64_t>> predecessorCounts(numberOfStates + 1);
+    parallelForChunks(numberOfThreads, 0, numberOfStates, [&](uint64_t, uint64_t first, uint64_t last) {
+        for (uint64_t state = first; state < last; ++state) {
+            data.colors[state].store(isInSubsystem(state) ? 0 : noIndex, std::memory_order_relaxed);
+            data.marks[state].store(0, std::memory_order_relaxed);
+            predecessorCounts[state].store(0, std::memory_order_relaxed);
+        }
+    });
+    parallelForChunks(numberOfThreads, 0, numberOfStates, [&](uint64_t, uint64_t first, uint64_t last) {
+        for (uint64_t state = first; state < last; ++state) {
+            if (!isInSubsystem(state)) {
+                continue;
+            }
+            uint64_t count = 0;
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (successor == state) {
+                    data.hasSelfLoop[state] = true;
+                } else {
+                    ++count;
+                    predecessorCounts[successor].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+            data.successorIndications[state + 1] = count;
+        }
+    });
+    data.predecessorIndications.assign(numberOfStates + 1, 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        data.successorIndications[state + 1] += data.successorIndications[state];
+        data.predecessorIndications[state + 1] = data.predecessorIndications[state] + predecessorCounts[state].load(std::memory_order_relaxed);
+        predecessorCounts[state].store(data.predecessorIndications[state], std::memory_order_relaxed);
+    }
+    data.successors.resize(data.successorIndications.back());
+    data.predecessors.resize(data.predecessorIndications.back());
+    parallelForChunks(numberOfThreads, 0, numberOfStates, [&](uint64_t, uint64_t first, uint64_t last) {
+        for (uint64_t state = first; state < last; ++state) {
+            if (!isInSubsystem(state)) {
+                continue;
+            }
+            uint64_t position = data.successorIndications[state];
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (successor != state) {
+                    data.successors[position++] = successor;
+                    data.predecessors[predecessorCounts[successor].fetch_add(1, std::memory_order_relaxed)] = state;
+                }
+            });
+        }
+    });
+
+    // Trimming: states without predecessors or successors in the remaining subsystem form singleton SCCs. We count the remaining in- and out-degrees and
+    // remove states in rounds. For the sake of simplicity, the marks are used to store that a state was already scheduled for removal.
+    std::vector<std::atomic<uint64_t>>& remainingInDegrees = predecessorCounts;
+    std::vector<std::atomic<uint64_t>> remainingOutDegrees(numberOfStates);
+    std::vector<std::vector<uint64_t>> threadRemovals(numberOfThreads);
+    parallelForChunks(numberOfThreads, 0, numberOfStates, [&](uint64_t thread, uint64_t first, uint64_t last) {
+        for (uint64_t state = first; state < last; ++state) {
+            remainingInDegrees[state].store(data.predecessorIndications[state + 1] - data.predecessorIndications[state], std::memory_order_relaxed);
+            remainingOutDegrees[state].store(data.successorIndications[state + 1] - data.successorIndications[state], std::memory_order_relaxed);
+            if (isInSubsystem(state) && (remainingInDegrees[state].load(std::memory_order_relaxed) == 0 ||
+                                         remainingOutDegrees[state].load(std::memory_order_relaxed) == 0)) {
+                data.marks[state].store(1, std::memory_order_relaxed);
+                threadRemovals[thread].push_back(state);
+            }
+        }
+    });
+    std::vector<uint64_t> removals;
+    for (auto& threadRemoval : threadRemovals) {
+        removals.insert(removals.end(), threadRemoval.begin(), threadRemoval.end());
+        threadRemoval.clear();
+    }
+    while (!removals.empty()) {
+        uint64_t threads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, removals.size() / 4096));
+        uint64_t firstScc = data.nextScc.fetch_add(removals.size());
+        parallelForChunks(threads, 0, removals.size(), [&](uint64_t thread, uint64_t first, uint64_t last) {
+            for (uint64_t index = first; index < last; ++index) {
+                uint64_t state = removals[index];
+                data.stateToScc[state] = firstScc + index;
+                data.colors[state].store(noIndex, std::memory_order_relaxed);
+                for (uint64_t position = data.successorIndications[state]; position < data.successorIndications[state + 1]; ++position) {
+                    uint64_t successor = data.successors[position];
+                    if (remainingInDegrees[successor].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                        data.marks[successor].exchange(1, std::memory_order_relaxed) == 0) {
+                        threadRemovals[thread].push_back(successor);
+                    }
+                }
+                for (uint64_t position = data.predecessorIndications[state]; position < data.predecessorIndications[state + 1]; ++position) {
+                    uint64_t predecessor = data.predecessors[position];
+                    if (remainingOutDegrees[predecessor].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                        data.marks[predecessor].exchange(1, std::memory_order_relaxed) == 0) {
+                        threadRemovals[thread].push_back(predecessor);
+                    }
+                }
+            }
+        });
+        removals.clear();
+        for (uint64_t thread = 0; thread < threads; ++thread) {
+            removals.insert(removals.end(), threadRemovals[thread].begin(), threadRemovals[thread].end());
+            threadRemovals[thread].clear();
+        }
+    }
+    remainingOutDegrees.clear();
+    remainingOutDegrees.shrink_to_fit();
+
+    // Collect the states that survived the trimming. They form the first task.
+    std::vector<uint64_t> remainingStates;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        data.marks[state].store(0, std::memory_order_relaxed);
+        if (data.colors[state].load(std::memory_order_relaxed) == 0) {
+            remainingStates.push_back(state);
+        }
+    }
+    data.nextColor.store(1);
+    STORM_LOG_DEBUG("Trimming removed " << data.nextScc.load() << " singleton SCCs, " << remainingStates.size() << " states remain.");
+
+    // Process the tasks. Large tasks are split by forward-backward steps (the first one using all threads), small tasks are decomposed sequentially.
+    // If a step only splits off a small part of a task, further steps are unlikely to do better (e.g. on long chains of SCCs) and would each traverse
+    // (almost) the whole task again, so the task is then decomposed sequentially as well.
+    uint64_t const minimalSplitSize = std::max<uint64_t>(10000, remainingStates.size() / (16 * numberOfThreads));
+    std::vector<SccTask> tasks;
+    auto splitIntoTasks = [&](SccTask const& task, uint64_t threads, std::vector<SccTask>& newTasks) {
+        for (auto& subtask : splitTask(data, task.states, task.color, threads)) {
+            if (!subtask.empty()) {
+                uint64_t color = data.colors[subtask.front()].load(std::memory_order_relaxed);
+                bool splittable = subtask.size() <= task.states.size() / 8 * 7;
+                newTasks.push_back(SccTask{std::move(subtask), color, splittable});
+            }
+        }
+    };
+    if (remainingStates.size() >= minimalSplitSize) {
+        splitIntoTasks(SccTask{std::move(remainingStates), 0, true}, numberOfThreads, tasks);
+    } else if (!remainingStates.empty()) {
+        tasks.push_back(SccTask{std::move(remainingStates), 0, false});
+    }
+
+    std::mutex tasksMutex;
+    std::condition_variable tasksCondition;
+    uint64_t unfinishedTasks = tasks.size();
+    std::vector<std::exception_ptr> exceptions(numberOfThreads);
+    auto processTasks = [&](uint64_t thread) {
+        try {
+            while (true) {
+                SccTask task;
+                {
+                    std::unique_lock<std::mutex> lock(tasksMutex);
+                    tasksCondition.wait(lock, [&]() { return !tasks.empty() || unfinishedTasks == 0; });
+                    if (tasks.empty()) {
+                        return;
+                    }
+                    task = std::move(tasks.back());
+                    tasks.pop_back();
+                }
+                std::vector<SccTask> newTasks;
+                if (task.splittable && task.states.size() >= minimalSplitSize) {
+                    splitIntoTasks(task, 1, newTasks);
+                } else {
+                    decomposeTaskSequentially(data, task.states, task.color);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(tasksMutex);
+                    unfinishedTasks += newTasks.size();
+                    --unfinishedTasks;
+                    for (auto& newTask : newTasks) {
+                        tasks.push_back(std::move(newTask));
+                    }
+                }
+                tasksCondition.notify_all();
+            }
+        } catch (...) {
+            exceptions[thread] = std::current_exception();
+            std::lock_guard<std::mutex> lock(tasksMutex);
+            tasks.clear();
+            unfinishedTasks = 0;
+            tasksCondition.notify_all();
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1);
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(processTasks, thread);
+    }
+    processTasks(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    // Sort the SCCs topologically such that every SCC only reaches SCCs with a smaller index. Among the SCCs whose successor SCCs are all sorted, we
+    // pick the one with the smallest state, which makes the result deterministic.
+    uint64_t const sccCount = data.nextScc.load();
+    std::vector<uint64_t> sccStateIndications(sccCount + 1, 0);
+    std::vector<uint64_t> minimalStates(sccCount, noIndex);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (isInSubsystem(state)) {
+            uint64_t scc = data.stateToScc[state];
+            STORM_LOG_ASSERT(scc < sccCount, "State " << state << " was not assigned to an SCC.");
+            ++sccStateIndications[scc + 1];
+            minimalStates[scc] = std::min(minimalStates[scc], state);
+        }
+    }
+    for (uint64_t scc = 0; scc < sccCount; ++scc) {
+        sccStateIndications[scc + 1] += sccStateIndications[scc];
+    }
+    std::vector<uint64_t> sccStates(sccStateIndications.back());
+    {
+        std::vector<uint64_t> nextPosition(sccStateIndications.begin(), sccStateIndications.end() - 1);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (isInSubsystem(state)) {
+                sccStates[nextPosition[data.stateToScc[state]]++] = state;
+            }
+        }
+    }
+    std::vector<uint64_t> remainingSuccessorSccs(sccCount, 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (isInSubsystem(state)) {
+            uint64_t scc = data.stateToScc[state];
+            for (uint64_t position = data.successorIndications[state]; position < data.successorIndications[state + 1]; ++position) {
+                if (data.stateToScc[data.successors[position]] != scc) {
+                    ++remainingSuccessorSccs[scc];
+                }
+            }
+        }
+    }
+    std::priority_queue<std::pair<uint64_t, uint64_t>, std::vector<std::pair<uint64_t, uint64_t>>, std::greater<std::pair<uint64_t, uint64_t>>> readySccs;
+    for (uint64_t scc = 0; scc < sccCount; ++scc) {
+        if (remainingSuccessorSccs[scc] == 0) {
+            readySccs.emplace(minimalStates[scc], scc);
+        }
+    }
+    std::vector<uint64_t> sortedIndices(sccCount);
+    if (sccDepths) {
+        sccDepths->assign(sccCount, 0);
+    }
+    uint64_t sortedSccCount = 0;
+    while (!readySccs.empty()) {
+        uint64_t scc = readySccs.top().second;
+        readySccs.pop();
+        sortedIndices[scc] = sortedSccCount;
+        uint64_t depth = 0;
+        for (uint64_t index = sccStateIndications[scc]; index < sccStateIndications[scc + 1]; ++index) {
+            uint64_t state = sccStates[index];
+            if (sccDepths) {
+                for (uint64_t position = data.successorIndications[state]; position < data.successorIndications[state + 1]; ++position) {
+                    uint64_t successorScc = data.stateToScc[data.successors[position]];
+                    if (successorScc != scc) {
+                        depth = std::max(depth, (*sccDepths)[sortedIndices[successorScc]] + 1);
+                    }
+                }
+            }
+            for (uint64_t position = data.predecessorIndications[state]; position < data.predecessorIndications[state + 1]; ++position) {
+                uint64_t predecessorScc = data.stateToScc[data.predecessors[position]];
+                if (predecessorScc != scc && --remainingSuccessorSccs[predecessorScc] == 0) {
+                    readySccs.emplace(minimalStates[predecessorScc], predecessorScc);
+                }
+            }
+        }
+        if (sccDepths) {
+            (*sccDepths)[sortedSccCount] = depth;
+        }
+        ++sortedSccCount;
+    }
+    STORM_LOG_ASSERT(sortedSccCount == sccCount, "Unable to sort the SCCs topologically.");
+
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (isInSubsystem(state)) {
+            uint64_t scc = data.stateToScc[state];
+            stateToSccMapping[state] = sortedIndices[scc];
+            if (data.hasSelfLoop[state] || sccStateIndications[scc + 1] - sccStateIndications[scc] > 1) {
+                nonTrivialStates.set(state, true);
+            }
+        }
+    }
+    return sccCount;
+}
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
@@ -179,7 +691,14 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
 
     // Obtain a mapping from states to the SCC it belongs to
     std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-    {
+    if (options.numberOfThreads > 1) {
+        sccDepths = boost::none;
+        if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
+            sccDepths = std::vector<uint_fast64_t>();
+        }
+        sccCount = performSccDecompositionParallel(transitionMatrix, options.subsystemPtr, options.choicesPtr, options.numberOfThreads, nonTrivialStates,
+                                                   stateToSccMapping, sccDepths ? &sccDepths.get() : nullptr);
+    } else {
         // Set up the environment of the algorithm.
         // Start with the two stacks it maintains.
         // This is to reduce memory (re-)allocations
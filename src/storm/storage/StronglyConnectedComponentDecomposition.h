@@ -49,6 +49,12 @@ struct StronglyConnectedComponentDecompositionOptions {
         isComputeSccDepthsSet = value;
         return *this;
     }
+    /// Sets the number of threads used for the decomposition. If more than one thread is used, the SCCs are still sorted topologically, but the
+    /// order may differ from the one obtained with a single thread.
+    StronglyConnectedComponentDecompositionOptions& threads(uint64_t value) {
+        numberOfThreads = value;
+        return *this;
+    }
 
     storm::storage::BitVector const* subsystemPtr = nullptr;
     storm::storage::BitVector const* choicesPtr = nullptr;
@@ -56,6 +62,7 @@ struct StronglyConnectedComponentDecompositionOptions {
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    uint64_t numberOfThreads = 1;
 };
 
 /*!
@@ -0,0 +1,196 @@
+#include "storm/storage/VectorizedMatrixKernels.h"
+
+#include <limits>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/storage/CompactSparseMatrixKernels.h"
+#include "storm/utility/macros.h"
+
+// The vectorized kernels are compiled for their instruction set via function attributes and selected at runtime, so
+// they are available regardless of the flags used for the remaining code.
+#if defined(__x86_64__) && defined(__GNUC__)
+#define STORM_HAVE_VECTORIZED_MATRIX_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace storm {
+namespace storage {
+namespace detail {
+
+std::string toString(SimdInstructionSet const& instructionSet) {
+    switch (instructionSet) {
+        case SimdInstructionSet::None:
+            return "none";
+        case SimdInstructionSet::Avx2:
+            return "AVX2";
+        case SimdInstructionSet::Avx512:
+            return "AVX-512";
+    }
+    return "unknown";
+}
+
+SimdInstructionSet getSupportedSimdInstructionSet() {
+    static const SimdInstructionSet supportedInstructionSet = []() {
+#ifdef STORM_HAVE_VECTORIZED_MATRIX_KERNELS
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl")) {
+            return SimdInstructionSet::Avx512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return SimdInstructionSet::Avx2;
+        }
+#endif
+        return SimdInstructionSet::None;
+    }();
+    return supportedInstructionSet;
+}
+
+bool canUseVectorizedKernels(uint64_t columnCount) {
+    // The largest column index is one less than the number of columns.
+    return columnCount <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) + 1;
+}
+
+#ifdef STORM_HAVE_VECTORIZED_MATRIX_KERNELS
+
+// Rows with fewer entries are multiplied with scalar instructions, as the gather does not pay off for them.
+static const uint64_t minimalVectorizedRowLength = 8;
+
+/*!
+ * Computes row products using AVX2 gathers of four vector elements at once.
+ */
+struct Avx2RowProduct {
+    CompactMatrixView matrix;
+
+    template<bool Backward>
+    __attribute__((target("avx2,fma"))) inline void multiply(uint64_t row, std::vector<double> const& vector, double& value) const {
+        uint64_t entry = matrix.rowIndications[row];
+        uint64_t const entryEnd = matrix.rowIndications[row + 1];
+        if (entryEnd - entry >= minimalVectorizedRowLength) {
+            __m256d sum = _mm256_setzero_pd();
+            for (; entry + 4 <= entryEnd; entry += 4) {
+                __m128i columns = _mm_loadu_si128(reinterpret_cast<__m128i const*>(matrix.columns + entry));
+                __m256d elements = _mm256_i32gather_pd(vector.data(), columns, sizeof(double));
+                sum = _mm256_fmadd_pd(_mm256_loadu_pd(matrix.values + entry), elements, sum);
+            }
+            __m128d halfSum = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+            value += _mm_cvtsd_f64(_mm_add_sd(halfSum, _mm_unpackhi_pd(halfSum, halfSum)));
+        }
+        for (; entry != entryEnd; ++entry) {
+            value += matrix.values[entry] * vector[matrix.columns[entry]];
+        }
+    }
+};
+
+/*!
+ * Computes row products using AVX-512 gathers of eight vector elements at once. The last (partial) block of a row is
+ * handled with masked loads and gathers.
+ */
+struct Avx512RowProduct {
+    CompactMatrixView matrix;
+
+    template<bool Backward>
+    __attribute__((target("avx512f,avx512vl"))) inline void multiply(uint64_t row, std::vector<double> const& vector, double& value) const {
+        uint64_t entry = matrix.rowIndications[row];
+        uint64_t const entryEnd = matrix.rowIndications[row + 1];
+        if (entryEnd - entry < minimalVectorizedRowLength) {
+            for (; entry != entryEnd; ++entry) {
+                value += matrix.values[entry] * vector[matrix.columns[entry]];
+            }
+            return;
+        }
+        __m512d sum = _mm512_setzero_pd();
+        for (; entry < entryEnd; entry += 8) {
+            uint64_t const remaining = entryEnd - entry;
+            __mmask8 const mask = remaining >= 8 ? static_cast<__mmask8>(0xFF) : static_cast<__mmask8>((1u << remaining) - 1);
+            __m256i columns = _mm256_maskz_loadu_epi32(mask, matrix.columns + entry);
+            __m512d elements = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, columns, vector.data(), sizeof(double));
+            sum = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, matrix.values + entry), elements, sum);
+        }
+        value += _mm512_reduce_add_pd(sum);
+    }
+};
+
+__attribute__((target("avx2,fma"))) static void multiplyRowsAvx2(CompactMatrixView const& matrix, uint64_t firstRow, uint64_t endRow,
+                                                                 std::vector<double> const& vector, std::vector<double>& result,
+                                                                 std::vector<double> const* summand, bool backward) {
+    multiplyRows(Avx2RowProduct{matrix}, firstRow, endRow, vector, result, summand, backward);
+}
+
+__attribute__((target("avx512f,avx512vl"))) static void multiplyRowsAvx512(CompactMatrixView const& matrix, uint64_t firstRow, uint64_t endRow,
+                                                                           std::vector<double> const& vector, std::vector<double>& result,
+                                                                           std::vector<double> const* summand, bool backward) {
+    multiplyRows(Avx512RowProduct{matrix}, firstRow, endRow, vector, result, summand, backward);
+}
+
+template<typename Compare>
+__attribute__((target("avx2,fma"))) static void multiplyAndReduceGroupsAvx2(CompactMatrixView const& matrix, std::vector<uint64_t> const& rowGroupIndices,
+                                                                            uint64_t firstGroup, uint64_t endGroup, std::vector<double> const& vector,
+                                                                            std::vector<double> const* summand, std::vector<double>& result,
+                                                                            std::vector<uint64_t>* choices, bool backward) {
+    multiplyAndReduceGroups<double, Compare>(Avx2RowProduct{matrix}, rowGroupIndices, firstGroup, endGroup, vector, summand, result, choices, backward);
+}
+
+template<typename Compare>
+__attribute__((target("avx512f,avx512vl"))) static void multiplyAndReduceGroupsAvx512(CompactMatrixView const& matrix,
+                                                                                      std::vector<uint64_t> const& rowGroupIndices, uint64_t firstGroup,
+                                                                                      uint64_t endGroup, std::vector<double> const& vector,
+                                                                                      std::vector<double> const* summand, std::vector<double>& result,
+                                                                                      std::vector<uint64_t>* choices, bool backward) {
+    multiplyAndReduceGroups<double, Compare>(Avx512RowProduct{matrix}, rowGroupIndices, firstGroup, endGroup, vector, summand, result, choices, backward);
+}
+
+#endif
+
+void multiplyRowsVectorized(SimdInstructionSet instructionSet, CompactMatrixView const& matrix, uint64_t firstRow, uint64_t endRow,
+                            std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand, bool backward) {
+#ifdef STORM_HAVE_VECTORIZED_MATRIX_KERNELS
+    switch (instructionSet) {
+        case SimdInstructionSet::Avx2:
+            multiplyRowsAvx2(matrix, firstRow, endRow, vector, result, summand, backward);
+            return;
+        case SimdInstructionSet::Avx512:
+            multiplyRowsAvx512(matrix, firstRow, endRow, vector, result, summand, backward);
+            return;
+        case SimdInstructionSet::None:
+            break;
+    }
+#endif
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                    "Vectorized kernels for instruction set " << toString(instructionSet) << " are not available.");
+}
+
+void multiplyAndReduceGroupsVectorized(SimdInstructionSet instructionSet, OptimizationDirection dir, CompactMatrixView const& matrix,
+                                       std::vector<uint64_t> const& rowGroupIndices, uint64_t firstGroup, uint64_t endGroup, std::vector<double> const& vector,
+                                       std::vector<double> const* summand, std::vector<double>& result, std::vector<uint64_t>* choices, bool backward) {
+#ifdef STORM_HAVE_VECTORIZED_MATRIX_KERNELS
+    bool minimize = dir == OptimizationDirection::Minimize;
+    switch (instructionSet) {
+        case SimdInstructionSet::Avx2:
+            if (minimize) {
+                multiplyAndReduceGroupsAvx2<storm::utility::ElementLess<double>>(matrix, rowGroupIndices, firstGroup, endGroup, vector, summand, result,
+                                                                                 choices, backward);
+            } else {
+                multiplyAndReduceGroupsAvx2<storm::utility::ElementGreater<double>>(matrix, rowGroupIndices, firstGroup, endGroup, vector, summand, result,
+                                                                                    choices, backward);
+            }
+            return;
+        case SimdInstructionSet::Avx512:
+            if (minimize) {
+                multiplyAndReduceGroupsAvx512<storm::utility::ElementLess<double>>(matrix, rowGroupIndices, firstGroup, endGroup, vector, summand, result,
+                                                                                   choices, backward);
+            } else {
+                multiplyAndReduceGroupsAvx512<storm::utility::ElementGreater<double>>(matrix, rowGroupIndices, firstGroup, endGroup, vector, summand,
+                                                                                      result, choices, backward);
+            }
+            return;
+        case SimdInstructionSet::None:
+            break;
+    }
+#endif
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                    "Vectorized kernels for instruction set " << toString(instructionSet) << " are not available.");
+}
+
+}  // namespace detail
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+namespace storage {
+namespace detail {
+
+/*!
+ * The SIMD instruction sets for which vectorized matrix kernels are available.
+ */
+enum class SimdInstructionSet { None, Avx2, Avx512 };
+
+std::string toString(SimdInstructionSet const& instructionSet);
+
+/*!
+ * Determines the most powerful instruction set that is supported by both the executing CPU and this build. The result
+ * is determined once and then cached.
+ */
+SimdInstructionSet getSupportedSimdInstructionSet();
+
+/*!
+ * Retrieves whether the vectorized kernels can be used for a matrix with the given number of columns. The gathers
+ * interpret the 32 bit column indices as signed offsets, so all column indices must be below 2^31.
+ */
+bool canUseVectorizedKernels(uint64_t columnCount);
+
+/*!
+ * A view on a double matrix in compact storage with 32 bit column indices. For the vectorized kernels, all column
+ * indices must be below 2^31 (see canUseVectorizedKernels).
+ */
+struct CompactMatrixView {
+    uint64_t const* rowIndications;
+    double const* values;
+    uint32_t const* columns;
+};
+
+/*!
+ * Multiplies the rows in the range [firstRow, endRow) of the given matrix with the given vector using vectorized row
+ * products. The rows are processed in the given order, so the vector and the result may be the same.
+ *
+ * @param instructionSet The instruction set to use. Must be supported (and not None).
+ */
+void multiplyRowsVectorized(SimdInstructionSet instructionSet, CompactMatrixView const& matrix, uint64_t firstRow, uint64_t endRow,
+                            std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand, bool backward);
+
+/*!
+ * Multiplies the rows of the row groups in the range [firstGroup, endGroup) of the given matrix with the given vector
+ * using vectorized row products and reduces them with respect to the given direction. The groups are processed in
+ * the given order, so the vector and the result may be the same.
+ *
+ * @param instructionSet The instruction set to use. Must be supported (and not None).
+ */
+void multiplyAndReduceGroupsVectorized(SimdInstructionSet instructionSet, OptimizationDirection dir, CompactMatrixView const& matrix,
+                                       std::vector<uint64_t> const& rowGroupIndices, uint64_t firstGroup, uint64_t endGroup, std::vector<double> const& vector,
+                                       std::vector<double> const* summand, std::vector<double>& result, std::vector<uint64_t>* choices, bool backward);
+
+}  // namespace detail
+}  // namespace storage
+}  // namespace storm
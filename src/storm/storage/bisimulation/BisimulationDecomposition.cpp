@@ -1,6 +1,13 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
+#include <algorithm>
 #include <chrono>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/AbortException.h"
@@ -23,6 +30,7 @@
 
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
 
@@ -60,6 +68,8 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      signatureRefinement(false),
+      numberOfThreads(1),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
@@ -223,7 +233,13 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
     this->initialize();
 
     std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-    this->performPartitionRefinement();
+    if (options.signatureRefinement && options.getType() == BisimulationType::Strong) {
+        this->performSignatureRefinement();
+    } else {
+        STORM_LOG_WARN_COND(!options.signatureRefinement,
+                            "Signature-based refinement is only available for strong bisimulation. Falling back to splitter-based refinement.");
+        this->performPartitionRefinement();
+    }
     std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
 
     std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -288,6 +304,188 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+    uint_fast64_t const numberOfStates = model.getNumberOfStates();
+    uint_fast64_t numberOfThreads =
+        options.numberOfThreads == 0 ? std::max<uint_fast64_t>(1, std::thread::hardware_concurrency()) : options.numberOfThreads;
+    if (storm::NumberTraits<ValueType>::IsExact) {
+        // Exact arithmetic is not safe to be used from several threads.
+        STORM_LOG_WARN_COND(numberOfThreads == 1 || options.numberOfThreads == 0,
+                            "Signature-based refinement uses a single thread for models with exact or parametric values.");
+        numberOfThreads = 1;
+    }
+    numberOfThreads = std::max<uint_fast64_t>(1, std::min<uint_fast64_t>(numberOfThreads, numberOfStates));
+
+    // States with the same signature are collected in a map that is split into several shards to reduce the contention between the threads.
+    // Every class of states is identified by the first state that was inserted.
+    struct SignatureClass {
+        uint_fast64_t block;
+        storm::storage::sparse::state_type representative;
+        Signature signature;
+    };
+    struct SignatureShard {
+        std::mutex mutex;
+        std::unordered_map<std::size_t, std::vector<SignatureClass>> classes;
+    };
+    uint_fast64_t const numberOfShards = 16 * numberOfThreads;
+    std::vector<SignatureShard> shards(numberOfShards);
+
+    std::vector<uint_fast64_t> stateToBlock(numberOfStates);
+    std::vector<storm::storage::sparse::state_type> stateToRepresentative(numberOfStates);
+    std::vector<storm::storage::sparse::state_type> stateToClass(numberOfStates);
+    std::vector<std::exception_ptr> exceptions(numberOfThreads);
+    uint_fast64_t const chunkSize = (numberOfStates + numberOfThreads - 1) / numberOfThreads;
+
+    auto collectSignatures = [&](uint_fast64_t thread) {
+        try {
+            Signature signature;
+            for (storm::storage::sparse::state_type state = thread * chunkSize, end = std::min(numberOfStates, (thread + 1) * chunkSize); state < end;
+                 ++state) {
+                Block<BlockDataType> const& block = partition.getBlock(state);
+                if (block.getNumberOfStates() == 1 || block.data().absorbing()) {
+                    stateToRepresentative[state] = state;
+                    continue;
+                }
+
+                // The hash only depends on the block indices, because values that are considered equal by the comparator may differ.
+                this->computeSignature(state, stateToBlock, signature);
+                std::size_t hash = stateToBlock[state];
+                for (auto const& entry : signature) {
+                    boost::hash_combine(hash, entry.first);
+                }
+
+                SignatureShard& shard = shards[hash % numberOfShards];
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                std::vector<SignatureClass>& candidates = shard.classes[hash];
+                auto classIt = std::find_if(candidates.begin(), candidates.end(), [&](SignatureClass const& candidate) {
+                    return candidate.block == stateToBlock[state] && isSignatureEqual(candidate.signature, signature);
+                });
+                if (classIt == candidates.end()) {
+                    candidates.push_back(SignatureClass{stateToBlock[state], state, signature});
+                    stateToRepresentative[state] = state;
+                } else {
+                    stateToRepresentative[state] = classIt->representative;
+                }
+            }
+        } catch (...) {
+            exceptions[thread] = std::current_exception();
+        }
+    };
+
+    uint_fast64_t iterations = 0;
+    bool partitionChanged = true;
+    while (partitionChanged) {
+        ++iterations;
+        for (storm::storage::sparse::state_type state = 0; state < numberOfStates; ++state) {
+            stateToBlock[state] = partition.getBlock(state).getId();
+        }
+        for (auto& shard : shards) {
+            shard.classes.clear();
+        }
+
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfThreads - 1);
+        for (uint_fast64_t thread = 1; thread < numberOfThreads; ++thread) {
+            threads.emplace_back(collectSignatures, thread);
+        }
+        collectSignatures(0);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        // The representatives depend on the order in which the threads processed the states. To make the resulting partition (and the
+        // numbering of its blocks) independent of that, we identify every class by its smallest state instead.
+        std::fill(stateToClass.begin(), stateToClass.end(), numberOfStates);
+        for (storm::storage::sparse::state_type state = 0; state < numberOfStates; ++state) {
+            auto& smallestState = stateToClass[stateToRepresentative[state]];
+            smallestState = std::min(smallestState, state);
+        }
+        for (storm::storage::sparse::state_type state = 0; state < numberOfStates; ++state) {
+            stateToRepresentative[state] = stateToClass[stateToRepresentative[state]];
+        }
+
+        // Finally, split all blocks that contain states of different classes.
+        partitionChanged = false;
+        std::size_t numberOfBlocks = partition.size();
+        for (uint_fast64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+            Block<BlockDataType>& block = *partition.getBlocks()[blockIndex];
+            if (block.getNumberOfStates() == 1 || block.data().absorbing()) {
+                continue;
+            }
+            storm::storage::sparse::state_type firstClass = stateToRepresentative[*partition.begin(block)];
+            if (std::all_of(partition.begin(block), partition.end(block),
+                            [&](storm::storage::sparse::state_type const& state) { return stateToRepresentative[state] == firstClass; })) {
+                continue;
+            }
+            partition.splitBlock(block, [&](storm::storage::sparse::state_type const& state1, storm::storage::sparse::state_type const& state2) {
+                return stateToRepresentative[state1] < stateToRepresentative[state2];
+            });
+            partitionChanged = true;
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " iterations of signature refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+        }
+    }
+    STORM_LOG_DEBUG("Signature refinement terminated after " << iterations << " iterations using " << numberOfThreads << " thread(s).");
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::aggregateSignatureEntries(Signature& signature, uint_fast64_t beginIndex) const {
+    std::sort(signature.begin() + beginIndex, signature.end(),
+              [](std::pair<uint_fast64_t, ValueType> const& entry1, std::pair<uint_fast64_t, ValueType> const& entry2) { return entry1.first < entry2.first; });
+
+    auto resultIt = signature.begin() + beginIndex;
+    for (auto entryIt = signature.begin() + beginIndex, entryIte = signature.end(); entryIt != entryIte;) {
+        uint_fast64_t block = entryIt->first;
+        ValueType value = entryIt->second;
+        for (++entryIt; entryIt != entryIte && entryIt->first == block; ++entryIt) {
+            value += entryIt->second;
+        }
+        if (!comparator.isZero(value)) {
+            resultIt->first = block;
+            resultIt->second = std::move(value);
+            ++resultIt;
+        }
+    }
+    signature.erase(resultIt, signature.end());
+}
+
+template<typename ModelType, typename BlockDataType>
+bool BisimulationDecomposition<ModelType, BlockDataType>::isSignatureLess(Signature const& signature1, Signature const& signature2) const {
+    for (auto it1 = signature1.begin(), it2 = signature2.begin(); it1 != signature1.end() && it2 != signature2.end(); ++it1, ++it2) {
+        if (it1->first != it2->first) {
+            return it1->first < it2->first;
+        }
+        if (comparator.isLess(it1->second, it2->second)) {
+            return true;
+        } else if (comparator.isLess(it2->second, it1->second)) {
+            return false;
+        }
+    }
+    return signature1.size() < signature2.size();
+}
+
+template<typename ModelType, typename BlockDataType>
+bool BisimulationDecomposition<ModelType, BlockDataType>::isSignatureEqual(Signature const& signature1, Signature const& signature2) const {
+    if (signature1.size() != signature2.size()) {
+        return false;
+    }
+    for (auto it1 = signature1.begin(), it2 = signature2.begin(); it1 != signature1.end(); ++it1, ++it2) {
+        if (it1->first != it2->first || !comparator.isEqual(it1->second, it2->second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
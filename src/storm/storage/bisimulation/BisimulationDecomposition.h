@@ -126,6 +126,13 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// A flag that indicates whether the partition is refined by comparing the signatures of all states (which is done by several
+        /// threads) instead of refining it with respect to one splitter at a time. This only applies to strong bisimulation.
+        bool signatureRefinement;
+
+        /// The number of threads used for the signature-based refinement. If zero, the number of threads is auto-detected.
+        uint_fast64_t numberOfThreads;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -192,6 +199,9 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
     void computeBisimulationDecomposition();
 
    protected:
+    // The signature of a state is a list of pairs of block indices and values that is sorted by the block indices.
+    typedef std::vector<std::pair<uint_fast64_t, ValueType>> Signature;
+
     /*!
      * Decomposes the given model into equivalance classes of a bisimulation.
      *
@@ -208,6 +218,37 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Performs the partition refinement by repeatedly splitting all blocks such that all states of a block have the same signature until
+     * the partition is stable. The signatures of the states are computed concurrently and collected in a map that is shared by all threads.
+     */
+    void performSignatureRefinement();
+
+    /*!
+     * Computes the signature of the given state. This may be called concurrently for different states.
+     *
+     * @param state The state whose signature to compute.
+     * @param stateToBlock The index of the block of each state.
+     * @param signature The signature is written to this object.
+     */
+    virtual void computeSignature(storm::storage::sparse::state_type state, std::vector<uint_fast64_t> const& stateToBlock, Signature& signature) const = 0;
+
+    /*!
+     * Sorts the entries of the signature starting at the given index by their block index and merges entries with the same block index. Entries
+     * whose value is zero are dropped.
+     */
+    void aggregateSignatureEntries(Signature& signature, uint_fast64_t beginIndex = 0) const;
+
+    /*!
+     * Compares two signatures lexicographically (up to the precision of the comparator).
+     */
+    bool isSignatureLess(Signature const& signature1, Signature const& signature2) const;
+
+    /*!
+     * Checks whether the two signatures are equal (up to the precision of the comparator).
+     */
+    bool isSignatureEqual(Signature const& signature1, Signature const& signature2) const;
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
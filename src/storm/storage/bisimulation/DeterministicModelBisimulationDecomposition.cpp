@@ -155,6 +155,18 @@ void DeterministicModelBisimulationDecomposition<ModelType>::initializeLabelBase
     postProcessInitialPartition();
 }
 
+template<typename ModelType>
+void DeterministicModelBisimulationDecomposition<ModelType>::computeSignature(
+    storm::storage::sparse::state_type state, std::vector<uint_fast64_t> const& stateToBlock,
+    typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const {
+    // Under strong bisimulation, the signature of a state is its distribution over the blocks.
+    signature.clear();
+    for (auto const& successorEntry : this->model.getTransitionMatrix().getRow(state)) {
+        signature.emplace_back(stateToBlock[successorEntry.getColumn()], successorEntry.getValue());
+    }
+    this->aggregateSignatureEntries(signature);
+}
+
 template<typename ModelType>
 typename DeterministicModelBisimulationDecomposition<ModelType>::ValueType const&
 DeterministicModelBisimulationDecomposition<ModelType>::getProbabilityToSplitter(storm::storage::sparse::state_type const& state) const {
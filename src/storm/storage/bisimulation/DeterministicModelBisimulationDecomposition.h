@@ -39,6 +39,9 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
     virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter,
                                                 std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
 
+    virtual void computeSignature(storm::storage::sparse::state_type state, std::vector<uint_fast64_t> const& stateToBlock,
+                                  typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const override;
+
    private:
     // Post-processes the initial partition to properly initialize it.
     void postProcessInitialPartition();
@@ -1,5 +1,8 @@
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -106,6 +109,43 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuo
               });
 }
 
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::computeSignature(
+    storm::storage::sparse::state_type state, std::vector<uint_fast64_t> const& stateToBlock,
+    typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const {
+    typedef typename BisimulationDecomposition<ModelType, BlockDataType>::Signature Signature;
+
+    // The signature of a state is the set of distributions (over the blocks) of its choices. Every distribution is terminated by an entry
+    // with the largest possible block index that carries the reward of the choice (if rewards need to be respected).
+    bool respectActionRewards = this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateActionRewards();
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    std::vector<Signature> distributions(nondeterministicChoiceIndices[state + 1] - nondeterministicChoiceIndices[state]);
+    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+        Signature& distribution = distributions[choice - nondeterministicChoiceIndices[state]];
+        for (auto const& entry : this->model.getTransitionMatrix().getRow(choice)) {
+            distribution.emplace_back(stateToBlock[entry.getColumn()], entry.getValue());
+        }
+        this->aggregateSignatureEntries(distribution);
+        distribution.emplace_back(std::numeric_limits<uint_fast64_t>::max(), respectActionRewards
+                                                                                 ? this->model.getUniqueRewardModel().getStateActionReward(choice)
+                                                                                 : storm::utility::zero<ValueType>());
+    }
+
+    // Since the signature is a set of distributions, we order the distributions and drop duplicates.
+    std::sort(distributions.begin(), distributions.end(),
+              [this](Signature const& distribution1, Signature const& distribution2) { return this->isSignatureLess(distribution1, distribution2); });
+    distributions.erase(std::unique(distributions.begin(), distributions.end(),
+                                    [this](Signature const& distribution1, Signature const& distribution2) {
+                                        return this->isSignatureEqual(distribution1, distribution2);
+                                    }),
+                        distributions.end());
+
+    signature.clear();
+    for (auto const& distribution : distributions) {
+        signature.insert(signature.end(), distribution.begin(), distribution.end());
+    }
+}
+
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
     // In order to create the quotient model, we need to construct
@@ -113,6 +153,12 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::buildQuotient()
     // (b) the new labeling,
     // (c) the new reward structures.
 
+    // The signature-based refinement does not keep the quotient distributions up-to-date, so we need to recompute them.
+    if (this->options.signatureRefinement) {
+        quotientDistributions.assign(quotientDistributions.size(), storm::storage::DistributionWithReward<ValueType>());
+        this->initializeQuotientDistributions();
+    }
+
     // Prepare a matrix builder for (a).
     storm::storage::SparseMatrixBuilder<ValueType> builder(0, this->size(), 0, false, true, this->size());
 
@@ -40,6 +40,9 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
 
     virtual void initialize() override;
 
+    virtual void computeSignature(storm::storage::sparse::state_type state, std::vector<uint_fast64_t> const& stateToBlock,
+                                  typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const override;
+
    private:
     // Creates the mapping from the choice indices to the states.
     void createChoiceToStateMapping();
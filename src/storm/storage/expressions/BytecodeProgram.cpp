@@ -0,0 +1,322 @@
+#include "storm/storage/expressions/BytecodeProgram.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * Translates expressions into instructions of a bytecode program. The result of visiting an expression is the
+ * register that holds its value.
+ */
+class BytecodeCompilationVisitor : public ExpressionVisitor {
+   public:
+    typedef BytecodeProgram::Opcode Opcode;
+
+    BytecodeCompilationVisitor(BytecodeProgram& program) : program(program) {
+        // Intentionally left empty.
+    }
+
+    uint64_t compile(BaseExpression const& expression) {
+        return boost::any_cast<uint64_t>(expression.accept(*this, boost::none));
+    }
+
+    virtual boost::any visit(IfThenElseExpression const& expression, boost::any const&) override {
+        uint64_t condition = compile(*expression.getCondition());
+        uint64_t thenRegister = compile(*expression.getThenExpression());
+        uint64_t elseRegister = compile(*expression.getElseExpression());
+        return program.addInstruction(Opcode::IfThenElse, condition, thenRegister, elseRegister);
+    }
+
+    virtual boost::any visit(BinaryBooleanFunctionExpression const& expression, boost::any const&) override {
+        uint64_t first = compile(*expression.getFirstOperand());
+        uint64_t second = compile(*expression.getSecondOperand());
+        switch (expression.getOperatorType()) {
+            case BinaryBooleanFunctionExpression::OperatorType::And:
+                return program.addInstruction(Opcode::And, first, second);
+            case BinaryBooleanFunctionExpression::OperatorType::Or:
+                return program.addInstruction(Opcode::Or, first, second);
+            case BinaryBooleanFunctionExpression::OperatorType::Xor:
+                return program.addInstruction(Opcode::Xor, first, second);
+            case BinaryBooleanFunctionExpression::OperatorType::Implies:
+                return program.addInstruction(Opcode::Implies, first, second);
+            case BinaryBooleanFunctionExpression::OperatorType::Iff:
+                return program.addInstruction(Opcode::Iff, first, second);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown boolean operator in expression " << expression << ".");
+    }
+
+    virtual boost::any visit(BinaryNumericalFunctionExpression const& expression, boost::any const&) override {
+        uint64_t first = compile(*expression.getFirstOperand());
+        uint64_t second = compile(*expression.getSecondOperand());
+        switch (expression.getOperatorType()) {
+            case BinaryNumericalFunctionExpression::OperatorType::Plus:
+                return program.addInstruction(Opcode::Plus, first, second);
+            case BinaryNumericalFunctionExpression::OperatorType::Minus:
+                return program.addInstruction(Opcode::Minus, first, second);
+            case BinaryNumericalFunctionExpression::OperatorType::Times:
+                return program.addInstruction(Opcode::Times, first, second);
+            case BinaryNumericalFunctionExpression::OperatorType::Divide:
+                return program.addInstruction(Opcode::Divide, first, second);
+            case BinaryNumericalFunctionExpression::OperatorType::Min:
+                return program.addInstruction(Opcode::Min, first, second);
+            case BinaryNumericalFunctionExpression::OperatorType::Max:
+                return program.addInstruction(Opcode::Max, first, second);
+            case BinaryNumericalFunctionExpression::OperatorType::Power:
+                return program.addInstruction(Opcode::Power, first, second);
+            case BinaryNumericalFunctionExpression::OperatorType::Modulo:
+                return program.addInstruction(Opcode::Modulo, first, second);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown numerical operator in expression " << expression << ".");
+    }
+
+    virtual boost::any visit(BinaryRelationExpression const& expression, boost::any const&) override {
+        uint64_t first = compile(*expression.getFirstOperand());
+        uint64_t second = compile(*expression.getSecondOperand());
+        switch (expression.getRelationType()) {
+            case RelationType::Equal:
+                return program.addInstruction(Opcode::Equal, first, second);
+            case RelationType::NotEqual:
+                return program.addInstruction(Opcode::NotEqual, first, second);
+            case RelationType::Less:
+                return program.addInstruction(Opcode::Less, first, second);
+            case RelationType::LessOrEqual:
+                return program.addInstruction(Opcode::LessOrEqual, first, second);
+            case RelationType::Greater:
+                return program.addInstruction(Opcode::Greater, first, second);
+            case RelationType::GreaterOrEqual:
+                return program.addInstruction(Opcode::GreaterOrEqual, first, second);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown relation in expression " << expression << ".");
+    }
+
+    virtual boost::any visit(VariableExpression const& expression, boost::any const&) override {
+        uint64_t location = program.getLocationIndex(expression.getVariable());
+        return program.addInstruction(program.locations[location].isBoolean ? Opcode::LoadBoolean : Opcode::LoadInteger, location);
+    }
+
+    virtual boost::any visit(UnaryBooleanFunctionExpression const& expression, boost::any const&) override {
+        uint64_t operand = compile(*expression.getOperand());
+        return program.addInstruction(Opcode::Not, operand);
+    }
+
+    virtual boost::any visit(UnaryNumericalFunctionExpression const& expression, boost::any const&) override {
+        uint64_t operand = compile(*expression.getOperand());
+        switch (expression.getOperatorType()) {
+            case UnaryNumericalFunctionExpression::OperatorType::Minus:
+                return program.addInstruction(Opcode::Negate, operand);
+            case UnaryNumericalFunctionExpression::OperatorType::Floor:
+                return program.addInstruction(Opcode::Floor, operand);
+            case UnaryNumericalFunctionExpression::OperatorType::Ceil:
+                return program.addInstruction(Opcode::Ceil, operand);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown numerical operator in expression " << expression << ".");
+    }
+
+    virtual boost::any visit(BooleanLiteralExpression const& expression, boost::any const&) override {
+        return program.addInstruction(Opcode::Constant, program.getConstantIndex(expression.getValue() ? 1.0 : 0.0));
+    }
+
+    virtual boost::any visit(IntegerLiteralExpression const& expression, boost::any const&) override {
+        return program.addInstruction(Opcode::Constant, program.getConstantIndex(static_cast<double>(expression.getValue())));
+    }
+
+    virtual boost::any visit(RationalLiteralExpression const& expression, boost::any const&) override {
+        return program.addInstruction(Opcode::Constant, program.getConstantIndex(expression.getValueAsDouble()));
+    }
+
+    virtual boost::any visit(PredicateExpression const& expression, boost::any const&) override {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Predicate expressions are not supported by the bytecode (in " << expression << ").");
+    }
+
+   private:
+    BytecodeProgram& program;
+};
+
+BytecodeProgram::BytecodeProgram(std::unordered_map<storm::expressions::Variable, BitVectorVariableLocation> const& variableLocations)
+    : variableLocations(variableLocations) {
+    // Intentionally left empty.
+}
+
+uint64_t BytecodeProgram::beginBlock() {
+    blocks.emplace_back(instructions.size(), instructions.size());
+    instructionsOfCurrentBlock.clear();
+    return blocks.size() - 1;
+}
+
+uint64_t BytecodeProgram::addExpression(storm::expressions::Expression const& expression) {
+    STORM_LOG_THROW(!blocks.empty(), storm::exceptions::InvalidArgumentException, "Cannot add an expression before starting a block.");
+    BytecodeCompilationVisitor visitor(*this);
+    return visitor.compile(*expression.getBaseExpressionPointer());
+}
+
+uint64_t BytecodeProgram::addInstruction(Opcode opcode, uint64_t first, uint64_t second, uint64_t third) {
+    auto key = std::make_tuple(opcode, first, second, third);
+    auto it = instructionsOfCurrentBlock.find(key);
+    if (it != instructionsOfCurrentBlock.end()) {
+        return it->second;
+    }
+
+    STORM_LOG_THROW(instructions.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException,
+                    "Too many instructions for the bytecode.");
+    uint64_t reg = instructions.size();
+    instructions.push_back({opcode, static_cast<uint32_t>(first), static_cast<uint32_t>(second), static_cast<uint32_t>(third)});
+    registers.push_back(0.0);
+    blocks.back().second = instructions.size();
+    instructionsOfCurrentBlock.emplace(key, reg);
+    return reg;
+}
+
+uint64_t BytecodeProgram::getConstantIndex(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(double));
+    auto it = constantIndices.find(bits);
+    if (it != constantIndices.end()) {
+        return it->second;
+    }
+    constants.push_back(value);
+    constantIndices.emplace(bits, constants.size() - 1);
+    return constants.size() - 1;
+}
+
+uint64_t BytecodeProgram::getLocationIndex(storm::expressions::Variable const& variable) {
+    auto it = locationIndices.find(variable);
+    if (it != locationIndices.end()) {
+        return it->second;
+    }
+    auto locationIt = variableLocations.find(variable);
+    STORM_LOG_THROW(locationIt != variableLocations.end(), storm::exceptions::NotSupportedException,
+                    "The variable '" << variable.getName() << "' is not stored in the bit vector.");
+    locations.push_back(locationIt->second);
+    locationIndices.emplace(variable, locations.size() - 1);
+    return locations.size() - 1;
+}
+
+void BytecodeProgram::evaluateBlock(uint64_t block, storm::storage::BitVector const& values) const {
+    double* r = registers.data();
+    auto const& range = blocks[block];
+    for (uint64_t index = range.first; index < range.second; ++index) {
+        Instruction const& instruction = instructions[index];
+        // The operands are read upfront. For constants and loads, the first operand is not a register and the values
+        // are unused, but the read stays within bounds as there are at most as many constants and locations as
+        // instructions.
+        double a = r[instruction.first];
+        double b = r[instruction.second];
+        switch (instruction.opcode) {
+            case Opcode::Constant:
+                r[index] = constants[instruction.first];
+                break;
+            case Opcode::LoadBoolean:
+                r[index] = values.get(locations[instruction.first].bitOffset) ? 1.0 : 0.0;
+                break;
+            case Opcode::LoadInteger: {
+                BitVectorVariableLocation const& location = locations[instruction.first];
+                int64_t value = location.lowerBound;
+                if (location.bitWidth > 0) {
+                    value += static_cast<int64_t>(values.getAsInt(location.bitOffset, location.bitWidth));
+                }
+                r[index] = static_cast<double>(value);
+                break;
+            }
+            case Opcode::Not:
+                r[index] = a == 0.0 ? 1.0 : 0.0;
+                break;
+            case Opcode::And:
+                r[index] = (a != 0.0 && b != 0.0) ? 1.0 : 0.0;
+                break;
+            case Opcode::Or:
+                r[index] = (a != 0.0 || b != 0.0) ? 1.0 : 0.0;
+                break;
+            case Opcode::Xor:
+                r[index] = ((a != 0.0) != (b != 0.0)) ? 1.0 : 0.0;
+                break;
+            case Opcode::Implies:
+                r[index] = (a == 0.0 || b != 0.0) ? 1.0 : 0.0;
+                break;
+            case Opcode::Iff:
+                r[index] = ((a != 0.0) == (b != 0.0)) ? 1.0 : 0.0;
+                break;
+            case Opcode::Negate:
+                r[index] = -a;
+                break;
+            case Opcode::Floor:
+                r[index] = std::floor(a);
+                break;
+            case Opcode::Ceil:
+                r[index] = std::ceil(a);
+                break;
+            case Opcode::Plus:
+                r[index] = a + b;
+                break;
+            case Opcode::Minus:
+                r[index] = a - b;
+                break;
+            case Opcode::Times:
+                r[index] = a * b;
+                break;
+            case Opcode::Divide:
+                r[index] = a / b;
+                break;
+            case Opcode::Min:
+                r[index] = std::min(a, b);
+                break;
+            case Opcode::Max:
+                r[index] = std::max(a, b);
+                break;
+            case Opcode::Power:
+                r[index] = std::pow(a, b);
+                break;
+            case Opcode::Modulo:
+                r[index] = std::fmod(a, b);
+                break;
+            case Opcode::Equal:
+                r[index] = a == b ? 1.0 : 0.0;
+                break;
+            case Opcode::NotEqual:
+                r[index] = a != b ? 1.0 : 0.0;
+                break;
+            case Opcode::Less:
+                r[index] = a < b ? 1.0 : 0.0;
+                break;
+            case Opcode::LessOrEqual:
+                r[index] = a <= b ? 1.0 : 0.0;
+                break;
+            case Opcode::Greater:
+                r[index] = a > b ? 1.0 : 0.0;
+                break;
+            case Opcode::GreaterOrEqual:
+                r[index] = a >= b ? 1.0 : 0.0;
+                break;
+            case Opcode::IfThenElse:
+                r[index] = a != 0.0 ? b : r[instruction.third];
+                break;
+        }
+    }
+}
+
+bool BytecodeProgram::getBooleanValue(uint64_t reg) const {
+    return registers[reg] == 1.0;
+}
+
+int64_t BytecodeProgram::getIntegerValue(uint64_t reg) const {
+    return static_cast<int64_t>(registers[reg]);
+}
+
+double BytecodeProgram::getDoubleValue(uint64_t reg) const {
+    return registers[reg];
+}
+
+uint64_t BytecodeProgram::getNumberOfInstructions() const {
+    return instructions.size();
+}
+
+}  // namespace expressions
+}  // namespace storm
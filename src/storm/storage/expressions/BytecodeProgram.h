@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+
+/*!
+ * Describes where the value of a variable is stored in a bit vector. Boolean variables occupy a single bit, integer
+ * variables are stored with the given bit width as offset from their lower bound.
+ */
+struct BitVectorVariableLocation {
+    bool isBoolean;
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+    int64_t lowerBound;
+};
+
+/*!
+ * A compact register-based bytecode for expressions over variables whose values are stored in a bit vector.
+ * Expressions are compiled into blocks. All expressions of a block are evaluated in a single pass over its
+ * instructions, where common subexpressions (in particular the loads of variables) are shared. The semantics follow
+ * the floating point evaluation of ExpressionEvaluator<double>: all values are kept as doubles, boolean values are
+ * represented as zero and one.
+ */
+class BytecodeProgram {
+   public:
+    /*!
+     * Creates an empty program.
+     *
+     * @param variableLocations The locations of all variables that may appear in the compiled expressions.
+     */
+    BytecodeProgram(std::unordered_map<storm::expressions::Variable, BitVectorVariableLocation> const& variableLocations);
+
+    /*!
+     * Starts a new block. Subsequently added expressions belong to this block.
+     *
+     * @return The index of the new block.
+     */
+    uint64_t beginBlock();
+
+    /*!
+     * Compiles the given expression into the current block. Throws NotSupportedException if the expression contains
+     * operators or variables that can not be compiled.
+     *
+     * @return The register that holds the value of the expression after evaluating the block.
+     */
+    uint64_t addExpression(storm::expressions::Expression const& expression);
+
+    /*!
+     * Evaluates the given block using the variable values stored in the given bit vector.
+     */
+    void evaluateBlock(uint64_t block, storm::storage::BitVector const& values) const;
+
+    /*!
+     * Retrieves the value of the given register as a boolean (from the last evaluation of its block).
+     */
+    bool getBooleanValue(uint64_t reg) const;
+
+    /*!
+     * Retrieves the value of the given register as an integer (from the last evaluation of its block).
+     */
+    int64_t getIntegerValue(uint64_t reg) const;
+
+    /*!
+     * Retrieves the value of the given register as a double (from the last evaluation of its block).
+     */
+    double getDoubleValue(uint64_t reg) const;
+
+    /*!
+     * Retrieves the total number of instructions of this program.
+     */
+    uint64_t getNumberOfInstructions() const;
+
+   private:
+    friend class BytecodeCompilationVisitor;
+
+    enum class Opcode : uint8_t {
+        Constant,
+        LoadBoolean,
+        LoadInteger,
+        Not,
+        And,
+        Or,
+        Xor,
+        Implies,
+        Iff,
+        Negate,
+        Floor,
+        Ceil,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Min,
+        Max,
+        Power,
+        Modulo,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        IfThenElse
+    };
+
+    /*!
+     * Adds an instruction to the current block unless the block already computes the same value.
+     *
+     * @return The register holding the result of the instruction. Registers coincide with instruction indices.
+     */
+    uint64_t addInstruction(Opcode opcode, uint64_t first = 0, uint64_t second = 0, uint64_t third = 0);
+
+    /*!
+     * Retrieves the index of the given constant in the constant pool.
+     */
+    uint64_t getConstantIndex(double value);
+
+    /*!
+     * Retrieves the index of the location of the given variable. Throws NotSupportedException if the location of
+     * the variable is unknown.
+     */
+    uint64_t getLocationIndex(storm::expressions::Variable const& variable);
+
+    struct Instruction {
+        Opcode opcode;
+        uint32_t first;
+        uint32_t second;
+        uint32_t third;
+    };
+
+    // The locations of the variables that may be loaded.
+    std::unordered_map<storm::expressions::Variable, BitVectorVariableLocation> variableLocations;
+
+    // The instructions of all blocks.
+    std::vector<Instruction> instructions;
+
+    // For each block, the index of its first instruction and the index after its last instruction.
+    std::vector<std::pair<uint64_t, uint64_t>> blocks;
+
+    // The constant pool.
+    std::vector<double> constants;
+
+    // The index of each constant in the pool, keyed by its bit pattern.
+    std::unordered_map<uint64_t, uint64_t> constantIndices;
+
+    // The locations of the variables that are loaded by some instruction.
+    std::vector<BitVectorVariableLocation> locations;
+    std::unordered_map<storm::expressions::Variable, uint64_t> locationIndices;
+
+    // The instructions of the current block (used to share common subexpressions).
+    std::map<std::tuple<Opcode, uint64_t, uint64_t, uint64_t>, uint64_t> instructionsOfCurrentBlock;
+
+    // The value of each register. Since evaluation does not change the program, the registers are mutable.
+    mutable std::vector<double> registers;
+};
+
+}  // namespace expressions
+}  // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/storage/expressions/ToCppVisitor.h"
 
+#include <iomanip>
+#include <limits>
+
 #include "storm/storage/expressions/Expressions.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -29,6 +32,8 @@ ToCppTranslationMode const& ToCppTranslationOptions::getMode() const {
 }
 
 std::string ToCppVisitor::translate(storm::expressions::Expression const& expression, ToCppTranslationOptions const& options) {
+    // Make sure that double literals are written without loss of precision.
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
     expression.accept(*this, options);
     std::string result = stream.str();
     stream.str("");
@@ -38,8 +43,10 @@ std::string ToCppVisitor::translate(storm::expressions::Expression const& expres
 boost::any ToCppVisitor::visit(IfThenElseExpression const& expression, boost::any const& data) {
     ToCppTranslationOptions const& options = boost::any_cast<ToCppTranslationOptions>(data);
 
-    // Clear the type cast for the condition.
-    ToCppTranslationOptions conditionOptions(options.getPrefixes(), options.getNames());
+    // Clear the type cast for the condition (unless everything is evaluated as doubles).
+    ToCppTranslationOptions conditionOptions(options.getPrefixes(), options.getNames(),
+                                             options.getMode() == ToCppTranslationMode::CastDouble ? ToCppTranslationMode::CastDouble
+                                                                                                   : ToCppTranslationMode::KeepType);
     stream << "(";
     expression.getCondition()->accept(*this, conditionOptions);
     stream << " ? ";
@@ -145,11 +152,19 @@ boost::any ToCppVisitor::visit(BinaryNumericalFunctionExpression const& expressi
             stream << ")";
             break;
         case BinaryNumericalFunctionExpression::OperatorType::Modulo:
-            stream << "(";
-            expression.getFirstOperand()->accept(*this, data);
-            stream << " % ";
-            expression.getSecondOperand()->accept(*this, data);
-            stream << ")";
+            if (boost::any_cast<ToCppTranslationOptions const&>(data).getMode() == ToCppTranslationMode::CastDouble) {
+                stream << "std::fmod(";
+                expression.getFirstOperand()->accept(*this, data);
+                stream << ", ";
+                expression.getSecondOperand()->accept(*this, data);
+                stream << ")";
+            } else {
+                stream << "(";
+                expression.getFirstOperand()->accept(*this, data);
+                stream << " % ";
+                expression.getSecondOperand()->accept(*this, data);
+                stream << ")";
+            }
             break;
     }
     return boost::none;
@@ -13,7 +13,18 @@ namespace transformer {
 class DAProductBuilder {
    public:
     DAProductBuilder(const storm::automata::DeterministicAutomaton& da, const std::vector<storm::storage::BitVector>& statesForAP)
-        : da(da), statesForAP(statesForAP) {}
+        : da(da), labelForAllFalse(da.getAPSet().elementAllFalse()) {
+        // Compute the label of each model state once such that looking up successors during the product construction does not need to consult
+        // the sets of all atomic propositions again for every transition.
+        if (!statesForAP.empty()) {
+            labelForState.resize(statesForAP.front().size(), labelForAllFalse);
+            for (unsigned int ap = 0; ap < statesForAP.size(); ap++) {
+                for (auto state : statesForAP[ap]) {
+                    labelForState[state] = da.getAPSet().elementAddAP(labelForState[state], ap);
+                }
+            }
+        }
+    }
 
     template<typename Model>
     typename DAProduct<Model>::ptr build(const Model& originalModel, const storm::storage::BitVector& statesOfInterest) const {
@@ -30,6 +41,10 @@ class DAProductBuilder {
         return typename DAProduct<Model>::ptr(new DAProduct<Model>(std::move(*product), prodAcceptance));
     }
 
+    storm::automata::DeterministicAutomaton const& getAutomaton() const {
+        return da;
+    }
+
     storm::storage::sparse::state_type getInitialState(storm::storage::sparse::state_type modelState) const {
         return da.getSuccessor(da.getInitialState(), getLabelForState(modelState));
     }
@@ -40,16 +55,11 @@ class DAProductBuilder {
 
    private:
     const storm::automata::DeterministicAutomaton& da;
-    const std::vector<storm::storage::BitVector>& statesForAP;
+    storm::automata::APSet::alphabet_element labelForAllFalse;
+    std::vector<storm::automata::APSet::alphabet_element> labelForState;
 
     storm::automata::APSet::alphabet_element getLabelForState(storm::storage::sparse::state_type s) const {
-        storm::automata::APSet::alphabet_element label = da.getAPSet().elementAllFalse();
-        for (unsigned int ap = 0; ap < da.getAPSet().size(); ap++) {
-            if (statesForAP.at(ap).get(s)) {
-                label = da.getAPSet().elementAddAP(label, ap);
-            }
-        }
-        return label;
+        return labelForState.empty() ? labelForAllFalse : labelForState[s];
     }
 };
 }  // namespace transformer
@@ -0,0 +1,407 @@
+#pragma once
+
+#include "storm/automata/AcceptanceCondition.h"
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StateBlock.h"
+#include "storm/transformer/DAProductBuilder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include <algorithm>
+#include <boost/functional/hash.hpp>
+#include <boost/optional.hpp>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace storm {
+namespace transformer {
+
+/*!
+ * The product of a model with a deterministic automaton that does not materialize the product transition matrix.
+ *
+ * Only the product states that are reachable from the states of interest are explored. The choices of a product state are the rows of its model
+ * state and the successors of a choice are obtained on the fly by lifting the successors in the original matrix along the automaton. Hence, the
+ * memory footprint is linear in the number of product states, independent of the number of transitions.
+ *
+ * The product keeps references to the original matrix and the product builder, both have to outlive it.
+ */
+template<typename ValueType>
+class ImplicitDAProduct {
+   public:
+    typedef storm::storage::sparse::state_type state_type;
+    typedef std::pair<state_type, state_type> product_state_type;
+    typedef std::unordered_map<product_state_type, state_type, boost::hash<product_state_type>> product_state_to_product_index_map;
+
+    /*!
+     * Explores the product states that are reachable from the given states of interest.
+     *
+     * @param originalMatrix The transition matrix of the model.
+     * @param productBuilder The builder providing the automaton and the labels of the model states.
+     * @param statesOfInterest The model states from which the product is explored.
+     */
+    ImplicitDAProduct(storm::storage::SparseMatrix<ValueType> const& originalMatrix, DAProductBuilder const& productBuilder,
+                      storm::storage::BitVector const& statesOfInterest)
+        : originalMatrix(originalMatrix), productBuilder(productBuilder) {
+        std::deque<state_type> todo;
+        auto getOrAddProductState = [&](product_state_type const& productState) {
+            auto insertionResult = productStateToProductIndex.emplace(productState, productIndexToProductState.size());
+            if (insertionResult.second) {
+                todo.push_back(productIndexToProductState.size());
+                productIndexToProductState.push_back(productState);
+            }
+            return insertionResult.first->second;
+        };
+
+        for (state_type modelState : statesOfInterest) {
+            initialStates.emplace_back(modelState, getOrAddProductState(product_state_type(modelState, productBuilder.getInitialState(modelState))));
+        }
+
+        auto const& modelRowGroupIndices = originalMatrix.getRowGroupIndices();
+        while (!todo.empty()) {
+            product_state_type from = productIndexToProductState[todo.front()];
+            todo.pop_front();
+            for (auto const& entry : originalMatrix.getRowGroup(from.first)) {
+                getOrAddProductState(product_state_type(entry.getColumn(), productBuilder.getSuccessor(from.second, entry.getColumn())));
+            }
+        }
+
+        // The choices of the product states are numbered consecutively in the order of the product states.
+        rowGroupIndices.reserve(productIndexToProductState.size() + 1);
+        rowGroupIndices.push_back(0);
+        for (auto const& productState : productIndexToProductState) {
+            state_type modelState = productState.first;
+            rowGroupIndices.push_back(rowGroupIndices.back() + modelRowGroupIndices[modelState + 1] - modelRowGroupIndices[modelState]);
+        }
+
+        acceptance = productBuilder.getAutomaton().getAcceptance()->lift(
+            getNumberOfStates(), [this](std::size_t productState) { return productIndexToProductState[productState].second; });
+    }
+
+    state_type getNumberOfStates() const {
+        return productIndexToProductState.size();
+    }
+
+    uint64_t getNumberOfChoices() const {
+        return rowGroupIndices.back();
+    }
+
+    /*!
+     * Retrieves the indices of the first choice of each product state. The last entry is the number of choices.
+     */
+    std::vector<uint64_t> const& getRowGroupIndices() const {
+        return rowGroupIndices;
+    }
+
+    state_type getModelState(state_type productState) const {
+        return productIndexToProductState[productState].first;
+    }
+
+    state_type getAutomatonState(state_type productState) const {
+        return productIndexToProductState[productState].second;
+    }
+
+    /*!
+     * Retrieves the product state in which the product is entered from each of the states of interest.
+     *
+     * @return pairs of a model state of interest and the corresponding initial product state
+     */
+    std::vector<std::pair<state_type, state_type>> const& getInitialStates() const {
+        return initialStates;
+    }
+
+    /*!
+     * Retrieves the acceptance condition of the automaton, lifted to the product states.
+     */
+    storm::automata::AcceptanceCondition::ptr getAcceptance() const {
+        return acceptance;
+    }
+
+    /*!
+     * Calls the given function with the successor and the probability of each transition of the given choice of the given product state.
+     */
+    template<typename CallbackType>
+    void forEachSuccessor(state_type productState, uint64_t choice, CallbackType&& callback) const {
+        STORM_LOG_ASSERT(choice >= rowGroupIndices[productState] && choice < rowGroupIndices[productState + 1], "Choice does not belong to the state.");
+        product_state_type const& from = productIndexToProductState[productState];
+        for (auto const& entry : originalMatrix.getRow(from.first, choice - rowGroupIndices[productState])) {
+            callback(getSuccessor(from.second, entry.getColumn()), entry.getValue());
+        }
+    }
+
+    /*!
+     * Computes the SCCs of the product restricted to the given states and choices, using an iterative version of Tarjan's algorithm.
+     *
+     * @param subsystem The states to consider. Transitions leaving these states are ignored.
+     * @param choices The choices to consider.
+     * @return The SCCs in reverse topological order, i.e., every SCC is preceded by all SCCs that are reachable from it.
+     */
+    std::vector<storm::storage::StateBlock> computeSccs(storm::storage::BitVector const& subsystem, storm::storage::BitVector const& choices) const {
+        state_type const unvisited = std::numeric_limits<state_type>::max();
+        std::vector<state_type> preorder(getNumberOfStates(), unvisited);
+        std::vector<state_type> lowlink(getNumberOfStates());
+        storm::storage::BitVector onStack(getNumberOfStates());
+        std::vector<state_type> sccStack;
+        std::vector<storm::storage::StateBlock> result;
+
+        // A frame of the depth first search stores the state and the next transition (choice and entry offset) to explore.
+        struct Frame {
+            state_type state;
+            uint64_t choice;
+            uint64_t entry;
+        };
+        std::vector<Frame> callStack;
+        state_type nextPreorder = 0;
+        auto visit = [&](state_type state) {
+            preorder[state] = lowlink[state] = nextPreorder++;
+            sccStack.push_back(state);
+            onStack.set(state);
+            callStack.push_back({state, rowGroupIndices[state], 0});
+        };
+
+        for (state_type root : subsystem) {
+            if (preorder[root] != unvisited) {
+                continue;
+            }
+            visit(root);
+            while (!callStack.empty()) {
+                state_type state = callStack.back().state;
+                product_state_type const& from = productIndexToProductState[state];
+                boost::optional<state_type> unvisitedSuccessor;
+                while (!unvisitedSuccessor && callStack.back().choice < rowGroupIndices[state + 1]) {
+                    Frame& frame = callStack.back();
+                    auto row = originalMatrix.getRow(from.first, frame.choice - rowGroupIndices[state]);
+                    if (!choices.get(frame.choice) || frame.entry >= row.getNumberOfEntries()) {
+                        ++frame.choice;
+                        frame.entry = 0;
+                        continue;
+                    }
+                    state_type successor = getSuccessor(from.second, (row.begin() + frame.entry)->getColumn());
+                    ++frame.entry;
+                    if (!subsystem.get(successor)) {
+                        continue;
+                    }
+                    if (preorder[successor] == unvisited) {
+                        unvisitedSuccessor = successor;
+                    } else if (onStack.get(successor)) {
+                        lowlink[state] = std::min(lowlink[state], preorder[successor]);
+                    }
+                }
+                if (unvisitedSuccessor) {
+                    visit(*unvisitedSuccessor);
+                    continue;
+                }
+
+                // All transitions of the state are explored.
+                callStack.pop_back();
+                if (lowlink[state] == preorder[state]) {
+                    std::vector<state_type> sccStates;
+                    state_type sccState;
+                    do {
+                        sccState = sccStack.back();
+                        sccStack.pop_back();
+                        onStack.set(sccState, false);
+                        sccStates.push_back(sccState);
+                    } while (sccState != state);
+                    std::sort(sccStates.begin(), sccStates.end());
+                    result.emplace_back(sccStates.begin(), sccStates.end(), true);
+                }
+                if (!callStack.empty()) {
+                    state_type parent = callStack.back().state;
+                    lowlink[parent] = std::min(lowlink[parent], lowlink[state]);
+                }
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Computes the bottom SCCs of the product. SCCs consisting of a single state without a self-loop are not considered.
+     */
+    std::vector<storm::storage::StateBlock> computeBottomSccs() const {
+        std::vector<storm::storage::StateBlock> sccs = computeSccs(storm::storage::BitVector(getNumberOfStates(), true),
+                                                                   storm::storage::BitVector(getNumberOfChoices(), true));
+        std::vector<storm::storage::StateBlock> result;
+        storm::storage::BitVector sccStates(getNumberOfStates());
+        for (auto& scc : sccs) {
+            for (auto state : scc) {
+                sccStates.set(state);
+            }
+            bool isBottom = true;
+            bool hasTransitionWithinScc = false;
+            for (auto state : scc) {
+                for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                    forEachSuccessor(state, choice, [&](state_type successor, ValueType const&) {
+                        if (sccStates.get(successor)) {
+                            hasTransitionWithinScc = true;
+                        } else {
+                            isBottom = false;
+                        }
+                    });
+                }
+            }
+            for (auto state : scc) {
+                sccStates.set(state, false);
+            }
+            if (isBottom && hasTransitionWithinScc) {
+                result.push_back(std::move(scc));
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Computes the maximal end components of the product restricted to the given states.
+     *
+     * The SCCs of the states and the choices that stay within the states are computed repeatedly. After each decomposition, the choices that
+     * leave their SCC are removed, as are the states without remaining choices, until no more choices are removed.
+     *
+     * @return The states of each maximal end component.
+     */
+    std::vector<storm::storage::StateBlock> computeMaximalEndComponents(storm::storage::BitVector const& subsystem) const {
+        storm::storage::BitVector remainingStates(subsystem);
+        storm::storage::BitVector remainingChoices(getNumberOfChoices(), false);
+        for (auto state : subsystem) {
+            for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                remainingChoices.set(choice);
+            }
+        }
+
+        std::vector<uint64_t> stateToScc(getNumberOfStates());
+        while (true) {
+            std::vector<storm::storage::StateBlock> sccs = computeSccs(remainingStates, remainingChoices);
+            for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+                for (auto state : sccs[sccIndex]) {
+                    stateToScc[state] = sccIndex;
+                }
+            }
+
+            bool changed = false;
+            for (auto state : storm::storage::BitVector(remainingStates)) {
+                bool hasRemainingChoice = false;
+                for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                    if (!remainingChoices.get(choice)) {
+                        continue;
+                    }
+                    bool staysInScc = true;
+                    forEachSuccessor(state, choice, [&](state_type successor, ValueType const&) {
+                        staysInScc &= remainingStates.get(successor) && stateToScc[successor] == stateToScc[state];
+                    });
+                    if (staysInScc) {
+                        hasRemainingChoice = true;
+                    } else {
+                        remainingChoices.set(choice, false);
+                        changed = true;
+                    }
+                }
+                if (!hasRemainingChoice) {
+                    remainingStates.set(state, false);
+                    changed = true;
+                }
+            }
+
+            if (!changed) {
+                return sccs;
+            }
+        }
+    }
+
+    /*!
+     * Computes the states from which a state in the given set is reachable with positive probability under some choice resolution.
+     */
+    storm::storage::BitVector computeStatesReaching(storm::storage::BitVector const& targetStates) const {
+        // The SCCs are processed such that the successors of an SCC are decided before the SCC itself.
+        storm::storage::BitVector result(targetStates);
+        for (auto const& scc : computeSccs(storm::storage::BitVector(getNumberOfStates(), true), storm::storage::BitVector(getNumberOfChoices(), true))) {
+            bool reaches = false;
+            for (auto state : scc) {
+                reaches |= result.get(state);
+                for (uint64_t choice = rowGroupIndices[state]; !reaches && choice < rowGroupIndices[state + 1]; ++choice) {
+                    forEachSuccessor(state, choice, [&](state_type successor, ValueType const&) { reaches |= result.get(successor); });
+                }
+                if (reaches) {
+                    break;
+                }
+            }
+            if (reaches) {
+                for (auto state : scc) {
+                    result.set(state);
+                }
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Materializes the choices of the given product states. All other states are represented by two absorbing states: the first one collects the
+     * probability of moving to one of the given target states and the second one the probability of moving to any other state outside of the
+     * given states. The given states keep their relative order and are followed by the two absorbing states.
+     *
+     * @param states The states whose choices are materialized. Must not contain target states.
+     * @param targetStates The states that are merged into the first absorbing state.
+     */
+    storm::storage::SparseMatrix<ValueType> buildSubsystemMatrix(storm::storage::BitVector const& states, storm::storage::BitVector const& targetStates) const {
+        STORM_LOG_ASSERT(states.isDisjointFrom(targetStates), "The materialized states must not contain target states.");
+        std::vector<uint64_t> stateToSubsystemState = states.getNumberOfSetBitsBeforeIndices();
+        uint64_t targetState = states.getNumberOfSetBits();
+        uint64_t sinkState = targetState + 1;
+
+        bool deterministic = originalMatrix.hasTrivialRowGrouping();
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, sinkState + 1, 0, false, !deterministic, 0);
+        uint64_t row = 0;
+        for (auto state : states) {
+            if (!deterministic) {
+                builder.newRowGroup(row);
+            }
+            for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                ValueType targetProbability = storm::utility::zero<ValueType>();
+                ValueType sinkProbability = storm::utility::zero<ValueType>();
+                forEachSuccessor(state, choice, [&](state_type successor, ValueType const& value) {
+                    if (states.get(successor)) {
+                        builder.addNextValue(row, stateToSubsystemState[successor], value);
+                    } else if (targetStates.get(successor)) {
+                        targetProbability += value;
+                    } else {
+                        sinkProbability += value;
+                    }
+                });
+                if (!storm::utility::isZero(targetProbability)) {
+                    builder.addNextValue(row, targetState, targetProbability);
+                }
+                if (!storm::utility::isZero(sinkProbability)) {
+                    builder.addNextValue(row, sinkState, sinkProbability);
+                }
+                ++row;
+            }
+        }
+        for (uint64_t absorbingState : {targetState, sinkState}) {
+            if (!deterministic) {
+                builder.newRowGroup(row);
+            }
+            builder.addNextValue(row, absorbingState, storm::utility::one<ValueType>());
+            ++row;
+        }
+        return builder.build();
+    }
+
+   private:
+    state_type getSuccessor(state_type automatonFrom, state_type modelTo) const {
+        auto it = productStateToProductIndex.find(product_state_type(modelTo, productBuilder.getSuccessor(automatonFrom, modelTo)));
+        STORM_LOG_ASSERT(it != productStateToProductIndex.end(), "Successor of an explored product state was not explored.");
+        return it->second;
+    }
+
+    storm::storage::SparseMatrix<ValueType> const& originalMatrix;
+    DAProductBuilder const& productBuilder;
+
+    product_state_to_product_index_map productStateToProductIndex;
+    std::vector<product_state_type> productIndexToProductState;
+    std::vector<uint64_t> rowGroupIndices;
+    std::vector<std::pair<state_type, state_type>> initialStates;
+    storm::automata::AcceptanceCondition::ptr acceptance;
+};
+}  // namespace transformer
+}  // namespace storm
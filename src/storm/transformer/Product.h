@@ -1,6 +1,9 @@
 #pragma once
 
+#include <boost/functional/hash.hpp>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace storm {
 namespace transformer {
@@ -11,15 +14,15 @@ class Product {
 
     typedef storm::storage::sparse::state_type state_type;
     typedef std::pair<state_type, state_type> product_state_type;
-    typedef std::map<product_state_type, state_type> product_state_to_product_index_map;
+    typedef std::unordered_map<product_state_type, state_type, boost::hash<product_state_type>> product_state_to_product_index_map;
     typedef std::vector<product_state_type> product_index_to_product_state_vector;
 
     Product(Model&& productModel, std::string&& productStateOfInterestLabel, product_state_to_product_index_map&& productStateToProductIndex,
             product_index_to_product_state_vector&& productIndexToProductState)
-        : productModel(productModel),
-          productStateOfInterestLabel(productStateOfInterestLabel),
-          productStateToProductIndex(productStateToProductIndex),
-          productIndexToProductState(productIndexToProductState) {}
+        : productModel(std::move(productModel)),
+          productStateOfInterestLabel(std::move(productStateOfInterestLabel)),
+          productStateToProductIndex(std::move(productStateToProductIndex)),
+          productIndexToProductState(std::move(productIndexToProductState)) {}
 
     Product(Product<Model>&& product) = default;
     Product& operator=(Product<Model>&& product) = default;
@@ -5,7 +5,6 @@
 #include "storm/storage/SparseMatrix.h"
 
 #include <deque>
-#include <map>
 #include <vector>
 
 namespace storm {
@@ -25,7 +24,7 @@ class ProductBuilder {
         typedef std::pair<state_type, state_type> product_state_type;
 
         state_type nextState = 0;
-        std::map<product_state_type, state_type> productStateToProductIndex;
+        typename Product<Model>::product_state_to_product_index_map productStateToProductIndex;
         std::vector<product_state_type> productIndexToProductState;
         std::vector<state_type> prodInitial;
 
@@ -34,78 +33,44 @@ class ProductBuilder {
         // use of the SparseMatrixBuilder that can only handle linear addNextValue
         // calls
         std::deque<state_type> todo;
-        for (state_type s_0 : statesOfInterest) {
-            state_type q_0 = prodOp.getInitialState(s_0);
 
-            // std::cout << "Initial: " << s_0 << ", " << q_0 << " = " << nextState << "\n";
+        // Returns the index of the given product state, assigning a fresh index (and scheduling the state for exploration) if it is new.
+        // Only the product states reachable from the states of interest are ever visited.
+        auto getOrAddProductState = [&](product_state_type const& productState) {
+            auto insertionResult = productStateToProductIndex.emplace(productState, nextState);
+            if (insertionResult.second) {
+                productIndexToProductState.push_back(productState);
+                todo.push_back(nextState);
+                ++nextState;
+            }
+            return insertionResult.first->second;
+        };
 
-            product_state_type s_q(s_0, q_0);
-            state_type index = nextState++;
-            productStateToProductIndex[s_q] = index;
-            productIndexToProductState.push_back(s_q);
+        for (state_type s_0 : statesOfInterest) {
+            state_type q_0 = prodOp.getInitialState(s_0);
+            state_type index = getOrAddProductState(product_state_type(s_0, q_0));
             prodInitial.push_back(index);
-            todo.push_back(index);
         }
 
         storm::storage::SparseMatrixBuilder<typename Model::ValueType> builder(0, 0, 0, false, deterministic ? false : true, 0);
+        auto const& rowGroupIndices = originalMatrix.getRowGroupIndices();
         std::size_t curRow = 0;
         while (!todo.empty()) {
             state_type prodIndexFrom = todo.front();
             todo.pop_front();
 
-            product_state_type from = productIndexToProductState.at(prodIndexFrom);
-            // std::cout << "Handle " << from.first << "," << from.second << " (prodIndexFrom = " << prodIndexFrom << "):\n";
-            if (deterministic) {
-                typename matrix_type::const_rows row = originalMatrix.getRow(from.first);
-                for (auto const& entry : row) {
+            // The rows of a product state are exactly the rows of its model state with the target states lifted to the product.
+            product_state_type from = productIndexToProductState[prodIndexFrom];
+            if (!deterministic) {
+                builder.newRowGroup(curRow);
+            }
+            for (auto row = rowGroupIndices[from.first], rowEnd = rowGroupIndices[from.first + 1]; row < rowEnd; ++row) {
+                for (auto const& entry : originalMatrix.getRow(row)) {
                     state_type t = entry.getColumn();
                     state_type p = prodOp.getSuccessor(from.second, t);
-                    // std::cout << " p = " << p << "\n";
-                    product_state_type t_p(t, p);
-                    state_type prodIndexTo;
-                    auto it = productStateToProductIndex.find(t_p);
-                    if (it == productStateToProductIndex.end()) {
-                        prodIndexTo = nextState++;
-                        todo.push_back(prodIndexTo);
-                        productIndexToProductState.push_back(t_p);
-                        productStateToProductIndex[t_p] = prodIndexTo;
-                        // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                    } else {
-                        prodIndexTo = it->second;
-                    }
-                    // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
-
-                    // std::cout << " addNextValue(" << prodIndexFrom << "," << prodIndexTo << "," << entry.getValue() << ")\n";
-                    builder.addNextValue(prodIndexFrom, prodIndexTo, entry.getValue());
-                }
-            } else {
-                std::size_t numRows = originalMatrix.getRowGroupSize(from.first);
-                builder.newRowGroup(curRow);
-                for (std::size_t i = 0; i < numRows; i++) {
-                    auto const& row = originalMatrix.getRow(from.first, i);
-                    for (auto const& entry : row) {
-                        state_type t = entry.getColumn();
-                        state_type p = prodOp.getSuccessor(from.second, t);
-                        // std::cout << " p = " << p << "\n";
-                        product_state_type t_p(t, p);
-                        state_type prodIndexTo;
-                        auto it = productStateToProductIndex.find(t_p);
-                        if (it == productStateToProductIndex.end()) {
-                            prodIndexTo = nextState++;
-                            todo.push_back(prodIndexTo);
-                            productIndexToProductState.push_back(t_p);
-                            productStateToProductIndex[t_p] = prodIndexTo;
-                            // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                        } else {
-                            prodIndexTo = it->second;
-                        }
-                        // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
-
-                        // std::cout << " addNextValue(" << prodIndexFrom << "," << prodIndexTo << "," << entry.getValue() << ")\n";
-                        builder.addNextValue(curRow, prodIndexTo, entry.getValue());
-                    }
-                    curRow++;
+                    builder.addNextValue(curRow, getOrAddProductState(product_state_type(t, p)), entry.getValue());
                 }
+                curRow++;
             }
         }
 
@@ -0,0 +1,382 @@
+#include "storm/transformer/StatePermuter.h"
+
+#include <algorithm>
+#include <queue>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace transformer {
+
+namespace {
+// The maximal number of states in a block of the partition order. Blocks of this size (together with their transitions)
+// typically fit into the L2 cache.
+uint64_t const partitionBlockSize = 4096;
+
+/*
+ * The undirected graph underlying a transition matrix (without self-loops), where the neighbors of state s are
+ * neighbors[neighborStarts[s]], ..., neighbors[neighborStarts[s + 1] - 1].
+ */
+struct UndirectedGraph {
+    std::vector<uint64_t> neighborStarts;
+    std::vector<uint64_t> neighbors;
+
+    uint64_t getDegree(uint64_t state) const {
+        return neighborStarts[state + 1] - neighborStarts[state];
+    }
+};
+
+template<typename ValueType>
+UndirectedGraph buildUndirectedGraph(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+    // First count the (possibly duplicate) neighbors of each state, then fill them in.
+    std::vector<uint64_t> counts(numberOfStates + 1, 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (auto const& entry : transitionMatrix.getRows(rowGroupIndices[state], rowGroupIndices[state + 1])) {
+            if (entry.getColumn() != state) {
+                ++counts[state + 1];
+                ++counts[entry.getColumn() + 1];
+            }
+        }
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        counts[state + 1] += counts[state];
+    }
+    std::vector<uint64_t> neighbors(counts.back());
+    std::vector<uint64_t> insertPositions(counts.begin(), counts.end() - 1);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (auto const& entry : transitionMatrix.getRows(rowGroupIndices[state], rowGroupIndices[state + 1])) {
+            if (entry.getColumn() != state) {
+                neighbors[insertPositions[state]++] = entry.getColumn();
+                neighbors[insertPositions[entry.getColumn()]++] = state;
+            }
+        }
+    }
+
+    // Remove duplicates and compact the neighbor lists.
+    UndirectedGraph result;
+    result.neighborStarts.reserve(numberOfStates + 1);
+    result.neighbors.reserve(neighbors.size());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        result.neighborStarts.push_back(result.neighbors.size());
+        auto begin = neighbors.begin() + counts[state];
+        auto end = neighbors.begin() + counts[state + 1];
+        std::sort(begin, end);
+        end = std::unique(begin, end);
+        result.neighbors.insert(result.neighbors.end(), begin, end);
+    }
+    result.neighborStarts.push_back(result.neighbors.size());
+    return result;
+}
+
+/*
+ * Appends the states reachable from the given start state (that are not yet visited) to the order in breadth-first
+ * order. If requested, the newly discovered neighbors of each state are appended with increasing degree.
+ */
+void appendBreadthFirstOrder(UndirectedGraph const& graph, uint64_t start, bool sortByDegree, storm::storage::BitVector& visited,
+                             std::vector<uint64_t>& order) {
+    if (visited.get(start)) {
+        return;
+    }
+    visited.set(start);
+    order.push_back(start);
+    for (uint64_t index = order.size() - 1; index < order.size(); ++index) {
+        uint64_t const state = order[index];
+        uint64_t const firstNewState = order.size();
+        for (uint64_t neighborIndex = graph.neighborStarts[state]; neighborIndex < graph.neighborStarts[state + 1]; ++neighborIndex) {
+            uint64_t const neighbor = graph.neighbors[neighborIndex];
+            if (!visited.get(neighbor)) {
+                visited.set(neighbor);
+                order.push_back(neighbor);
+            }
+        }
+        if (sortByDegree) {
+            std::stable_sort(order.begin() + firstNewState, order.end(),
+                             [&graph](uint64_t const& lhs, uint64_t const& rhs) { return graph.getDegree(lhs) < graph.getDegree(rhs); });
+        }
+    }
+}
+
+std::vector<uint64_t> computeReverseCuthillMcKeeOrder(UndirectedGraph const& graph) {
+    uint64_t const numberOfStates = graph.neighborStarts.size() - 1;
+
+    // Every connected component is explored from its state of minimal degree, which approximates a peripheral state.
+    std::vector<uint64_t> statesByDegree = storm::utility::vector::buildVectorForRange<uint64_t>(0, numberOfStates);
+    std::stable_sort(statesByDegree.begin(), statesByDegree.end(),
+                     [&graph](uint64_t const& lhs, uint64_t const& rhs) { return graph.getDegree(lhs) < graph.getDegree(rhs); });
+
+    std::vector<uint64_t> order;
+    order.reserve(numberOfStates);
+    storm::storage::BitVector visited(numberOfStates, false);
+    for (auto const& start : statesByDegree) {
+        appendBreadthFirstOrder(graph, start, true, visited, order);
+    }
+
+    std::vector<uint64_t> result(numberOfStates);
+    for (uint64_t index = 0; index < numberOfStates; ++index) {
+        result[order[index]] = numberOfStates - 1 - index;
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> computeSccTopologicalOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    // The SCCs are sorted such that the SCCs reachable from an SCC precede it. Hence, a (Gauss-Seidel style) sweep over
+    // the states in increasing order already uses the updated values of the successor SCCs.
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    std::vector<uint64_t> result(transitionMatrix.getRowGroupCount());
+    uint64_t nextIndex = 0;
+    for (auto const& scc : sccDecomposition) {
+        for (auto const& state : scc) {
+            result[state] = nextIndex++;
+        }
+    }
+    STORM_LOG_ASSERT(nextIndex == result.size(), "The SCC decomposition does not cover all states.");
+    return result;
+}
+
+std::vector<uint64_t> computePartitionOrder(UndirectedGraph const& graph, storm::storage::BitVector const& initialStates) {
+    uint64_t const numberOfStates = graph.neighborStarts.size() - 1;
+
+    // The blocks are seeded in breadth-first order (starting from the initial states), such that consecutive blocks are
+    // close to each other.
+    std::vector<uint64_t> seeds;
+    seeds.reserve(numberOfStates);
+    storm::storage::BitVector visited(numberOfStates, false);
+    for (auto const& initialState : initialStates) {
+        appendBreadthFirstOrder(graph, initialState, false, visited, seeds);
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        appendBreadthFirstOrder(graph, state, false, visited, seeds);
+    }
+
+    // Each block is grown greedily from its seed by adding the state with the most neighbors inside the block, which
+    // keeps the number of transitions between blocks small.
+    std::vector<uint64_t> result(numberOfStates);
+    storm::storage::BitVector assigned(numberOfStates, false);
+    std::vector<uint64_t> gains(numberOfStates, 0);
+    std::vector<uint64_t> touchedStates;
+    std::priority_queue<std::pair<uint64_t, uint64_t>> candidates;
+    uint64_t nextIndex = 0;
+    for (auto const& seed : seeds) {
+        if (assigned.get(seed)) {
+            continue;
+        }
+        candidates.emplace(0, seed);
+        uint64_t blockSize = 0;
+        while (!candidates.empty() && blockSize < partitionBlockSize) {
+            auto const [gain, state] = candidates.top();
+            candidates.pop();
+            if (assigned.get(state) || gain != gains[state]) {
+                // The candidate is outdated.
+                continue;
+            }
+            assigned.set(state);
+            result[state] = nextIndex++;
+            ++blockSize;
+            for (uint64_t neighborIndex = graph.neighborStarts[state]; neighborIndex < graph.neighborStarts[state + 1]; ++neighborIndex) {
+                uint64_t const neighbor = graph.neighbors[neighborIndex];
+                if (!assigned.get(neighbor)) {
+                    if (gains[neighbor] == 0) {
+                        touchedStates.push_back(neighbor);
+                    }
+                    candidates.emplace(++gains[neighbor], neighbor);
+                }
+            }
+        }
+        candidates = std::priority_queue<std::pair<uint64_t, uint64_t>>();
+        for (auto const& state : touchedStates) {
+            gains[state] = 0;
+        }
+        touchedStates.clear();
+    }
+    STORM_LOG_ASSERT(nextIndex == numberOfStates, "The partition does not cover all states.");
+    return result;
+}
+
+template<typename T>
+std::vector<T> permuteVector(std::vector<T> const& values, std::vector<uint64_t> const& newToOldIndexMapping) {
+    std::vector<T> result(newToOldIndexMapping.size());
+    storm::utility::vector::selectVectorValues(result, newToOldIndexMapping, values);
+    return result;
+}
+
+/*
+ * Permutes the rows and columns of the given matrix, where the rows of each row group are moved together.
+ */
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> permuteMatrix(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                      std::vector<uint64_t> const& oldToNewStateIndexMapping,
+                                                      std::vector<uint64_t> const& newToOldStateIndexMapping) {
+    bool const hasTrivialRowGrouping = matrix.hasTrivialRowGrouping();
+    storm::storage::SparseMatrixBuilder<ValueType> builder(matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount(), true, !hasTrivialRowGrouping,
+                                                           hasTrivialRowGrouping ? 0 : matrix.getRowGroupCount());
+    std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+    uint64_t newRow = 0;
+    for (auto const& oldState : newToOldStateIndexMapping) {
+        if (!hasTrivialRowGrouping) {
+            builder.newRowGroup(newRow);
+        }
+        for (auto const& oldRow : matrix.getRowGroupIndices(oldState)) {
+            rowEntries.clear();
+            for (auto const& entry : matrix.getRow(oldRow)) {
+                rowEntries.emplace_back(oldToNewStateIndexMapping[entry.getColumn()], entry.getValue());
+            }
+            std::sort(rowEntries.begin(), rowEntries.end(),
+                      [](std::pair<uint64_t, ValueType> const& lhs, std::pair<uint64_t, ValueType> const& rhs) { return lhs.first < rhs.first; });
+            for (auto const& entry : rowEntries) {
+                builder.addNextValue(newRow, entry.first, entry.second);
+            }
+            ++newRow;
+        }
+    }
+    return builder.build();
+}
+}  // namespace
+
+std::string toString(StatePermutationOrder const& order) {
+    switch (order) {
+        case StatePermutationOrder::ReverseCuthillMcKee:
+            return "rcm";
+        case StatePermutationOrder::SccTopological:
+            return "scc";
+        case StatePermutationOrder::Partition:
+            return "partition";
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown state permutation order.");
+}
+
+template<typename ValueType>
+std::vector<uint64_t> computeStatePermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates,
+                                              StatePermutationOrder order) {
+    switch (order) {
+        case StatePermutationOrder::ReverseCuthillMcKee:
+            return computeReverseCuthillMcKeeOrder(buildUndirectedGraph(transitionMatrix));
+        case StatePermutationOrder::SccTopological:
+            return computeSccTopologicalOrder(transitionMatrix);
+        case StatePermutationOrder::Partition:
+            return computePartitionOrder(buildUndirectedGraph(transitionMatrix), initialStates);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown state permutation order.");
+}
+
+template<typename ValueType, typename RewardModelType>
+StatePermutationReturnType<ValueType, RewardModelType> permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                     std::vector<uint64_t> const& oldToNewStateIndexMapping) {
+    typedef typename RewardModelType::ValueType RewardValueType;
+    auto const& transitionMatrix = originalModel.getTransitionMatrix();
+    uint64_t const numberOfStates = originalModel.getNumberOfStates();
+    STORM_LOG_THROW(oldToNewStateIndexMapping.size() == numberOfStates, storm::exceptions::InvalidArgumentException,
+                    "The permutation has size " << oldToNewStateIndexMapping.size() << " but the model has " << numberOfStates << " states.");
+
+    StatePermutationReturnType<ValueType, RewardModelType> result;
+    result.oldToNewStateIndexMapping = oldToNewStateIndexMapping;
+    result.newToOldStateIndexMapping.assign(numberOfStates, numberOfStates);
+    for (uint64_t oldState = 0; oldState < numberOfStates; ++oldState) {
+        uint64_t const newState = oldToNewStateIndexMapping[oldState];
+        STORM_LOG_THROW(newState < numberOfStates && result.newToOldStateIndexMapping[newState] == numberOfStates, storm::exceptions::InvalidArgumentException,
+                        "The given state mapping is not a permutation.");
+        result.newToOldStateIndexMapping[newState] = oldState;
+    }
+    result.newToOldChoiceIndexMapping.reserve(transitionMatrix.getRowCount());
+    for (auto const& oldState : result.newToOldStateIndexMapping) {
+        for (auto const& oldChoice : transitionMatrix.getRowGroupIndices(oldState)) {
+            result.newToOldChoiceIndexMapping.push_back(oldChoice);
+        }
+    }
+    auto const& newToOldStates = result.newToOldStateIndexMapping;
+    auto const& newToOldChoices = result.newToOldChoiceIndexMapping;
+
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components;
+    components.transitionMatrix = permuteMatrix(transitionMatrix, oldToNewStateIndexMapping, newToOldStates);
+    components.stateLabeling = originalModel.getStateLabeling();
+    components.stateLabeling.permuteItems(newToOldStates);
+    for (auto const& rewardModel : originalModel.getRewardModels()) {
+        std::optional<std::vector<RewardValueType>> stateRewards;
+        std::optional<std::vector<RewardValueType>> stateActionRewards;
+        std::optional<storm::storage::SparseMatrix<RewardValueType>> transitionRewards;
+        if (rewardModel.second.hasStateRewards()) {
+            stateRewards = permuteVector(rewardModel.second.getStateRewardVector(), newToOldStates);
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            stateActionRewards = permuteVector(rewardModel.second.getStateActionRewardVector(), newToOldChoices);
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            transitionRewards = permuteMatrix(rewardModel.second.getTransitionRewardMatrix(), oldToNewStateIndexMapping, newToOldStates);
+        }
+        components.rewardModels.emplace(rewardModel.first,
+                                        RewardModelType(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+    }
+    if (originalModel.hasChoiceLabeling()) {
+        components.choiceLabeling = originalModel.getChoiceLabeling();
+        components.choiceLabeling->permuteItems(newToOldChoices);
+    }
+    if (originalModel.hasStateValuations()) {
+        components.stateValuations = originalModel.getStateValuations().selectStates(newToOldStates);
+    }
+    if (originalModel.hasChoiceOrigins()) {
+        components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(newToOldChoices);
+    }
+
+    if (originalModel.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto const& ma = *originalModel.template as<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>();
+        components.markovianStates = ma.getMarkovianStates().permute(newToOldStates);
+        components.exitRates = permuteVector(ma.getExitRates(), newToOldStates);
+        components.rateTransitions = false;  // Note that originalModel.getTransitionMatrix() contains probabilities
+    } else if (originalModel.isOfType(storm::models::ModelType::Ctmc)) {
+        auto const& ctmc = *originalModel.template as<storm::models::sparse::Ctmc<ValueType, RewardModelType>>();
+        components.exitRates = permuteVector(ctmc.getExitRateVector(), newToOldStates);
+        components.rateTransitions = true;
+    } else if (originalModel.isOfType(storm::models::ModelType::Pomdp)) {
+        auto const& pomdp = *originalModel.template as<storm::models::sparse::Pomdp<ValueType, RewardModelType>>();
+        components.observabilityClasses = permuteVector(pomdp.getObservations(), newToOldStates);
+        components.observationValuations = pomdp.getOptionalObservationValuations();
+    } else {
+        STORM_LOG_THROW(originalModel.isOfType(storm::models::ModelType::Dtmc) || originalModel.isOfType(storm::models::ModelType::Mdp),
+                        storm::exceptions::NotSupportedException, "Permuting the states of models of type " << originalModel.getType() << " is not supported.");
+    }
+
+    result.model = storm::utility::builder::buildModelFromComponents(originalModel.getType(), std::move(components));
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType>
+StatePermutationReturnType<ValueType, RewardModelType> permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                     StatePermutationOrder order) {
+    return permuteStates(originalModel, computeStatePermutation(originalModel.getTransitionMatrix(), originalModel.getInitialStates(), order));
+}
+
+template std::vector<uint64_t> computeStatePermutation(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                       storm::storage::BitVector const& initialStates, StatePermutationOrder order);
+template std::vector<uint64_t> computeStatePermutation(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                       storm::storage::BitVector const& initialStates, StatePermutationOrder order);
+template std::vector<uint64_t> computeStatePermutation(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                       storm::storage::BitVector const& initialStates, StatePermutationOrder order);
+
+template StatePermutationReturnType<double> permuteStates(storm::models::sparse::Model<double> const& originalModel,
+                                                          std::vector<uint64_t> const& oldToNewStateIndexMapping);
+template StatePermutationReturnType<storm::RationalNumber> permuteStates(storm::models::sparse::Model<storm::RationalNumber> const& originalModel,
+                                                                         std::vector<uint64_t> const& oldToNewStateIndexMapping);
+template StatePermutationReturnType<storm::RationalFunction> permuteStates(storm::models::sparse::Model<storm::RationalFunction> const& originalModel,
+                                                                           std::vector<uint64_t> const& oldToNewStateIndexMapping);
+
+template StatePermutationReturnType<double> permuteStates(storm::models::sparse::Model<double> const& originalModel, StatePermutationOrder order);
+template StatePermutationReturnType<storm::RationalNumber> permuteStates(storm::models::sparse::Model<storm::RationalNumber> const& originalModel,
+                                                                         StatePermutationOrder order);
+template StatePermutationReturnType<storm::RationalFunction> permuteStates(storm::models::sparse::Model<storm::RationalFunction> const& originalModel,
+                                                                           StatePermutationOrder order);
+}  // namespace transformer
+}  // namespace storm
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace transformer {
+
+/*
+ * The orders in which the states of a model can be renumbered.
+ *    * ReverseCuthillMcKee reduces the bandwidth of the transition matrix, i.e., the successors of a state get close indices.
+ *    * SccTopological numbers the states SCC by SCC such that the SCCs reachable from an SCC come first.
+ *    * Partition splits the state space into connected blocks of bounded size whose states are numbered consecutively.
+ */
+enum class StatePermutationOrder { ReverseCuthillMcKee, SccTopological, Partition };
+
+std::string toString(StatePermutationOrder const& order);
+
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+struct StatePermutationReturnType {
+    // The resulting model
+    std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> model;
+    // Gives for each state in the original model the corresponding state in the resulting model.
+    std::vector<uint64_t> oldToNewStateIndexMapping;
+    // Gives for each state in the resulting model the corresponding state in the original model.
+    std::vector<uint64_t> newToOldStateIndexMapping;
+    // Gives for each choice in the resulting model the corresponding choice in the original model.
+    std::vector<uint64_t> newToOldChoiceIndexMapping;
+};
+
+/*
+ * Computes a renumbering of the states of the given transition matrix that improves the memory locality of the
+ * numerical algorithms operating on it.
+ *
+ * @param transitionMatrix The (row grouped) transition matrix.
+ * @param initialStates The initial states. Ties are broken such that states close to these states come first.
+ * @param order The order to compute.
+ * @return For each state, its new index.
+ */
+template<typename ValueType>
+std::vector<uint64_t> computeStatePermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates,
+                                              StatePermutationOrder order);
+
+/*
+ * Renumbers the states of the given model. The choices of each state are moved along with the state, i.e., their
+ * relative order within the row group is preserved. All state and choice based components (labelings, reward models,
+ * valuations, choice origins, exit rates, ...) are permuted accordingly.
+ *
+ * @param originalModel The original model.
+ * @param oldToNewStateIndexMapping For each state of the original model, its index in the resulting model.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+StatePermutationReturnType<ValueType, RewardModelType> permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                     std::vector<uint64_t> const& oldToNewStateIndexMapping);
+
+/*
+ * Renumbers the states of the given model according to the given order.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+StatePermutationReturnType<ValueType, RewardModelType> permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                     StatePermutationOrder order);
+
+/*
+ * Maps the given values of the states of a permuted model back to the states of the original model.
+ *
+ * @param valuesOfPermutedModel The values indexed by the states of the permuted model.
+ * @param oldToNewStateIndexMapping For each state of the original model, its index in the permuted model.
+ * @return The values indexed by the states of the original model.
+ */
+template<typename T>
+std::vector<T> restoreOriginalStateOrder(std::vector<T> const& valuesOfPermutedModel, std::vector<uint64_t> const& oldToNewStateIndexMapping) {
+    std::vector<T> result;
+    result.reserve(oldToNewStateIndexMapping.size());
+    for (auto const& newState : oldToNewStateIndexMapping) {
+        result.push_back(valuesOfPermutedModel[newState]);
+    }
+    return result;
+}
+
+}  // namespace transformer
+}  // namespace storm
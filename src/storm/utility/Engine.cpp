@@ -16,6 +16,7 @@
 #include "storm/modelchecker/CheckTask.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
 
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/jani/Property.h"
@@ -50,6 +51,8 @@ std::string toString(Engine const& engine) {
             return "expl";
         case Engine::AbstractionRefinement:
             return "abs";
+        case Engine::Statistical:
+            return "smc";
         case Engine::Automatic:
             return "automatic";
         case Engine::Unknown:
@@ -93,6 +96,8 @@ storm::builder::BuilderType getBuilderType(Engine const& engine) {
             return storm::builder::BuilderType::Explicit;
         case Engine::AbstractionRefinement:
             return storm::builder::BuilderType::Dd;
+        case Engine::Statistical:
+            return storm::builder::BuilderType::Explicit;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given engine has no builder type to it.");
             return storm::builder::BuilderType::Explicit;
@@ -155,6 +160,21 @@ bool canHandle(storm::utility::Engine const& engine, storm::storage::SymbolicMod
                     return false;
             }
             break;
+        case Engine::Statistical:
+            if constexpr (std::is_same<ValueType, double>::value) {
+                switch (modelType) {
+                    case ModelType::DTMC:
+                        return storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>>::canHandleStatic(checkTask);
+                    case ModelType::CTMC:
+                        return storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Ctmc<ValueType>>::canHandleStatic(checkTask);
+                    case ModelType::MDP:
+                    case ModelType::MA:
+                    case ModelType::POMDP:
+                    case ModelType::SMG:
+                        return false;
+                }
+            }
+            break;
         default:
             STORM_LOG_ERROR("The selected engine " << engine << " is not considered.");
     }
@@ -40,6 +40,14 @@ bool BernoulliDistributionGenerator::random(boost::mt19937& engine) {
     return distribution(engine);
 }
 
+uint64_t getStreamSeed(uint64_t seed, uint64_t streamIndex) {
+    // Apply the splitmix64 finalizer to the combination of seed and stream index.
+    uint64_t z = seed + (streamIndex + 1) * 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
 ExponentialDistributionGenerator::ExponentialDistributionGenerator(double rate) : distribution(rate) {}
 
 double ExponentialDistributionGenerator::random(boost::mt19937& engine) {
@@ -50,6 +50,16 @@ class BernoulliDistributionGenerator {
     boost::random::bernoulli_distribution<> distribution;
 };
 
+/*!
+ * Derives the seed of an independent random number stream from a base seed, e.g., to give each thread (or each batch
+ * of samples) its own generator. Streams with different indices obtain well-separated seeds.
+ *
+ * @param seed The base seed.
+ * @param streamIndex The index of the stream.
+ * @return The seed of the stream.
+ */
+uint64_t getStreamSeed(uint64_t seed, uint64_t streamIndex);
+
 class ExponentialDistributionGenerator {
    public:
     ExponentialDistributionGenerator(double rate);
@@ -58,6 +58,16 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
                                                    storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
                                                    std::vector<ValueType> const& oneStepProbabilities);
 
+/*!
+ * Computes the number of transitions that are introduced when eliminating the given state, i.e. the number of pairs of a
+ * predecessor and a successor of the state that are not yet connected.
+ */
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyMinimumFillIn(storm::storage::sparse::state_type const& state,
+                                               storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                               storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                               std::vector<ValueType> const& oneStepProbabilities);
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -99,6 +99,41 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_parallelRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>>> additionalCheckers;
+        for (uint64_t thread = 1; thread < 4; ++thread) {
+            additionalCheckers.push_back(storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task));
+        }
+
+        // Without a coverage threshold, all subregions up to the depth limit are analyzed, so both refinements have to yield the same result.
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+        auto expected = regionChecker->performRegionRefinement(this->env(), region, boost::none, 3);
+        for (auto priority : {storm::modelchecker::RegionRefinementPriority::Size, storm::modelchecker::RegionRefinementPriority::Uncertainty}) {
+            auto actual = regionChecker->performParallelRegionRefinement(this->env(), region, boost::none, 3, storm::modelchecker::RegionResultHypothesis::Unknown, additionalCheckers, priority);
+            EXPECT_EQ(expected->getRegionResults().size(), actual->getRegionResults().size());
+            EXPECT_EQ(expected->getSatFraction(), actual->getSatFraction());
+            EXPECT_EQ(expected->getUnsatFraction(), actual->getUnsatFraction());
+        }
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
         typedef typename TestFixture::ValueType ValueType;
 
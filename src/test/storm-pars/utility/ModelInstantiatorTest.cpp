@@ -12,6 +12,8 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm-pars/utility/ModelInstantiator.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/environment/Environment.h"
 #include "storm/api/storm.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/models/sparse/Model.h"
@@ -257,4 +259,50 @@ TEST(ModelInstantiatorTest, Consensus) {
     EXPECT_NEAR(0.3526577219, quantitativeChkResult[*instantiated.getInitialStates().begin()], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(ModelInstantiatorTest, BrpProbBatch) {
+    carl::VariablePool::getInstance().clear();
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+    
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (double valueL : {0.1, 0.5, 0.8, 0.95}) {
+        for (double valueK : {0.3, 0.9}) {
+            std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+            valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueL)));
+            valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueK)));
+            valuations.push_back(std::move(valuation));
+        }
+    }
+    
+    storm::Environment env;
+    storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction> checkTask(*formulas.front(), true);
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> batchChecker(*dtmc);
+    batchChecker.specifyFormula(checkTask);
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> singleChecker(*dtmc);
+    singleChecker.specifyFormula(checkTask);
+    
+    auto batchResults = batchChecker.checkBatch(env, valuations);
+    ASSERT_EQ(valuations.size(), batchResults.size());
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+    for (uint64_t k = 0; k < valuations.size(); ++k) {
+        auto singleResult = singleChecker.check(env, valuations[k]);
+        EXPECT_NEAR(singleResult->asExplicitQuantitativeCheckResult<double>()[initialState], batchResults[k]->asExplicitQuantitativeCheckResult<double>()[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+    EXPECT_NEAR(0.2989278941, batchResults[5]->asExplicitQuantitativeCheckResult<double>()[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
+
 #endif
@@ -93,6 +93,21 @@ namespace {
         static PreprocessingType const preprocessingType = PreprocessingType::None;
     };
 
+    class QuantizedBeliefsDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.12); } // there actually aren't any precision guarantees, but we still want to detect if results are weird.
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) { options.quantizeBeliefs = true; }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+    };
+
     class RefineDoubleVIEnvironment {
     public:
         typedef double ValueType;
@@ -239,6 +254,7 @@ namespace {
             QualitativeReductionDefaultDoubleVIEnvironment,
             PreprocessedDefaultDoubleVIEnvironment,
             FineDoubleVIEnvironment,
+            QuantizedBeliefsDoubleVIEnvironment,
             RefineDoubleVIEnvironment,
             PreprocessedRefineDoubleVIEnvironment,
             DefaultDoubleOVIEnvironment,
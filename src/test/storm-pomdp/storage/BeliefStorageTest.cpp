@@ -0,0 +1,104 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-pomdp/storage/BeliefStorage.h"
+
+namespace {
+typedef storm::storage::BeliefStorage<uint64_t, double> BeliefStorageType;
+
+BeliefStorageType::BeliefType createBelief(std::vector<std::pair<uint64_t, double>> const& entries) {
+    return BeliefStorageType::BeliefType(entries.begin(), entries.end());
+}
+
+void expectBeliefEntries(BeliefStorageType const& storage, BeliefStorageType::BeliefId const& id, BeliefStorageType::BeliefType const& belief) {
+    auto view = storage.get(id);
+    ASSERT_EQ(belief.size(), view.size());
+    auto beliefIt = belief.begin();
+    for (auto const& entry : view) {
+        EXPECT_EQ(beliefIt->first, entry.first);
+        EXPECT_EQ(beliefIt->second, entry.second);
+        ++beliefIt;
+    }
+}
+}  // namespace
+
+TEST(BeliefStorageTest, Exact) {
+    BeliefStorageType storage;
+    auto belief = createBelief({{0, 0.3}, {2, 0.7}});
+    auto noisyBelief = createBelief({{0, 0.3 + 1e-12}, {2, 0.7 - 1e-12}});
+
+    auto first = storage.getOrAdd(belief);
+    EXPECT_TRUE(first.second);
+    EXPECT_EQ(0ull, first.first);
+    auto second = storage.getOrAdd(belief);
+    EXPECT_FALSE(second.second);
+    EXPECT_EQ(first.first, second.first);
+
+    // Without quantization, beliefs that differ by noise are different beliefs.
+    EXPECT_EQ(BeliefStorageType::noId(), storage.find(noisyBelief));
+    auto third = storage.getOrAdd(noisyBelief);
+    EXPECT_TRUE(third.second);
+    EXPECT_EQ(1ull, third.first);
+    EXPECT_EQ(2ull, storage.size());
+    expectBeliefEntries(storage, first.first, belief);
+    expectBeliefEntries(storage, third.first, noisyBelief);
+}
+
+TEST(BeliefStorageTest, QuantizedBeliefsAreMerged) {
+    BeliefStorageType storage(1e-6);
+    auto belief = createBelief({{0, 0.3}, {1, 0.2}, {2, 0.5}});
+    // The noise is below the quantum and does not sum up to zero.
+    auto noisyBelief = createBelief({{0, 0.3 + 3e-12}, {1, 0.2 - 1e-12}, {2, 0.5 + 2e-12}});
+    // Entries that are rounded to zero are dropped.
+    auto beliefWithTinyEntry = createBelief({{0, 0.3}, {1, 0.2 - 1e-10}, {2, 0.5}, {3, 1e-10}});
+
+    auto first = storage.getOrAdd(belief);
+    EXPECT_TRUE(first.second);
+    auto second = storage.getOrAdd(noisyBelief);
+    EXPECT_FALSE(second.second);
+    EXPECT_EQ(first.first, second.first);
+    EXPECT_EQ(first.first, storage.find(beliefWithTinyEntry));
+    EXPECT_EQ(1ull, storage.size());
+
+    // The stored values are multiples of the quantum (except for the largest one) and sum up to one.
+    auto view = storage.get(first.first);
+    ASSERT_EQ(3ull, view.size());
+    double sum = 0.0;
+    for (auto const& entry : view) {
+        sum += entry.second;
+    }
+    EXPECT_NEAR(1.0, sum, 1e-15);
+
+    // Beliefs that differ by more than the quantum are not merged.
+    auto other = storage.getOrAdd(createBelief({{0, 0.3 + 1e-5}, {1, 0.2 - 1e-5}, {2, 0.5}}));
+    EXPECT_TRUE(other.second);
+    EXPECT_EQ(2ull, storage.size());
+}
+
+TEST(BeliefStorageTest, ManyBeliefs) {
+    // Inserting many beliefs grows the hash table several times. Since the hash table has at most twice as many slots as
+    // there are beliefs, many of them collide and have to be resolved by probing.
+    BeliefStorageType storage;
+    uint64_t const numberOfBeliefs = 5000;
+    std::vector<BeliefStorageType::BeliefType> beliefs;
+    for (uint64_t index = 0; index < numberOfBeliefs; ++index) {
+        double const value = static_cast<double>(index % 7 + 1) / 8.0;
+        beliefs.push_back(createBelief({{index / 7, value}, {index / 7 + 1, 1.0 - value}}));
+    }
+    for (uint64_t index = 0; index < numberOfBeliefs; ++index) {
+        auto result = storage.getOrAdd(beliefs[index]);
+        EXPECT_TRUE(result.second);
+        EXPECT_EQ(index, result.first);
+    }
+    EXPECT_EQ(numberOfBeliefs, storage.size());
+
+    for (uint64_t index = 0; index < numberOfBeliefs; ++index) {
+        auto result = storage.getOrAdd(beliefs[index]);
+        EXPECT_FALSE(result.second);
+        EXPECT_EQ(index, result.first);
+        EXPECT_EQ(index, storage.find(beliefs[index]));
+        expectBeliefEntries(storage, index, beliefs[index]);
+    }
+    EXPECT_EQ(BeliefStorageType::noId(), storage.find(createBelief({{0, 0.25}, {numberOfBeliefs, 0.75}})));
+    EXPECT_EQ(numberOfBeliefs, storage.size());
+}
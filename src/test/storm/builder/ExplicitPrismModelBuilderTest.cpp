@@ -2,6 +2,8 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/BytecodePrismProgram.h"
+#include "storm/generator/JitCompiledPrismProgram.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -175,6 +177,32 @@ TEST(ExplicitPrismModelBuilderTest, ExportExplicitLookup) {
     EXPECT_EQ(1ul, model->getLabelsOfState(lookup.lookup({{svar, manager.integer(7)}, {dvar, manager.integer(2)}})).count("two"));
 }
 
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+    sequentialOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    sequentialOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+
+    for (auto const& file : std::vector<std::string>({STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm"})) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            ASSERT_TRUE(parallelModel->hasRewardModel(rewardModel.first));
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            EXPECT_EQ(rewardModel.second.getOptionalStateRewardVector(), parallelRewardModel.getOptionalStateRewardVector());
+            EXPECT_EQ(rewardModel.second.getOptionalStateActionRewardVector(), parallelRewardModel.getOptionalStateActionRewardVector());
+        }
+    }
+}
+
 bool trivial_true_mask(storm::expressions::SimpleValuation const&, uint64_t) {
     return true;
 }
@@ -218,3 +246,70 @@ TEST(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+enum class CompiledEvaluationMode { NativeCode, Bytecode };
+
+class ExplicitPrismModelBuilderCompiledTest : public ::testing::TestWithParam<CompiledEvaluationMode> {
+   protected:
+    void SetUp() override {
+        if (GetParam() == CompiledEvaluationMode::NativeCode &&
+            !storm::generator::JitCompiledPrismProgram::isCompilerAvailable(storm::generator::NextStateGeneratorOptions().getJitCompiler())) {
+            GTEST_SKIP() << "No C++ compiler available for compiling programs to native code.";
+        }
+    }
+
+    void enableEvaluationMode(storm::generator::NextStateGeneratorOptions& options) const {
+        if (GetParam() == CompiledEvaluationMode::NativeCode) {
+            options.setJitCompilation();
+        } else {
+            options.setBytecodeEvaluation();
+        }
+    }
+
+    bool usesEvaluationMode(storm::generator::PrismNextStateGenerator<double, uint32_t> const& generator) const {
+        storm::generator::CompiledPrismProgram const* compiledProgram = generator.getCompiledProgram().get();
+        if (GetParam() == CompiledEvaluationMode::NativeCode) {
+            return dynamic_cast<storm::generator::JitCompiledPrismProgram const*>(compiledProgram) != nullptr;
+        }
+        return dynamic_cast<storm::generator::BytecodePrismProgram const*>(compiledProgram) != nullptr;
+    }
+};
+
+TEST_P(ExplicitPrismModelBuilderCompiledTest, SameModel) {
+    std::vector<std::pair<std::string, bool>> files = {{STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", false},
+                                                       {STORM_TEST_RESOURCES_DIR "/dtmc/nand-5-2.pm", false},
+                                                       {STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", false},
+                                                       {STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", false},
+                                                       {STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true},
+                                                       {STORM_TEST_RESOURCES_DIR "/ma/stream2.ma", false}};
+    for (auto const& file : files) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file.first, file.second);
+        storm::generator::NextStateGeneratorOptions options;
+        options.setBuildAllRewardModels().setBuildAllLabels();
+        auto expected = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+        enableEvaluationMode(options);
+        storm::generator::PrismNextStateGenerator<double, uint32_t> generator(program, options);
+        ASSERT_TRUE(usesEvaluationMode(generator)) << file.first;
+        auto actual = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+        EXPECT_EQ(expected->getTransitionMatrix(), actual->getTransitionMatrix()) << file.first;
+        EXPECT_EQ(expected->getStateLabeling(), actual->getStateLabeling()) << file.first;
+        ASSERT_EQ(expected->getNumberOfRewardModels(), actual->getNumberOfRewardModels()) << file.first;
+    }
+}
+
+TEST_P(ExplicitPrismModelBuilderCompiledTest, OutOfBounds) {
+    // Out-of-bounds values are still detected.
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/unbounded.nm");
+    storm::prism::Program program = modelDescription.preprocess("N=7").asPrismProgram();
+    storm::generator::NextStateGeneratorOptions options;
+    enableEvaluationMode(options);
+    storm::generator::PrismNextStateGenerator<double, uint32_t> generator(program, options);
+    ASSERT_TRUE(usesEvaluationMode(generator));
+    STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program, options).build(), storm::exceptions::WrongFormatException);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExplicitPrismModelBuilderTest, ExplicitPrismModelBuilderCompiledTest,
+                         ::testing::Values(CompiledEvaluationMode::NativeCode, CompiledEvaluationMode::Bytecode),
+                         [](::testing::TestParamInfo<CompiledEvaluationMode> const& info) {
+                             return info.param == CompiledEvaluationMode::NativeCode ? "NativeCode" : "Bytecode";
+                         });
@@ -11,11 +11,13 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
@@ -437,6 +439,56 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, TransientProbabilitiesMultipleTimeBounds) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 3.0);
+    matrixBuilder.addNextValue(1, 0, 2.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    std::vector<double> exitRates = {3, 2};
+    storm::storage::BitVector initialStates(2);
+    initialStates.set(0);
+    storm::storage::BitVector phiStates(2);
+    storm::storage::BitVector psiStates(2);
+    std::vector<double> timeBounds = {0, 0.5, 1, 2, 10};
+    for (auto method : {storm::solver::CtmcTransientMethod::Uniformization, storm::solver::CtmcTransientMethod::Krylov}) {
+        storm::Environment env;
+        env.solver().timeBounded().setCtmcMethod(method);
+        std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+            env, matrix, initialStates, phiStates, psiStates, exitRates, timeBounds);
+        ASSERT_EQ(timeBounds.size(), results.size());
+
+        // For this two-state chain, the probability to be in the initial state at time t is 0.4 + 0.6 * e^(-5t).
+        for (uint64_t i = 0; i < timeBounds.size(); ++i) {
+            double const expected = 0.4 + 0.6 * std::exp(-5.0 * timeBounds[i]);
+            EXPECT_NEAR(expected, results[i][0], 1e-6) << "for time bound " << timeBounds[i];
+            EXPECT_NEAR(1.0 - expected, results[i][1], 1e-6) << "for time bound " << timeBounds[i];
+        }
+    }
+}
+
+TEST(CtmcCslModelCheckerTest, KrylovTransientProbabilities) {
+    std::string formulasString = "P=? [ F<=10 \"down\" ]; P=? [ !\"down\" U[1,10] \"fail_sensors\" ]; P=? [ F[5,5] \"fail_io\" ]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+
+    storm::Environment uniformizationEnv;
+    uniformizationEnv.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::Uniformization);
+    storm::Environment krylovEnv;
+    krylovEnv.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::Krylov);
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*ctmc);
+    for (auto const& formula : formulas) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+        auto expected = checker.check(uniformizationEnv, task);
+        auto actual = checker.check(krylovEnv, task);
+        auto initialState = *ctmc->getInitialStates().begin();
+        EXPECT_NEAR(expected->asExplicitQuantitativeCheckResult<double>()[initialState], actual->asExplicitQuantitativeCheckResult<double>()[initialState],
+                    1e-6)
+            << "for " << *formula;
+    }
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
@@ -4,6 +4,7 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/settings/SettingsManager.h"
@@ -118,3 +119,31 @@ TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds) {
     EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")),
               result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
+
+TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds_parallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm";
+    std::string formulasAsString = "P=? [F{\"num_runs\"}<=3,{\"observe0\"}>1 true]";
+    formulasAsString += "; R{\"observe0\"}=? [C{\"num_runs\"}<=3]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "CrowdSize=4");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc =
+        storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+    uint_fast64_t const initState = *dtmc->getInitialStates().begin();
+
+    storm::Environment sequentialEnv, parallelEnv;
+    sequentialEnv.modelchecker().setEpochThreadCount(1);
+    parallelEnv.modelchecker().setEpochThreadCount(4);
+    std::vector<double> expectedResults = {78686542099694893.0 / 1268858272000000000.0, 620529.0 / 1364000.0};
+    for (uint64_t i = 0; i < formulas.size(); ++i) {
+        auto sequentialResult = storm::api::verifyWithSparseEngine(sequentialEnv, dtmc, storm::api::createTask<double>(formulas[i], true));
+        auto parallelResult = storm::api::verifyWithSparseEngine(parallelEnv, dtmc, storm::api::createTask<double>(formulas[i], true));
+        ASSERT_TRUE(parallelResult->isExplicitQuantitativeCheckResult());
+        EXPECT_NEAR(expectedResults[i], parallelResult->asExplicitQuantitativeCheckResult<double>()[initState], 1e-6);
+        EXPECT_NEAR(sequentialResult->asExplicitQuantitativeCheckResult<double>()[initState],
+                    parallelResult->asExplicitQuantitativeCheckResult<double>()[initState], 1e-10);
+    }
+}
@@ -4,6 +4,7 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
@@ -222,6 +223,34 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_csma) {
     EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_two_dim_walk_parallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ F{\"r\"}<=8,{\"l\"}<=6 x=N ] ";
+    formulasAsString += "; \n Pmin=? [ F{\"r\"}<=8,{\"l\"}<=6 x=N ] ";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    // Epochs on the same anti-diagonal are independent and analyzed concurrently.
+    storm::Environment sequentialEnv, parallelEnv;
+    sequentialEnv.modelchecker().setEpochThreadCount(1);
+    parallelEnv.modelchecker().setEpochThreadCount(4);
+    for (auto const& formula : formulas) {
+        auto sequentialResult = storm::api::verifyWithSparseEngine(sequentialEnv, mdp, storm::api::createTask<double>(formula, true));
+        auto parallelResult = storm::api::verifyWithSparseEngine(parallelEnv, mdp, storm::api::createTask<double>(formula, true));
+        ASSERT_TRUE(parallelResult->isExplicitQuantitativeCheckResult());
+        EXPECT_NEAR(sequentialResult->asExplicitQuantitativeCheckResult<double>()[initState],
+                    parallelResult->asExplicitQuantitativeCheckResult<double>()[initState], 1e-10)
+            << "for " << *formula;
+    }
+}
+
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_lower_bounds) {
     storm::Environment env;
 
@@ -0,0 +1,86 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpAnalysisCache.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+
+namespace {
+
+template<typename ValueType>
+void checkCacheYieldsSameResults(storm::Environment const& env, std::string const& path, std::string const& formulasString, ValueType const& precision) {
+    storm::prism::Program program = storm::api::parseProgram(path);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto mdp = storm::api::buildSparseModel<ValueType>(program, formulas)->template as<storm::models::sparse::Mdp<ValueType>>();
+
+    auto analysisCache = std::make_shared<storm::modelchecker::helper::SparseMdpAnalysisCache<ValueType>>(mdp->getTransitionMatrix());
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> cachingChecker(*mdp);
+    cachingChecker.setAnalysisCache(analysisCache);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> checker(*mdp);
+
+    // Check every formula twice such that the second check can reuse all information of the first one.
+    for (uint64_t round = 0; round < 2; ++round) {
+        for (auto const& formula : formulas) {
+            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> task(*formula);
+            auto expected = checker.check(env, task);
+            auto actual = cachingChecker.check(env, task);
+            auto const& expectedValues = expected->template asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+            auto const& actualValues = actual->template asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+            ASSERT_EQ(expectedValues.size(), actualValues.size());
+            for (uint64_t state = 0; state < expectedValues.size(); ++state) {
+                if (storm::utility::isInfinity(expectedValues[state])) {
+                    EXPECT_TRUE(storm::utility::isInfinity(actualValues[state])) << "for " << *formula << " at state " << state;
+                } else if (storm::utility::isZero(precision)) {
+                    EXPECT_EQ(expectedValues[state], actualValues[state]) << "for " << *formula << " at state " << state;
+                } else {
+                    EXPECT_NEAR(storm::utility::convertNumber<double>(expectedValues[state]), storm::utility::convertNumber<double>(actualValues[state]),
+                                storm::utility::convertNumber<double>(precision))
+                        << "for " << *formula << " at state " << state;
+                }
+            }
+        }
+    }
+    EXPECT_GT(analysisCache->getNumberOfHits(), 0ull);
+}
+
+}  // namespace
+
+TEST(SparseMdpAnalysisCacheTest, Consensus) {
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    checkCacheYieldsSameResults<double>(env, STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm",
+                                        "Pmin=? [F \"finished\" & \"all_coins_equal_0\"]; Pmax=? [F \"finished\" & \"all_coins_equal_0\"];"
+                                        "Pmax=? [F \"finished\" & \"all_coins_equal_1\"]; Pmin=? [F \"finished\" & !\"agree\"];"
+                                        "Rmin=? [F \"finished\"]; Rmax=? [F \"finished\"]; Pmax=? [G !\"finished\"]",
+                                        1e-6);
+}
+
+TEST(SparseMdpAnalysisCacheTest, ConsensusSound) {
+    storm::Environment env;
+    env.solver().setForceSoundness(true);
+    checkCacheYieldsSameResults<double>(env, STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm",
+                                        "Pmin=? [F \"finished\" & \"all_coins_equal_0\"]; Pmax=? [F \"finished\" & \"all_coins_equal_1\"];"
+                                        "Rmin=? [F \"finished\"]; Rmax=? [F \"finished\"]",
+                                        1e-5);
+}
+
+TEST(SparseMdpAnalysisCacheTest, LeaderExact) {
+    storm::Environment env;
+    checkCacheYieldsSameResults<storm::RationalNumber>(env, STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm",
+                                                       "Pmin=? [F \"elected\"]; Pmax=? [F<=5 \"elected\"]; Rmax=? [F \"elected\"]; Rmin=? [F \"elected\"]",
+                                                       storm::RationalNumber(0));
+}
+
+TEST(SparseMdpAnalysisCacheTest, WrongModel) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto mdp = storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions())->as<storm::models::sparse::Mdp<double>>();
+    auto otherMdp = storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions())->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    auto analysisCache = std::make_shared<storm::modelchecker::helper::SparseMdpAnalysisCache<double>>(otherMdp->getTransitionMatrix());
+    STORM_SILENT_EXPECT_THROW(checker.setAnalysisCache(analysisCache), storm::exceptions::InvalidArgumentException);
+}
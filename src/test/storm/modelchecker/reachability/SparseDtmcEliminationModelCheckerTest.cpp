@@ -139,3 +139,28 @@ TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+TEST(SparseDtmcEliminationModelCheckerTest, CrowdsOrdersAndThreads) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    // Every combination of order, method and number of threads has to yield the same result.
+    for (std::string const order : {"spen", "dpen", "minfill"}) {
+        for (std::string const method : {"state", "hybrid"}) {
+            for (std::string const threads : {"1", "4"}) {
+                storm::settings::mutableManager().setFromString("--elimination:order " + order + " --elimination:method " + method +
+                                                                " --elimination:threads " + threads);
+                std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formula);
+                EXPECT_NEAR(0.3328800375801578281, result->asExplicitQuantitativeCheckResult<double>()[0],
+                            storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision())
+                    << "for order " << order << ", method " << method << " and " << threads << " thread(s)";
+            }
+        }
+    }
+    storm::settings::mutableManager().setFromString("--elimination:order fwrev --elimination:method state --elimination:threads 1");
+}
@@ -0,0 +1,162 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace {
+
+storm::modelchecker::statistical::StatisticalModelCheckerOptions getOptions(uint64_t numberOfThreads = 1) {
+    storm::modelchecker::statistical::StatisticalModelCheckerOptions options;
+    options.seed = 42;
+    options.numberOfThreads = numberOfThreads;
+    return options;
+}
+
+}  // namespace
+
+TEST(StatisticalModelCheckerTest, StoppingCriteria) {
+    // ln(2/0.05) / (2 * 0.01^2) = 18444.4
+    storm::modelchecker::statistical::ChernoffHoeffdingCriterion chernoffHoeffding(0.01, 0.05);
+    EXPECT_EQ(18445ull, chernoffHoeffding.getRequiredNumberOfSamples().get());
+
+    storm::modelchecker::statistical::SequentialProbabilityRatioTest sprt(0.5, 0.05, 0.01);
+    storm::modelchecker::statistical::SampleStatistics statistics;
+    while (!sprt.isSatisfied(statistics)) {
+        statistics.add(1.0);
+    }
+    EXPECT_TRUE(sprt.isProbabilityAboveThreshold(statistics));
+    EXPECT_LT(statistics.numberOfSamples, 100ull);
+
+    storm::modelchecker::statistical::ConfidenceIntervalCriterion confidenceInterval(0.1, 0.05, 10);
+    storm::modelchecker::statistical::SampleStatistics constantStatistics;
+    for (uint64_t i = 0; i < 10; ++i) {
+        EXPECT_FALSE(confidenceInterval.isSatisfied(constantStatistics));
+        constantStatistics.add(3.0);
+    }
+    EXPECT_TRUE(confidenceInterval.isSatisfied(constantStatistics));
+    EXPECT_EQ(3.0, constantStatistics.getMean());
+    EXPECT_EQ(0.0, constantStatistics.getVariance());
+}
+
+TEST(StatisticalModelCheckerTest, DieSparse) {
+    std::string formulasString = "P=? [F \"one\"]";
+    formulasString += "; P=? [F<=3 \"done\"]";
+    formulasString += "; R{\"coin_flips\"}=? [F \"done\"]";
+    formulasString += "; R{\"coin_flips\"}=? [C<=2]";
+    formulasString += "; P>0.1 [F \"one\"]";
+    formulasString += "; P<0.1 [F \"one\"]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Dtmc<double>>();
+
+    auto options = getOptions();
+    options.precision = 0.05;
+    storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(*model, options);
+    uint64_t initialState = *model->getInitialStates().begin();
+
+    auto result = checker.check(storm::modelchecker::CheckTask<>(*formulas[0], true));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 0.05);
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formulas[1], true));
+    EXPECT_NEAR(0.75, result->asExplicitQuantitativeCheckResult<double>()[initialState], 0.05);
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formulas[2], true));
+    EXPECT_NEAR(11.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 0.1);
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formulas[3], true));
+    EXPECT_NEAR(2.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 0.05);
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formulas[4], true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initialState]);
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formulas[5], true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[initialState]);
+}
+
+TEST(StatisticalModelCheckerTest, DieProgram) {
+    std::string formulasString = "P=? [F \"one\"]";
+    formulasString += "; P=? [F s=7 & d>3]";
+    formulasString += "; R{\"coin_flips\"}=? [F \"done\"]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+
+    auto options = getOptions(2);
+    options.precision = 0.05;
+    storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(storm::storage::SymbolicModelDescription(program),
+                                                                                                        options);
+
+    auto result = checker.check(storm::modelchecker::CheckTask<>(*formulas[0], true));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], 0.05);
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formulas[1], true));
+    EXPECT_NEAR(0.5, result->asExplicitQuantitativeCheckResult<double>()[0], 0.05);
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formulas[2], true));
+    EXPECT_NEAR(11.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[0], 0.1);
+}
+
+TEST(StatisticalModelCheckerTest, Cluster) {
+    std::string formulasString = "P=? [F<=10 !\"minimum\"]";
+    formulasString += "; R{\"num_repairs\"}=? [C<=10]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Ctmc<double>>();
+    uint64_t initialState = *model->getInitialStates().begin();
+
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> numericalChecker(*model);
+    storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Ctmc<double>> checker(*model, getOptions(2));
+    storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Ctmc<double>> programChecker(
+        storm::storage::SymbolicModelDescription(program), getOptions());
+
+    for (auto const& formula : formulas) {
+        storm::modelchecker::CheckTask<> task(*formula, true);
+        double expected = numericalChecker.check(task)->asExplicitQuantitativeCheckResult<double>()[initialState];
+        double tolerance = formula->isRewardOperatorFormula() ? std::max(0.05, 0.05 * expected) : 0.02;
+        EXPECT_NEAR(expected, checker.check(task)->asExplicitQuantitativeCheckResult<double>()[initialState], tolerance);
+        EXPECT_NEAR(expected, programChecker.check(task)->asExplicitQuantitativeCheckResult<double>()[0], tolerance);
+    }
+}
+
+TEST(StatisticalModelCheckerTest, ReproducibleWithSequentialCriteria) {
+    // The number of paths for the confidence interval is not known in advance, but the batches are merged in order, so
+    // the result for a fixed seed does not depend on the number of threads.
+    std::string formulasString = "R{\"coin_flips\"}=? [F \"done\"]";
+    formulasString += "; P>0.1 [F \"one\"]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Dtmc<double>>();
+    uint64_t initialState = *model->getInitialStates().begin();
+
+    auto sequentialOptions = getOptions();
+    sequentialOptions.batchSize = 10;
+    auto parallelOptions = getOptions(4);
+    parallelOptions.batchSize = 10;
+    storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> sequentialChecker(*model, sequentialOptions);
+    storm::modelchecker::statistical::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> parallelChecker(*model, parallelOptions);
+
+    storm::modelchecker::CheckTask<> rewardTask(*formulas[0], true);
+    double sequentialResult = sequentialChecker.check(rewardTask)->asExplicitQuantitativeCheckResult<double>()[initialState];
+    for (uint64_t run = 0; run < 3; ++run) {
+        EXPECT_EQ(sequentialResult, parallelChecker.check(rewardTask)->asExplicitQuantitativeCheckResult<double>()[initialState]);
+    }
+
+    storm::modelchecker::CheckTask<> boundTask(*formulas[1], true);
+    EXPECT_TRUE(sequentialChecker.check(boundTask)->asExplicitQualitativeCheckResult()[initialState]);
+    EXPECT_TRUE(parallelChecker.check(boundTask)->asExplicitQualitativeCheckResult()[initialState]);
+}
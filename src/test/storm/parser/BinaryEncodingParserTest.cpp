@@ -0,0 +1,129 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Model<double>> exportAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model,
+                                                                     std::string const& filename) {
+    std::string const path = (std::filesystem::temp_directory_path() / filename).string();
+    {
+        std::ofstream stream(path, std::ios::binary);
+        storm::exporter::binaryExportSparseModel(stream, model);
+    }
+    auto result = storm::parser::BinaryEncodingParser<double>::parseModel(path);
+    std::remove(path.c_str());
+    return result;
+}
+
+// Writes the header of a binary encoded DTMC with the given numbers of states, choices and transitions, followed by the given numbers.
+void writeCorruptDtmc(std::string const& path, uint64_t stateCount, uint64_t choiceCount, uint64_t entryCount, std::vector<uint64_t> const& numbers) {
+    std::ofstream stream(path, std::ios::binary);
+    stream.write(storm::exporter::binaryEncodingMagic, sizeof(storm::exporter::binaryEncodingMagic));
+    std::vector<uint64_t> header = {storm::exporter::binaryEncodingVersion, sizeof(double), static_cast<uint64_t>(storm::models::ModelType::Dtmc),
+                                    stateCount, choiceCount, entryCount};
+    header.insert(header.end(), numbers.begin(), numbers.end());
+    stream.write(reinterpret_cast<char const*>(header.data()), header.size() * sizeof(uint64_t));
+}
+
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    EXPECT_EQ(expected.getType(), actual.getType());
+    EXPECT_EQ(expected.getTransitionMatrix(), actual.getTransitionMatrix());
+    EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling());
+    ASSERT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling());
+    if (expected.hasChoiceLabeling()) {
+        EXPECT_EQ(expected.getChoiceLabeling(), actual.getChoiceLabeling());
+    }
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasTransitionRewards(), actualRewardModel.hasTransitionRewards());
+        if (rewardModel.second.hasTransitionRewards()) {
+            EXPECT_EQ(rewardModel.second.getTransitionRewardMatrix(), actualRewardModel.getTransitionRewardMatrix());
+        }
+    }
+}
+}  // namespace
+
+TEST(BinaryEncodingParserTest, DtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto parsedModel = exportAndParse(model, "storm-test-crowds.drb");
+    expectEqualModels(*model, *parsedModel);
+    EXPECT_EQ(8607ul, parsedModel->getNumberOfStates());
+    EXPECT_EQ(15113ul, parsedModel->getNumberOfTransitions());
+}
+
+TEST(BinaryEncodingParserTest, MdpRoundTrip) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", options);
+    auto parsedModel = exportAndParse(model, "storm-test-two_dice.drb");
+    expectEqualModels(*model, *parsedModel);
+    EXPECT_TRUE(parsedModel->hasRewardModel("coinflips"));
+    EXPECT_TRUE(parsedModel->getRewardModel("coinflips").hasStateActionRewards());
+}
+
+TEST(BinaryEncodingParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto parsedModel = exportAndParse(model, "storm-test-cluster2.drb");
+    expectEqualModels(*model, *parsedModel);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(),
+              parsedModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+}
+
+TEST(BinaryEncodingParserTest, MaRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto parsedModel = exportAndParse(model, "storm-test-jobscheduler.drb");
+    expectEqualModels(*model, *parsedModel);
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto parsedMa = parsedModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getExitRates(), parsedMa->getExitRates());
+    EXPECT_EQ(ma->getMarkovianStates(), parsedMa->getMarkovianStates());
+}
+
+TEST(BinaryEncodingParserTest, WrongFormat) {
+    std::string const path = (std::filesystem::temp_directory_path() / "storm-test-wrong-format.drb").string();
+    {
+        std::ofstream stream(path, std::ios::binary);
+        stream << "@type: dtmc\n";
+    }
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(path), storm::exceptions::WrongFormatException);
+    std::remove(path.c_str());
+}
+
+TEST(BinaryEncodingParserTest, CorruptSectionSize) {
+    std::string const path = (std::filesystem::temp_directory_path() / "storm-test-corrupt-section.drb").string();
+    // The row indications of the matrix are declared to take several terabytes, but the file ends right after the declaration.
+    uint64_t const stateCount = 1ull << 40;
+    writeCorruptDtmc(path, stateCount, stateCount, 0, {0, (stateCount + 1) * sizeof(uint64_t)});
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(path), storm::exceptions::WrongFormatException);
+    std::remove(path.c_str());
+}
+
+TEST(BinaryEncodingParserTest, CorruptRowGroups) {
+    std::string const path = (std::filesystem::temp_directory_path() / "storm-test-corrupt-row-groups.drb").string();
+    // The row group indices start at zero and end at the number of choices, but are not monotone.
+    writeCorruptDtmc(path, 2, 2, 0, {1, 3 * sizeof(uint64_t), 0, 3, 2});
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(path), storm::exceptions::WrongFormatException);
+    std::remove(path.c_str());
+}
@@ -87,3 +87,42 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_TRUE(modelPtr->hasLabel("one_job_finished"));
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    std::vector<std::string> files = {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn",
+                                      STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn", STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn"};
+    storm::parser::DirectEncodingParserOptions sequentialOptions;
+    sequentialOptions.buildChoiceLabeling = true;
+    storm::parser::DirectEncodingParserOptions parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+    for (auto const& file : files) {
+        auto expected = storm::parser::DirectEncodingParser<double>::parseModel(file, sequentialOptions);
+        auto actual = storm::parser::DirectEncodingParser<double>::parseModel(file, parallelOptions);
+        ASSERT_EQ(expected->getType(), actual->getType()) << file;
+        EXPECT_EQ(expected->getTransitionMatrix(), actual->getTransitionMatrix()) << file;
+        EXPECT_EQ(expected->getStateLabeling(), actual->getStateLabeling()) << file;
+        ASSERT_EQ(expected->hasChoiceLabeling(), actual->hasChoiceLabeling()) << file;
+        if (expected->hasChoiceLabeling()) {
+            EXPECT_EQ(expected->getChoiceLabeling(), actual->getChoiceLabeling()) << file;
+        }
+        ASSERT_EQ(expected->getNumberOfRewardModels(), actual->getNumberOfRewardModels()) << file;
+        for (auto const& rewardModel : expected->getRewardModels()) {
+            ASSERT_TRUE(actual->hasRewardModel(rewardModel.first)) << file;
+            auto const& actualRewardModel = actual->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards()) << file;
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector()) << file;
+            }
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards()) << file;
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+        if (expected->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            auto ma = expected->as<storm::models::sparse::MarkovAutomaton<double>>();
+            auto parsedMa = actual->as<storm::models::sparse::MarkovAutomaton<double>>();
+            EXPECT_EQ(ma->getExitRates(), parsedMa->getExitRates()) << file;
+            EXPECT_EQ(ma->getMarkovianStates(), parsedMa->getMarkovianStates()) << file;
+        }
+    }
+}
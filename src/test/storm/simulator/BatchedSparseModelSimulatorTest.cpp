@@ -0,0 +1,128 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/builder.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/simulator/BatchedSparseModelSimulator.h"
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Model<double>> buildModel(std::string const& path) {
+    storm::prism::Program program = storm::api::parseProgram(path);
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels();
+    options.setBuildAllLabels();
+    return storm::api::buildSparseModel<double>(program, options);
+}
+}  // namespace
+
+TEST(BatchedSparseModelSimulatorTest, KnuthYaoDie) {
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::storage::BitVector const& doneStates = model->getStates("done");
+    storm::storage::BitVector const& oneStates = model->getStates("one");
+
+    uint64_t const numberOfTrajectories = 20000;
+    storm::simulator::BatchedSparseModelSimulator<double> simulator(*model, numberOfTrajectories, 2);
+    simulator.setSeed(42);
+    EXPECT_EQ(numberOfTrajectories, simulator.getNumberOfTrajectories());
+    EXPECT_EQ(0.0, simulator.getLastRewards(0)[0]);
+
+    std::vector<double> coinFlips(numberOfTrajectories, 0.0);
+    for (uint64_t step = 0; step < 100; ++step) {
+        std::vector<uint64_t> const& states = simulator.getCurrentStates();
+        for (uint64_t trajectory = 0; trajectory < numberOfTrajectories; ++trajectory) {
+            if (!doneStates.get(states[trajectory])) {
+                coinFlips[trajectory] += 1.0;
+            }
+        }
+        simulator.step(std::vector<uint64_t>(numberOfTrajectories, 0));
+    }
+
+    uint64_t numberOfOnes = 0;
+    double totalReward = 0.0;
+    for (uint64_t trajectory = 0; trajectory < numberOfTrajectories; ++trajectory) {
+        EXPECT_TRUE(doneStates.get(simulator.getCurrentStates()[trajectory]));
+        if (oneStates.get(simulator.getCurrentStates()[trajectory])) {
+            ++numberOfOnes;
+        }
+        totalReward += coinFlips[trajectory];
+    }
+    EXPECT_NEAR(1.0 / 6.0, static_cast<double>(numberOfOnes) / numberOfTrajectories, 0.01);
+    EXPECT_NEAR(11.0 / 3.0, totalReward / numberOfTrajectories, 0.05);
+
+    simulator.resetToInitial(1);
+    EXPECT_EQ(*model->getInitialStates().begin(), simulator.getCurrentStates()[1]);
+    EXPECT_TRUE(doneStates.get(simulator.getCurrentStates()[0]));
+}
+
+TEST(BatchedSparseModelSimulatorTest, Rewards) {
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::simulator::BatchedSparseModelSimulator<double> simulator(*model, 10);
+    simulator.setSeed(5);
+
+    // Each coin flip yields reward one.
+    for (uint64_t step = 0; step < 3; ++step) {
+        simulator.randomStep();
+    }
+    for (double reward : simulator.getLastRewards(0)) {
+        EXPECT_TRUE(reward == 0.0 || reward == 1.0);
+    }
+    simulator.resetToInitial();
+    for (double reward : simulator.getLastRewards(0)) {
+        EXPECT_EQ(0.0, reward);
+    }
+}
+
+TEST(BatchedSparseModelSimulatorTest, IndependentOfThreads) {
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    // Enough trajectories such that all threads are used.
+    uint64_t const numberOfTrajectories = 50000;
+    storm::simulator::BatchedSparseModelSimulator<double> sequentialSimulator(*model, numberOfTrajectories, 1);
+    storm::simulator::BatchedSparseModelSimulator<double> parallelSimulator(*model, numberOfTrajectories, 3);
+    sequentialSimulator.setSeed(7);
+    parallelSimulator.setSeed(7);
+    for (uint64_t step = 0; step < 10; ++step) {
+        sequentialSimulator.randomStep();
+        parallelSimulator.randomStep();
+        EXPECT_EQ(sequentialSimulator.getCurrentStates(), parallelSimulator.getCurrentStates());
+        EXPECT_EQ(sequentialSimulator.getLastRewards(0), parallelSimulator.getLastRewards(0));
+    }
+}
+
+TEST(BatchedSparseModelSimulatorTest, DISABLED_Throughput) {
+    // Compares the number of steps per second of the batched simulator with the single-trajectory simulator. The numbers
+    // are recorded as test properties (e.g., in the XML output). The test is disabled by default, as it only measures timings.
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    uint64_t const numberOfTrajectories = 10000;
+    uint64_t const numberOfSteps = 50;
+
+    storm::simulator::DiscreteTimeSparseModelSimulator<double> singleSimulator(*model);
+    singleSimulator.setSeed(42);
+    storm::utility::Stopwatch singleWatch(true);
+    for (uint64_t trajectory = 0; trajectory < numberOfTrajectories; ++trajectory) {
+        singleSimulator.resetToInitial();
+        for (uint64_t step = 0; step < numberOfSteps; ++step) {
+            singleSimulator.step(0);
+        }
+    }
+    singleWatch.stop();
+
+    storm::simulator::BatchedSparseModelSimulator<double> batchedSimulator(*model, numberOfTrajectories);
+    batchedSimulator.setSeed(42);
+    std::vector<uint64_t> actions(numberOfTrajectories, 0);
+    storm::utility::Stopwatch batchedWatch(true);
+    for (uint64_t step = 0; step < numberOfSteps; ++step) {
+        batchedSimulator.step(actions);
+    }
+    batchedWatch.stop();
+
+    double const totalSteps = static_cast<double>(numberOfTrajectories * numberOfSteps);
+    RecordProperty("SingleStepsPerSecond", std::to_string(totalSteps * 1e9 / std::max<int64_t>(1, singleWatch.getTimeInNanoseconds())));
+    RecordProperty("BatchedStepsPerSecond", std::to_string(totalSteps * 1e9 / std::max<int64_t>(1, batchedWatch.getTimeInNanoseconds())));
+    EXPECT_EQ(numberOfTrajectories, batchedSimulator.getCurrentStates().size());
+}
@@ -10,6 +10,9 @@
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/SparseMatrix.h"
 
+#include <map>
+#include <random>
+
 namespace {
 
 class DoubleViEnvironment {
@@ -76,6 +79,21 @@ class DoubleTopologicalViEnvironment {
     }
 };
 
+class DoubleTopologicalParallelViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().topological().setNumberOfThreads(4);
+        env.solver().topological().setColoredGaussSeidel(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class DoubleTopologicalCudaViEnvironment {
    public:
     typedef double ValueType;
@@ -111,6 +129,27 @@ class RationalPIEnvironment {
         return env;
     }
 };
+class DoubleMixedPrecisionEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::MixedPrecision);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+class RationalMixedPrecisionEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::MixedPrecision);
+        return env;
+    }
+};
 class RationalRationalSearchEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -142,8 +181,8 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<DoubleViEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment,
-                         DoubleTopologicalViEnvironment, DoubleTopologicalCudaViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
-                         RationalRationalSearchEnvironment>
+                         DoubleTopologicalViEnvironment, DoubleTopologicalParallelViEnvironment, DoubleTopologicalCudaViEnvironment, DoublePIEnvironment,
+                         RationalPIEnvironment, DoubleMixedPrecisionEnvironment, RationalMixedPrecisionEnvironment, RationalRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -175,4 +214,81 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TEST(TopologicalMinMaxLinearEquationSolverTest, ConcurrentSccs) {
+    // Build a system with many small SCCs that form a wide DAG and one large SCC that depends on all of them.
+    uint64_t const numberOfSmallSccs = 300;
+    uint64_t const smallSccSize = 4;
+    uint64_t const largeSccSize = 3000;
+    uint64_t const numberOfStates = numberOfSmallSccs * smallSccSize + largeSccSize;
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> value(0.1, 1.0);
+    std::uniform_int_distribution<uint64_t> smallScc(0, numberOfSmallSccs - 1);
+    std::uniform_int_distribution<uint64_t> largeSccState(numberOfSmallSccs * smallSccSize, numberOfStates - 1);
+
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfStates, 0, false, true);
+    std::vector<double> b;
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 2; ++choice, ++row) {
+            std::map<uint64_t, double> successors;
+            if (state < numberOfSmallSccs * smallSccSize) {
+                uint64_t scc = state / smallSccSize;
+                successors[scc * smallSccSize + (state + 1) % smallSccSize] = value(generator);
+                // Depend on an SCC with a lower index (if there is one).
+                if (scc > 0 && choice == 1) {
+                    successors[(scc / 2) * smallSccSize] = value(generator);
+                }
+            } else {
+                uint64_t next = state + 1 == numberOfStates ? numberOfSmallSccs * smallSccSize : state + 1;
+                successors[next] = value(generator);
+                successors[largeSccState(generator)] += value(generator);
+                successors[smallScc(generator) * smallSccSize] += value(generator);
+            }
+            double sum = 0.0;
+            for (auto const& successor : successors) {
+                sum += successor.second;
+            }
+            for (auto const& successor : successors) {
+                builder.addNextValue(row, successor.first, 0.9 * successor.second / sum);
+            }
+            b.push_back(0.1 * value(generator));
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    storm::Environment sequentialEnv;
+    sequentialEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+    sequentialEnv.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+    sequentialEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    storm::Environment concurrentEnv = sequentialEnv;
+    concurrentEnv.solver().topological().setNumberOfThreads(4);
+    storm::Environment coloredEnv = concurrentEnv;
+    coloredEnv.solver().topological().setColoredGaussSeidel(true);
+
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<std::vector<double>> results;
+        std::vector<std::vector<uint64_t>> schedulers;
+        for (auto const* env : {&sequentialEnv, &concurrentEnv, &coloredEnv}) {
+            auto solver = factory.create(*env, A);
+            solver->setHasUniqueSolution(true);
+            solver->setHasNoEndComponents(true);
+            solver->setBounds(0.0, 1.0);
+            solver->setTrackScheduler(true);
+            std::vector<double> x(numberOfStates, 0.0);
+            ASSERT_TRUE(solver->solveEquations(*env, dir, x, b));
+            results.push_back(std::move(x));
+            schedulers.push_back(solver->getSchedulerChoices());
+        }
+        // Solving the SCCs concurrently does not change the result.
+        EXPECT_EQ(results[0], results[1]);
+        EXPECT_EQ(schedulers[0], schedulers[1]);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(results[0][state], results[2][state], 1e-8);
+        }
+        EXPECT_EQ(schedulers[0], schedulers[2]);
+    }
+}
 }  // namespace
@@ -19,6 +19,30 @@ class NativeEnvironment {
     }
 };
 
+class NativeCompactEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setCompactStorage(true);
+        return env;
+    }
+};
+
+class NativeVectorizedEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setVectorize(true);
+        return env;
+    }
+};
+
 class GmmxxEnvironment {
    public:
     typedef double ValueType;
@@ -49,7 +73,7 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, NativeCompactEnvironment, NativeVectorizedEnvironment, GmmxxEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -76,6 +100,13 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyTest) {
     auto multiplier = factory.create(this->env(), A);
     ASSERT_NO_THROW(multiplier->repeatedMultiply(this->env(), x, nullptr, 4));
     EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
+
+    // Clearing the cache drops cached data (such as the compact copy of the matrix), which has to be recreated on demand.
+    multiplier->clearCache();
+    x = std::vector<ValueType>(5);
+    x[4] = this->parseNumber("1");
+    ASSERT_NO_THROW(multiplier->repeatedMultiply(this->env(), x, nullptr, 4));
+    EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
 }
 
 TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
@@ -0,0 +1,224 @@
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "test/storm_gtest.h"
+
+#include <limits>
+#include <random>
+#include <set>
+
+namespace {
+storm::storage::SparseMatrix<double> createRandomMatrix(uint64_t numberOfRowGroups, uint64_t seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<uint64_t> rowsPerGroup(1, 3);
+    std::uniform_int_distribution<uint64_t> entriesPerRow(1, 5);
+    std::uniform_int_distribution<uint64_t> column(0, numberOfRowGroups - 1);
+    std::uniform_real_distribution<double> value(0.0, 1.0);
+
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfRowGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t groupRow = 0, groupSize = rowsPerGroup(generator); groupRow < groupSize; ++groupRow, ++row) {
+            std::set<uint64_t> columns;
+            for (uint64_t entry = 0, rowSize = entriesPerRow(generator); entry < rowSize; ++entry) {
+                columns.insert(column(generator));
+            }
+            for (auto const& entryColumn : columns) {
+                builder.addNextValue(row, entryColumn, value(generator));
+            }
+        }
+    }
+    return builder.build();
+}
+}  // namespace
+
+TEST(CompactSparseMatrix, Creation) {
+    storm::storage::SparseMatrix<double> matrix = createRandomMatrix(100, 1);
+
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    EXPECT_EQ(matrix.getRowCount(), compactMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), compactMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), compactMatrix.getEntryCount());
+    EXPECT_TRUE(compactMatrix.hasNarrowColumnIndices());
+
+    storm::storage::CompactSparseMatrix<double> wideMatrix(matrix, false);
+    EXPECT_FALSE(wideMatrix.hasNarrowColumnIndices());
+    EXPECT_LT(compactMatrix.getSizeInMemory(), wideMatrix.getSizeInMemory());
+}
+
+TEST(CompactSparseMatrix, VectorizationRequiresSignedColumnIndices) {
+    // Column indices of 2^31 and more still fit into 32 bits, but the gathers of the vectorized kernels would interpret
+    // them as negative offsets.
+    uint64_t const largeColumn = static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) + 1;
+    storm::storage::SparseMatrixBuilder<double> builder(2, largeColumn + 1, 2, true);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(1, largeColumn, 0.5);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+
+    EXPECT_TRUE(storm::storage::detail::canUseVectorizedKernels(largeColumn));
+    EXPECT_FALSE(storm::storage::detail::canUseVectorizedKernels(largeColumn + 1));
+
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, true, true);
+    EXPECT_TRUE(compactMatrix.hasNarrowColumnIndices());
+    EXPECT_EQ(storm::storage::detail::SimdInstructionSet::None, compactMatrix.getVectorization());
+}
+
+TEST(CompactSparseMatrix, MatrixVectorMultiply) {
+    storm::storage::SparseMatrix<double> matrix = createRandomMatrix(500, 2);
+    std::vector<double> x(matrix.getColumnCount());
+    std::vector<double> b(matrix.getRowCount());
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> value(0.0, 1.0);
+    for (auto& entry : x) {
+        entry = value(generator);
+    }
+    for (auto& entry : b) {
+        entry = value(generator);
+    }
+
+    for (bool narrow : {true, false}) {
+        storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, narrow);
+        std::vector<double> expected(matrix.getRowCount());
+        std::vector<double> result(matrix.getRowCount());
+
+        matrix.multiplyWithVector(x, expected, &b);
+        compactMatrix.multiplyWithVectorForward(x, result, &b);
+        EXPECT_EQ(expected, result);
+
+        matrix.multiplyWithVectorBackward(x, expected);
+        compactMatrix.multiplyWithVectorBackward(x, result);
+        EXPECT_EQ(expected, result);
+
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            double rowResult = 0.0;
+            compactMatrix.multiplyRowWithVector(row, x, rowResult);
+            EXPECT_EQ(matrix.multiplyRowWithVector(row, x), rowResult);
+        }
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = createRandomMatrix(500, 4);
+    std::vector<double> b(matrix.getRowCount());
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> value(0.0, 1.0);
+    for (auto& entry : b) {
+        entry = value(generator);
+    }
+    std::vector<double> initialX(matrix.getColumnCount());
+    for (auto& entry : initialX) {
+        entry = value(generator);
+    }
+
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount());
+        std::vector<double> result(matrix.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), initialX, &b, expected, &expectedChoices);
+        compactMatrix.multiplyAndReduceForward(dir, matrix.getRowGroupIndices(), initialX, &b, result, &choices);
+        EXPECT_EQ(expected, result);
+        EXPECT_EQ(expectedChoices, choices);
+
+        // Gauss-Seidel style multiplications operate in-place.
+        std::vector<double> expectedX = initialX;
+        std::vector<double> x = initialX;
+        matrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), expectedX, nullptr, expectedX, &expectedChoices);
+        compactMatrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), x, nullptr, x, &choices);
+        EXPECT_EQ(expectedX, x);
+        EXPECT_EQ(expectedChoices, choices);
+
+        matrix.multiplyAndReduceForward(dir, matrix.getRowGroupIndices(), expectedX, &b, expectedX, &expectedChoices);
+        compactMatrix.multiplyAndReduceForward(dir, matrix.getRowGroupIndices(), x, &b, x, &choices);
+        EXPECT_EQ(expectedX, x);
+        EXPECT_EQ(expectedChoices, choices);
+    }
+}
+
+TEST(CompactSparseMatrix, VectorizedKernels) {
+    auto supportedInstructionSet = storm::storage::detail::getSupportedSimdInstructionSet();
+    if (supportedInstructionSet == storm::storage::detail::SimdInstructionSet::None) {
+        GTEST_SKIP() << "No vectorized kernels are available for this CPU.";
+    }
+
+    // Use rows with more entries to exercise the vectorized loops including their remainders.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 300, 0, false, true);
+    std::mt19937 generator(6);
+    std::uniform_int_distribution<uint64_t> rowsPerGroup(1, 3);
+    std::uniform_int_distribution<uint64_t> entriesPerRow(1, 40);
+    std::uniform_int_distribution<uint64_t> column(0, 299);
+    std::uniform_real_distribution<double> value(0.0, 1.0);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < 300; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t groupRow = 0, groupSize = rowsPerGroup(generator); groupRow < groupSize; ++groupRow, ++row) {
+            std::set<uint64_t> columns;
+            for (uint64_t entry = 0, rowSize = entriesPerRow(generator); entry < rowSize; ++entry) {
+                columns.insert(column(generator));
+            }
+            for (auto const& entryColumn : columns) {
+                builder.addNextValue(row, entryColumn, value(generator));
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    std::vector<double> x(matrix.getColumnCount());
+    for (auto& entry : x) {
+        entry = value(generator);
+    }
+    std::vector<double> b(matrix.getRowCount());
+    for (auto& entry : b) {
+        entry = value(generator);
+    }
+
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, true, true);
+    EXPECT_EQ(supportedInstructionSet, compactMatrix.getVectorization());
+    std::vector<double> expected(matrix.getRowCount());
+    std::vector<double> result(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    compactMatrix.multiplyWithVectorForward(x, result, &b);
+    for (uint64_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(expected[i], result[i], 1e-12);
+    }
+
+    // Test all instruction sets that are supported by the CPU.
+    storm::storage::CompactSparseMatrix<double> scalarMatrix(matrix);
+    for (auto instructionSet : {storm::storage::detail::SimdInstructionSet::Avx2, storm::storage::detail::SimdInstructionSet::Avx512}) {
+        if (instructionSet > supportedInstructionSet) {
+            continue;
+        }
+        std::vector<uint64_t> rowIndications = {0};
+        std::vector<double> values;
+        std::vector<uint32_t> columns;
+        for (uint64_t matrixRow = 0; matrixRow < matrix.getRowCount(); ++matrixRow) {
+            for (auto const& entry : matrix.getRow(matrixRow)) {
+                values.push_back(entry.getValue());
+                columns.push_back(entry.getColumn());
+            }
+            rowIndications.push_back(values.size());
+        }
+        storm::storage::detail::CompactMatrixView view{rowIndications.data(), values.data(), columns.data()};
+
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<double> expectedX = x;
+            std::vector<double> resultX = x;
+            std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+            std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+            for (bool backward : {false, true}) {
+                if (backward) {
+                    scalarMatrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), expectedX, &b, expectedX, &expectedChoices);
+                } else {
+                    scalarMatrix.multiplyAndReduceForward(dir, matrix.getRowGroupIndices(), expectedX, &b, expectedX, &expectedChoices);
+                }
+                storm::storage::detail::multiplyAndReduceGroupsVectorized(instructionSet, dir, view, matrix.getRowGroupIndices(), 0,
+                                                                          matrix.getRowGroupCount(), resultX, &b, resultX, &choices, backward);
+                for (uint64_t i = 0; i < expectedX.size(); ++i) {
+                    EXPECT_NEAR(expectedX[i], resultX[i], 1e-12 * expectedX[i]);
+                }
+                EXPECT_EQ(expectedChoices, choices);
+            }
+        }
+    }
+}
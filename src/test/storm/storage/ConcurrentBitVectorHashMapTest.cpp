@@ -0,0 +1,147 @@
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+storm::storage::BitVector createKey(uint64_t bucketSize, uint64_t value) {
+    storm::storage::BitVector key(bucketSize);
+    key.setFromInt(0, 64, value);
+    key.setFromInt(bucketSize - 64, 64, value * 31 + 7);
+    return key;
+}
+}  // namespace
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    EXPECT_EQ(std::make_pair(0ul, true), map.findOrAdd(first));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    EXPECT_EQ(std::make_pair(1ul, true), map.findOrAdd(second));
+
+    EXPECT_EQ(std::make_pair(0ul, false), map.findOrAdd(first));
+    EXPECT_EQ(std::make_pair(1ul, false), map.findOrAdd(second));
+
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    EXPECT_FALSE(map.contains(third));
+    EXPECT_FALSE(map.find(third).first);
+    EXPECT_EQ(std::make_pair(2ul, true), map.findOrAdd(third));
+    EXPECT_EQ(std::make_pair(true, 2ul), map.find(third));
+
+    EXPECT_EQ(3ul, map.size());
+    EXPECT_EQ(first, map.getKey(0));
+    EXPECT_EQ(second, map.getKey(1));
+    EXPECT_EQ(third, map.getKey(2));
+}
+
+TEST(ConcurrentBitVectorHashMapTest, Resize) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 1);
+    uint64_t const numberOfKeys = 100000;
+    for (uint64_t value = 0; value < numberOfKeys; ++value) {
+        EXPECT_EQ(std::make_pair(static_cast<uint32_t>(value), true), map.findOrAdd(createKey(128, value)));
+    }
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_LE(numberOfKeys, map.capacity());
+    for (uint64_t value = 0; value < numberOfKeys; ++value) {
+        EXPECT_EQ(std::make_pair(true, static_cast<uint32_t>(value)), map.find(createKey(128, value)));
+        EXPECT_EQ(createKey(128, value), map.getKey(value));
+    }
+    EXPECT_FALSE(map.contains(createKey(128, numberOfKeys)));
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 1);
+    uint64_t const numberOfThreads = 8;
+    uint64_t const numberOfKeys = 200000;
+
+    // All threads insert the same keys (in different orders), so every key is found or added by every thread.
+    std::vector<std::vector<uint64_t>> indices(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+    std::vector<uint64_t> insertions(numberOfThreads, 0);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            std::vector<uint64_t> values(numberOfKeys);
+            std::iota(values.begin(), values.end(), 0);
+            std::shuffle(values.begin(), values.end(), std::mt19937(thread));
+            for (auto value : values) {
+                auto indexAndInserted = map.findOrAdd(createKey(128, value));
+                indices[thread][value] = indexAndInserted.first;
+                if (indexAndInserted.second) {
+                    ++insertions[thread];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_EQ(numberOfKeys, std::accumulate(insertions.begin(), insertions.end(), 0ul));
+    storm::storage::BitVector usedIndices(numberOfKeys);
+    for (uint64_t value = 0; value < numberOfKeys; ++value) {
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            ASSERT_EQ(indices[0][value], indices[thread][value]);
+        }
+        ASSERT_LT(indices[0][value], numberOfKeys);
+        EXPECT_FALSE(usedIndices.get(indices[0][value]));
+        usedIndices.set(indices[0][value]);
+        EXPECT_EQ(createKey(128, value), map.getKey(indices[0][value]));
+    }
+}
+
+// A micro benchmark comparing the concurrent map to the sequential BitVectorHashMap. It is disabled by default and
+// can be run with --gtest_also_run_disabled_tests. Increase the number of keys to evaluate larger state spaces.
+TEST(ConcurrentBitVectorHashMapTest, DISABLED_Benchmark) {
+    uint64_t const numberOfKeys = 10000000;
+    uint64_t const bucketSize = 128;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    {
+        storm::storage::BitVectorHashMap<uint64_t> map(bucketSize);
+        for (uint64_t value = 0; value < numberOfKeys; ++value) {
+            map.findOrAdd(createKey(bucketSize, value), value);
+        }
+        EXPECT_EQ(numberOfKeys, map.size());
+    }
+    auto sequentialTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    std::cout << "BitVectorHashMap: inserted " << numberOfKeys << " keys in " << sequentialTime << "ms.\n";
+
+    uint64_t const maxNumberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (uint64_t numberOfThreads = 1; numberOfThreads <= maxNumberOfThreads; numberOfThreads *= 2) {
+        start = std::chrono::high_resolution_clock::now();
+        storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(bucketSize);
+        std::vector<std::thread> threads;
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            threads.emplace_back([&, thread]() {
+                for (uint64_t value = thread; value < numberOfKeys; value += numberOfThreads) {
+                    map.findOrAdd(createKey(bucketSize, value));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(numberOfKeys, map.size());
+        auto concurrentTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        std::cout << "ConcurrentBitVectorHashMap (" << numberOfThreads << " threads): inserted " << numberOfKeys << " keys in " << concurrentTime
+                  << "ms.\n";
+    }
+}
@@ -126,3 +126,34 @@ TEST(DeterministicModelBisimulationDecomposition, Crowds) {
     EXPECT_EQ(65ul, result->getNumberOfStates());
     EXPECT_EQ(105ul, result->getNumberOfTransitions());
 }
+
+TEST(DeterministicModelBisimulationDecomposition, CrowdsSignatureRefinement) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options;
+    options.signatureRefinement = true;
+    options.numberOfThreads = 4;
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim(*dtmc, options);
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+    EXPECT_EQ(334ul, result->getNumberOfStates());
+    EXPECT_EQ(546ul, result->getNumberOfTransitions());
+
+    options.respectedAtomicPropositions = std::set<std::string>({"observe0Greater1"});
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim2(*dtmc, options);
+    ASSERT_NO_THROW(bisim2.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim2.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+    EXPECT_EQ(65ul, result->getNumberOfStates());
+    EXPECT_EQ(105ul, result->getNumberOfTransitions());
+}
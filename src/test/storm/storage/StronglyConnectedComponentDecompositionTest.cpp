@@ -6,6 +6,10 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "test/storm_gtest.h"
 
+#include <map>
+#include <random>
+#include <set>
+
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
@@ -90,3 +94,79 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, Parallel) {
+    // A random graph with a large SCC, chains and many small SCCs.
+    uint64_t const numberOfStates = 50000;
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<uint64_t> state(0, numberOfStates - 1);
+    std::uniform_int_distribution<uint64_t> choiceCount(1, 2);
+    std::uniform_int_distribution<uint64_t> localOffset(1, 20);
+    std::bernoulli_distribution globalSuccessor(0.02);
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfStates, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t currentState = 0; currentState < numberOfStates; ++currentState) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0, choices = choiceCount(generator); choice < choices; ++choice, ++row) {
+            std::set<uint64_t> successors = {currentState < numberOfStates / 2 ? (currentState + localOffset(generator)) % numberOfStates
+                                                                              : currentState / 2 + localOffset(generator)};
+            if (globalSuccessor(generator)) {
+                successors.insert(state(generator));
+            }
+            for (auto const& successor : successors) {
+                builder.addNextValue(row, successor, 1.0 / successors.size());
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    storm::storage::BitVector choices(matrix.getRowCount(), true);
+    for (uint64_t index = 0; index < numberOfStates / 10; ++index) {
+        subsystem.set(state(generator), false);
+        choices.set(state(generator) % matrix.getRowCount(), false);
+    }
+
+    auto checkEqual = [&](storm::storage::StronglyConnectedComponentDecompositionOptions options) {
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequential(matrix, options);
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallel(matrix, options.threads(4));
+        ASSERT_EQ(sequential.size(), parallel.size());
+
+        // Both decompositions contain the same SCCs (possibly in a different order).
+        std::map<std::vector<uint64_t>, uint64_t> sequentialSccs;
+        for (uint64_t sccIndex = 0; sccIndex < sequential.size(); ++sccIndex) {
+            sequentialSccs[std::vector<uint64_t>(sequential[sccIndex].begin(), sequential[sccIndex].end())] = sccIndex;
+        }
+        std::vector<uint64_t> stateToScc(numberOfStates, numberOfStates);
+        for (uint64_t sccIndex = 0; sccIndex < parallel.size(); ++sccIndex) {
+            auto it = sequentialSccs.find(std::vector<uint64_t>(parallel[sccIndex].begin(), parallel[sccIndex].end()));
+            ASSERT_TRUE(it != sequentialSccs.end());
+            EXPECT_EQ(sequential[it->second].isTrivial(), parallel[sccIndex].isTrivial());
+            if (sequential.hasSccDepth()) {
+                EXPECT_EQ(sequential.getSccDepth(it->second), parallel.getSccDepth(sccIndex));
+            }
+            for (auto const& sccState : parallel[sccIndex]) {
+                stateToScc[sccState] = sccIndex;
+            }
+        }
+
+        // The SCCs are sorted topologically.
+        for (uint64_t sccState = 0; !options.choicesPtr && sccState < numberOfStates; ++sccState) {
+            if (stateToScc[sccState] == numberOfStates || (options.subsystemPtr && !options.subsystemPtr->get(sccState))) {
+                continue;
+            }
+            for (auto const& entry : matrix.getRowGroup(sccState)) {
+                if (stateToScc[entry.getColumn()] != numberOfStates) {
+                    EXPECT_LE(stateToScc[entry.getColumn()], stateToScc[sccState]);
+                }
+            }
+        }
+    };
+
+    checkEqual(storm::storage::StronglyConnectedComponentDecompositionOptions());
+    checkEqual(storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths());
+    checkEqual(storm::storage::StronglyConnectedComponentDecompositionOptions().dropNaiveSccs());
+    checkEqual(storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs());
+    checkEqual(storm::storage::StronglyConnectedComponentDecompositionOptions().subsystem(&subsystem).computeSccDepths());
+    checkEqual(storm::storage::StronglyConnectedComponentDecompositionOptions().subsystem(&subsystem).choices(&choices).dropNaiveSccs());
+}
@@ -12,6 +12,7 @@
 #include "storm/storage/BitVector.h"
 #include "storm/transformer/DAProductBuilder.h"
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -135,3 +136,72 @@ TEST(DAProductBuilderTest_aWb, Dtmc) {
     scc.insert(12);
     ASSERT_EQ(product->getAcceptance()->isAccepting(scc), false);
 }
+
+TEST(DAProductBuilderTest_aUb, ProductStructure) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    auto dtmc = std::dynamic_pointer_cast<storm::models::sparse::Dtmc<double>>(model);
+
+    std::string aUb =
+        "HOA: v1\n"
+        "States: 3\n"
+        "Start: 0\n"
+        "acc-name: Rabin 1\n"
+        "Acceptance: 2 (Fin(0) & Inf(1))\n"
+        "AP: 2 \"a\" \"b\""
+        "--BODY--\n"
+        "State: 0 \"a U b\" \n { 0 }\n"
+        "  2  /* !a  & !b */\n"
+        "  0  /*  a  & !b */\n"
+        "  1  /* !a  &  b */\n"
+        "  1  /*  a  &  b */\n"
+        "State: 1 { 1 }\n"
+        "  1 1 1 1       /* four transitions on one line */\n"
+        "State: 2 \"sink state\" { 0 }\n"
+        "  2 2 2 2\n"
+        "--END--\n";
+
+    std::istringstream in = std::istringstream(aUb);
+    storm::automata::DeterministicAutomaton::ptr da;
+    ASSERT_NO_THROW(da = storm::automata::DeterministicAutomaton::parse(in));
+
+    std::vector<storm::storage::BitVector> apLabels;
+    storm::storage::BitVector apA(dtmc->getNumberOfStates(), true);
+    apA.set(2, false);
+    storm::storage::BitVector apB(dtmc->getNumberOfStates(), false);
+    apB.set(7);
+    apLabels.push_back(apA);
+    apLabels.push_back(apB);
+
+    storm::transformer::DAProductBuilder productBuilder(*da, apLabels);
+    auto product = productBuilder.build(*dtmc, storm::storage::BitVector(dtmc->getNumberOfStates(), true));
+
+    // Every product state mirrors the transitions of its model state, with the successors lifted along the automaton.
+    auto const& productMatrix = product->getProductModel().getTransitionMatrix();
+    auto const& modelMatrix = dtmc->getTransitionMatrix();
+    for (uint64_t productState = 0; productState < productMatrix.getRowCount(); ++productState) {
+        auto modelState = product->getModelState(productState);
+        auto automatonState = product->getAutomatonState(productState);
+        ASSERT_TRUE(product->isValidProductState(modelState, automatonState));
+        EXPECT_EQ(productState, product->getProductStateIndex(modelState, automatonState));
+
+        auto productRow = productMatrix.getRow(productState);
+        auto modelRow = modelMatrix.getRow(modelState);
+        ASSERT_EQ(modelRow.getNumberOfEntries(), productRow.getNumberOfEntries());
+        for (auto const& entry : productRow) {
+            auto modelSuccessor = product->getModelState(entry.getColumn());
+            EXPECT_EQ(productBuilder.getSuccessor(automatonState, modelSuccessor), product->getAutomatonState(entry.getColumn()));
+            auto modelEntryIt =
+                std::find_if(modelRow.begin(), modelRow.end(), [&modelSuccessor](auto const& modelEntry) { return modelEntry.getColumn() == modelSuccessor; });
+            ASSERT_TRUE(modelEntryIt != modelRow.end());
+            EXPECT_EQ(modelEntryIt->getValue(), entry.getValue());
+        }
+    }
+
+    // Product states that are not reachable from any model state are never explored.
+    EXPECT_FALSE(product->isValidProductState(7, 0));
+    for (uint64_t modelState = 0; modelState < dtmc->getNumberOfStates(); ++modelState) {
+        EXPECT_TRUE(product->isValidProductState(modelState, productBuilder.getInitialState(modelState)));
+    }
+}
@@ -0,0 +1,185 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/transformer/DAProductBuilder.h"
+#include "storm/transformer/ImplicitDAProduct.h"
+#include "storm/utility/graph.h"
+
+#include <set>
+#include <sstream>
+
+namespace {
+typedef std::pair<uint64_t, uint64_t> ModelAndAutomatonState;
+typedef std::set<std::set<ModelAndAutomatonState>> ComponentSet;
+
+// A deterministic Buchi automaton for GF a.
+storm::automata::DeterministicAutomaton::ptr parseInfinitelyOftenAutomaton() {
+    std::istringstream in(
+        "HOA: v1\n"
+        "States: 2\n"
+        "Start: 0\n"
+        "acc-name: Buchi\n"
+        "Acceptance: 1 Inf(0)\n"
+        "AP: 1 \"a\"\n"
+        "--BODY--\n"
+        "State: 0\n"
+        "  0 1\n"
+        "State: 1 { 0 }\n"
+        "  0 1\n"
+        "--END--\n");
+    return storm::automata::DeterministicAutomaton::parse(in);
+}
+
+template<typename ProductType, typename ComponentType>
+std::set<ModelAndAutomatonState> toModelAndAutomatonStates(ProductType const& product, ComponentType const& states) {
+    std::set<ModelAndAutomatonState> result;
+    for (auto state : states) {
+        result.emplace(product.getModelState(state), product.getAutomatonState(state));
+    }
+    return result;
+}
+
+template<typename Model>
+void checkSameProductStructure(Model const& model, storm::transformer::DAProductBuilder const& productBuilder,
+                               storm::transformer::ImplicitDAProduct<double> const& implicitProduct,
+                               storm::transformer::DAProduct<Model>& explicitProduct) {
+    auto const& explicitMatrix = explicitProduct.getProductModel().getTransitionMatrix();
+    ASSERT_EQ(explicitMatrix.getRowGroupCount(), implicitProduct.getNumberOfStates());
+    ASSERT_EQ(explicitMatrix.getRowCount(), implicitProduct.getNumberOfChoices());
+    for (uint64_t state = 0; state < implicitProduct.getNumberOfStates(); ++state) {
+        uint64_t modelState = implicitProduct.getModelState(state);
+        uint64_t automatonState = implicitProduct.getAutomatonState(state);
+        ASSERT_TRUE(explicitProduct.isValidProductState(modelState, automatonState));
+        uint64_t explicitState = explicitProduct.getProductStateIndex(modelState, automatonState);
+        ASSERT_EQ(model.getTransitionMatrix().getRowGroupSize(modelState), explicitMatrix.getRowGroupSize(explicitState));
+        for (uint64_t offset = 0; offset < explicitMatrix.getRowGroupSize(explicitState); ++offset) {
+            std::set<std::pair<ModelAndAutomatonState, double>> explicitSuccessors, implicitSuccessors;
+            for (auto const& entry : explicitMatrix.getRow(explicitState, offset)) {
+                explicitSuccessors.emplace(
+                    ModelAndAutomatonState(explicitProduct.getModelState(entry.getColumn()), explicitProduct.getAutomatonState(entry.getColumn())),
+                    entry.getValue());
+            }
+            implicitProduct.forEachSuccessor(state, implicitProduct.getRowGroupIndices()[state] + offset, [&](uint64_t successor, double const& value) {
+                implicitSuccessors.emplace(ModelAndAutomatonState(implicitProduct.getModelState(successor), implicitProduct.getAutomatonState(successor)),
+                                           value);
+                EXPECT_EQ(productBuilder.getSuccessor(automatonState, implicitProduct.getModelState(successor)),
+                          implicitProduct.getAutomatonState(successor));
+            });
+            EXPECT_EQ(explicitSuccessors, implicitSuccessors);
+        }
+    }
+}
+}  // namespace
+
+TEST(ImplicitDAProductTest, DtmcBottomSccs) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto dtmc = storm::builder::ExplicitModelBuilder<double>(program).build()->as<storm::models::sparse::Dtmc<double>>();
+    auto da = parseInfinitelyOftenAutomaton();
+
+    std::vector<storm::storage::BitVector> apLabels = {dtmc->getStates("one")};
+    storm::transformer::DAProductBuilder productBuilder(*da, apLabels);
+    storm::storage::BitVector allStates(dtmc->getNumberOfStates(), true);
+    storm::transformer::ImplicitDAProduct<double> implicitProduct(dtmc->getTransitionMatrix(), productBuilder, allStates);
+    auto explicitProduct = productBuilder.build(*dtmc, allStates);
+    checkSameProductStructure(*dtmc, productBuilder, implicitProduct, *explicitProduct);
+
+    // The initial product states are the ones from which the model states of interest are lifted.
+    ASSERT_EQ(dtmc->getNumberOfStates(), implicitProduct.getInitialStates().size());
+    for (auto const& modelAndProductState : implicitProduct.getInitialStates()) {
+        EXPECT_EQ(modelAndProductState.first, implicitProduct.getModelState(modelAndProductState.second));
+        EXPECT_EQ(productBuilder.getInitialState(modelAndProductState.first), implicitProduct.getAutomatonState(modelAndProductState.second));
+    }
+
+    ComponentSet explicitBottomSccs, implicitBottomSccs;
+    storm::storage::StronglyConnectedComponentDecomposition<double> bottomSccs(
+        explicitProduct->getProductModel().getTransitionMatrix(),
+        storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs().dropNaiveSccs());
+    for (auto const& scc : bottomSccs) {
+        explicitBottomSccs.insert(toModelAndAutomatonStates(*explicitProduct, scc));
+    }
+    for (auto const& scc : implicitProduct.computeBottomSccs()) {
+        implicitBottomSccs.insert(toModelAndAutomatonStates(implicitProduct, scc));
+    }
+    EXPECT_EQ(6ull, implicitBottomSccs.size());
+    EXPECT_EQ(explicitBottomSccs, implicitBottomSccs);
+
+    // Only the bottom SCC of the model state labelled with "one" is accepting.
+    uint64_t acceptingBottomSccs = 0;
+    for (auto const& scc : implicitProduct.computeBottomSccs()) {
+        if (implicitProduct.getAcceptance()->isAccepting(scc)) {
+            ++acceptingBottomSccs;
+        }
+    }
+    EXPECT_EQ(1ull, acceptingBottomSccs);
+}
+
+TEST(ImplicitDAProductTest, MdpEndComponents) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    auto mdp = storm::builder::ExplicitModelBuilder<double>(program).build()->as<storm::models::sparse::Mdp<double>>();
+    auto da = parseInfinitelyOftenAutomaton();
+
+    std::vector<storm::storage::BitVector> apLabels = {mdp->getStates("agree")};
+    storm::transformer::DAProductBuilder productBuilder(*da, apLabels);
+    storm::transformer::ImplicitDAProduct<double> implicitProduct(mdp->getTransitionMatrix(), productBuilder, mdp->getInitialStates());
+    auto explicitProduct = productBuilder.build(*mdp, mdp->getInitialStates());
+    checkSameProductStructure(*mdp, productBuilder, implicitProduct, *explicitProduct);
+
+    auto const& explicitMatrix = explicitProduct->getProductModel().getTransitionMatrix();
+    auto explicitBackwardTransitions = explicitProduct->getProductModel().getBackwardTransitions();
+
+    // The maximal end components coincide, both in the complete product and in a restricted part.
+    std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> subsystems;
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> allStates(storm::storage::BitVector(implicitProduct.getNumberOfStates(), true),
+                                                                              storm::storage::BitVector(explicitMatrix.getRowGroupCount(), true));
+    subsystems.push_back(allStates);
+    subsystems.push_back(allStates);
+    for (uint64_t state = 0; state < implicitProduct.getNumberOfStates(); state += 3) {
+        subsystems.back().first.set(state, false);
+        subsystems.back().second.set(explicitProduct->getProductStateIndex(implicitProduct.getModelState(state), implicitProduct.getAutomatonState(state)),
+                                     false);
+    }
+    for (auto const& subsystem : subsystems) {
+        ComponentSet explicitMecs, implicitMecs;
+        for (auto const& mec : storm::storage::MaximalEndComponentDecomposition<double>(explicitMatrix, explicitBackwardTransitions, subsystem.second)) {
+            explicitMecs.insert(toModelAndAutomatonStates(*explicitProduct, mec.getStateSet()));
+        }
+        for (auto const& mec : implicitProduct.computeMaximalEndComponents(subsystem.first)) {
+            implicitMecs.insert(toModelAndAutomatonStates(implicitProduct, mec));
+        }
+        EXPECT_EQ(explicitMecs, implicitMecs);
+    }
+    EXPECT_FALSE(implicitProduct.computeMaximalEndComponents(subsystems.front().first).empty());
+
+    // The states that can reach the accepting states coincide with the graph analysis on the materialized product.
+    storm::storage::BitVector targetStates = implicitProduct.getAcceptance()->getAcceptanceSet(0);
+    storm::storage::BitVector explicitTargetStates = explicitProduct->getAcceptance()->getAcceptanceSet(0);
+    storm::storage::BitVector reachingStates = implicitProduct.computeStatesReaching(targetStates);
+    storm::storage::BitVector explicitReachingStates = storm::utility::graph::performProbGreater0E(
+        explicitBackwardTransitions, storm::storage::BitVector(explicitMatrix.getRowGroupCount(), true), explicitTargetStates);
+    EXPECT_EQ(explicitReachingStates.getNumberOfSetBits(), reachingStates.getNumberOfSetBits());
+    for (auto state : reachingStates) {
+        uint64_t explicitState = explicitProduct->getProductStateIndex(implicitProduct.getModelState(state), implicitProduct.getAutomatonState(state));
+        EXPECT_TRUE(explicitReachingStates.get(explicitState));
+    }
+
+    // The materialized part has the choices of the given states and two absorbing states.
+    storm::storage::BitVector maybeStates = reachingStates & ~targetStates;
+    auto subsystemMatrix = implicitProduct.buildSubsystemMatrix(maybeStates, targetStates);
+    ASSERT_EQ(maybeStates.getNumberOfSetBits() + 2, subsystemMatrix.getRowGroupCount());
+    uint64_t expectedNumberOfChoices = 2;
+    for (auto state : maybeStates) {
+        expectedNumberOfChoices += implicitProduct.getRowGroupIndices()[state + 1] - implicitProduct.getRowGroupIndices()[state];
+    }
+    EXPECT_EQ(expectedNumberOfChoices, subsystemMatrix.getRowCount());
+    for (uint64_t row = 0; row < subsystemMatrix.getRowCount(); ++row) {
+        EXPECT_NEAR(1.0, subsystemMatrix.getRowSum(row), 1e-12);
+    }
+}
@@ -0,0 +1,82 @@
+#include "storm-config.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/transformer/StatePermuter.h"
+#include "test/storm_gtest.h"
+
+namespace {
+
+std::vector<storm::transformer::StatePermutationOrder> getOrders() {
+    return {storm::transformer::StatePermutationOrder::ReverseCuthillMcKee, storm::transformer::StatePermutationOrder::SccTopological,
+            storm::transformer::StatePermutationOrder::Partition};
+}
+
+/*
+ * Checks that the given formulas yield the same values on all states of the original and the permuted models.
+ */
+void checkPermutationPreservesResults(std::string const& path, std::string const& formulasString) {
+    storm::prism::Program program = storm::api::parseProgram(path);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    storm::builder::BuilderOptions options(formulas);
+    options.setBuildStateValuations();
+    options.setBuildChoiceLabels();
+    auto model = storm::api::buildSparseModel<double>(program, options);
+
+    for (auto const& order : getOrders()) {
+        auto permutation = storm::transformer::permuteStates(*model, order);
+        auto const& permutedModel = permutation.model;
+        ASSERT_EQ(model->getType(), permutedModel->getType());
+        EXPECT_EQ(model->getNumberOfStates(), permutedModel->getNumberOfStates());
+        EXPECT_EQ(model->getNumberOfChoices(), permutedModel->getNumberOfChoices());
+        EXPECT_EQ(model->getNumberOfTransitions(), permutedModel->getNumberOfTransitions());
+
+        // The mapping is a bijection and labels, valuations and choice labels are moved along with the states.
+        for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+            uint64_t newState = permutation.oldToNewStateIndexMapping[state];
+            ASSERT_LT(newState, model->getNumberOfStates());
+            EXPECT_EQ(state, permutation.newToOldStateIndexMapping[newState]);
+            EXPECT_EQ(model->getLabelsOfState(state), permutedModel->getLabelsOfState(newState));
+            EXPECT_EQ(model->getStateValuations().toString(state), permutedModel->getStateValuations().toString(newState));
+            uint64_t oldChoice = model->getTransitionMatrix().getRowGroupIndices()[state];
+            uint64_t newChoice = permutedModel->getTransitionMatrix().getRowGroupIndices()[newState];
+            EXPECT_EQ(oldChoice, permutation.newToOldChoiceIndexMapping[newChoice]);
+            EXPECT_EQ(model->getChoiceLabeling().getLabelsOfChoice(oldChoice), permutedModel->getChoiceLabeling().getLabelsOfChoice(newChoice));
+        }
+
+        for (auto const& formula : formulas) {
+            auto expected = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(formula, false));
+            auto actual = storm::api::verifyWithSparseEngine(permutedModel, storm::api::createTask<double>(formula, false));
+            std::vector<double> restored = storm::transformer::restoreOriginalStateOrder(
+                actual->asExplicitQuantitativeCheckResult<double>().getValueVector(), permutation.oldToNewStateIndexMapping);
+            std::vector<double> const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(expectedValues.size(), restored.size());
+            for (uint64_t state = 0; state < restored.size(); ++state) {
+                EXPECT_NEAR(expectedValues[state], restored[state], 1e-6) << "for " << *formula << " in " << storm::transformer::toString(order) << " order";
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(StatePermuterTest, Dtmc) {
+    checkPermutationPreservesResults(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", "P=? [F \"observe0Greater1\"]; P=? [F<=20 \"observeIGreater1\"]");
+}
+
+TEST(StatePermuterTest, Mdp) {
+    checkPermutationPreservesResults(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm", "Pmin=? [F<=5 \"elected\"]; Rmin=? [F \"elected\"]");
+}
+
+TEST(StatePermuterTest, Ctmc) {
+    checkPermutationPreservesResults(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", "P=? [F<=10 !\"minimum\"]; R{\"num_repairs\"}=? [C<=10]");
+}
+
+TEST(StatePermuterTest, InvalidPermutation) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto model = storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions());
+    std::vector<uint64_t> notAPermutation(model->getNumberOfStates(), 0);
+    STORM_SILENT_EXPECT_THROW(storm::transformer::permuteStates(*model, notAPermutation), storm::exceptions::InvalidArgumentException);
+    STORM_SILENT_EXPECT_THROW(storm::transformer::permuteStates(*model, std::vector<uint64_t>()), storm::exceptions::InvalidArgumentException);
+}